@@ -56,15 +56,20 @@ public:
 
     virtual const uint8_t* getCurrentByteData() const = 0;
 
-    virtual uint32_t getSize() const = 0;
+    virtual uint64_t getSize() const = 0;
 
     virtual VkBool32 seek(const int64_t offset, const VkTsSearch search) = 0;
 
     virtual uint32_t read(void* ptr, const uint32_t sizeElement, const uint32_t countElement) = 0;
 
+    /**
+     * Read only buffers e.g. memory mapped files do not write and return zero.
+     */
     virtual uint32_t write(const void* ptr, const uint32_t sizeElement, const uint32_t countElement) = 0;
 
-    virtual VkBool32 copy(void* data, const uint32_t dataSize) const = 0;
+    virtual VkBool32 copy(void* data, const uint64_t dataSize) const = 0;
+
+    virtual VkBool32 isReadOnly() const = 0;
 
 };
 
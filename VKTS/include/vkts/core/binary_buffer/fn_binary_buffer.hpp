@@ -38,6 +38,15 @@ namespace vkts
  */
 VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const std::vector<uint8_t>& data);
 
+/**
+ *
+ * @ThreadSafe
+ *
+ * Read only view of a part of the buffer without copying. The view keeps the buffer alive.
+ * The buffer must not be written, while the view is used.
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY binaryBufferCreateView(const IBinaryBufferSP& buffer, const uint64_t offset, const uint64_t size);
+
 /**
  *
  * @ThreadSafe
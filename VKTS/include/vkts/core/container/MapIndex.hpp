@@ -0,0 +1,281 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_MAPINDEX_HPP_
+#define VKTS_MAPINDEX_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_MAP_INDEX_EMPTY 0xFFFFFFFF
+
+#define VKTS_MAP_INDEX_MINIMUM_SLOTS 16
+
+namespace vkts
+{
+
+template<class K, class Enable = void>
+struct MapHash
+{
+    size_t operator()(const K& key) const
+    {
+        return std::hash<K>()(key);
+    }
+};
+
+// Enumerations are not hashable by the standard library before C++14.
+template<class K>
+struct MapHash<K, typename std::enable_if<std::is_enum<K>::value>::type>
+{
+    size_t operator()(const K& key) const
+    {
+        return std::hash<uint64_t>()(static_cast<uint64_t>(key));
+    }
+};
+
+/**
+ * Open addressing hash index into the keys of a map, which are stored in insertion order.
+ * Linear probing is used and every slot contains the index of the key.
+ */
+template<class K>
+class MapIndex
+{
+
+private:
+
+    std::vector<uint32_t> allSlots;
+
+    uint32_t shift;
+
+    uint32_t getHome(const K& key) const
+    {
+        // Fibonacci hashing, as standard hashes of integers and pointers are often the identity.
+        return static_cast<uint32_t>(((uint64_t)MapHash<K>()(key) * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+
+    uint32_t getMask() const
+    {
+        return static_cast<uint32_t>(allSlots.size()) - 1;
+    }
+
+    void insertSlot(const K& key, const uint32_t index)
+    {
+        uint32_t slot = getHome(key);
+
+        while (allSlots[slot] != VKTS_MAP_INDEX_EMPTY)
+        {
+            slot = (slot + 1) & getMask();
+        }
+
+        allSlots[slot] = index;
+    }
+
+public:
+
+    MapIndex() :
+        allSlots(), shift(64)
+    {
+    }
+
+    MapIndex(const MapIndex& other) = default;
+
+    MapIndex(MapIndex&& other) :
+        allSlots(std::move(other.allSlots)), shift(other.shift)
+    {
+        other.shift = 64;
+    }
+
+    MapIndex& operator= (const MapIndex& other) = default;
+
+    MapIndex& operator= (MapIndex&& other)
+    {
+        allSlots = std::move(other.allSlots);
+        shift = other.shift;
+
+        other.allSlots.clear();
+        other.shift = 64;
+
+        return *this;
+    }
+
+    ~MapIndex()
+    {
+    }
+
+    void clear()
+    {
+        allSlots.clear();
+
+        shift = 64;
+    }
+
+    /**
+     * Returns the index of the key or the size of the keys, if not found.
+     */
+    uint32_t find(const K& key, const Vector<K>& allKeys) const
+    {
+        if (allSlots.size() == 0)
+        {
+            return allKeys.size();
+        }
+
+        uint32_t slot = getHome(key);
+
+        while (allSlots[slot] != VKTS_MAP_INDEX_EMPTY)
+        {
+            if (allKeys[allSlots[slot]] == key)
+            {
+                return allSlots[slot];
+            }
+
+            slot = (slot + 1) & getMask();
+        }
+
+        return allKeys.size();
+    }
+
+    /**
+     * Indexes the last appended key.
+     */
+    void append(const Vector<K>& allKeys)
+    {
+        // Keep the load factor at or below one half.
+        if (allKeys.size() * 2 > allSlots.size())
+        {
+            rebuild(allKeys);
+
+            return;
+        }
+
+        insertSlot(allKeys[allKeys.size() - 1], allKeys.size() - 1);
+    }
+
+    /**
+     * Has to be called before the key is removed, as all following keys move down by one.
+     */
+    void removeAt(const uint32_t index, const Vector<K>& allKeys)
+    {
+        if (allSlots.size() == 0)
+        {
+            return;
+        }
+
+        uint32_t slot = getHome(allKeys[index]);
+
+        while (allSlots[slot] != index)
+        {
+            slot = (slot + 1) & getMask();
+        }
+
+        // Move following entries of the cluster back, so no probe sequence is interrupted.
+
+        uint32_t nextSlot = slot;
+
+        while (VK_TRUE)
+        {
+            nextSlot = (nextSlot + 1) & getMask();
+
+            if (allSlots[nextSlot] == VKTS_MAP_INDEX_EMPTY)
+            {
+                break;
+            }
+
+            const uint32_t home = getHome(allKeys[allSlots[nextSlot]]);
+
+            if (((nextSlot - home) & getMask()) >= ((nextSlot - slot) & getMask()))
+            {
+                allSlots[slot] = allSlots[nextSlot];
+
+                slot = nextSlot;
+            }
+        }
+
+        allSlots[slot] = VKTS_MAP_INDEX_EMPTY;
+
+        for (uint32_t i = 0; i < allSlots.size(); i++)
+        {
+            if (allSlots[i] != VKTS_MAP_INDEX_EMPTY && allSlots[i] > index)
+            {
+                allSlots[i]--;
+            }
+        }
+    }
+
+    void rebuild(const Vector<K>& allKeys)
+    {
+        if (allKeys.size() == 0)
+        {
+            clear();
+
+            return;
+        }
+
+        uint32_t slotCount = VKTS_MAP_INDEX_MINIMUM_SLOTS;
+
+        while (slotCount < allKeys.size() * 2)
+        {
+            slotCount *= 2;
+        }
+
+        shift = 64;
+
+        for (uint32_t i = slotCount; i > 1; i /= 2)
+        {
+            shift--;
+        }
+
+        allSlots.assign(slotCount, VKTS_MAP_INDEX_EMPTY);
+
+        for (uint32_t i = 0; i < allKeys.size(); i++)
+        {
+            if (find(allKeys[i], allKeys) == allKeys.size())
+            {
+                insertSlot(allKeys[i], i);
+            }
+        }
+    }
+
+    /**
+     * Returns the order of the indices, in which the keys are sorted.
+     */
+    static std::vector<uint32_t> sortedOrder(const Vector<K>& allKeys)
+    {
+        std::vector<uint32_t> allIndices(allKeys.size());
+
+        for (uint32_t i = 0; i < allKeys.size(); i++)
+        {
+            allIndices[i] = i;
+        }
+
+        std::stable_sort(allIndices.begin(), allIndices.end(), [&allKeys](const uint32_t a, const uint32_t b) { return allKeys[a] < allKeys[b]; });
+
+        return allIndices;
+    }
+
+};
+
+}
+
+#endif /* VKTS_MAPINDEX_HPP_ */
@@ -41,6 +41,8 @@ protected:
     Vector<K> allKeys;
     SmartPointerVector<V> allValues;
 
+    MapIndex<K> allIndices;
+
 public:
 
     SmartPointerMap() :
@@ -49,17 +51,18 @@ public:
     }
 
     SmartPointerMap(const uint32_t& allDataCount) :
-        allKeys(allDataCount), allValues(allDataCount)
+        allKeys(allDataCount), allValues(allDataCount), allIndices()
     {
+        allIndices.rebuild(allKeys);
     }
 
     SmartPointerMap(const SmartPointerMap& other) :
-        allKeys(other.allKeys), allValues(other.allValues)
+        allKeys(other.allKeys), allValues(other.allValues), allIndices(other.allIndices)
     {
     }
 
     SmartPointerMap(SmartPointerMap&& other) :
-        allKeys(other.allKeys), allValues(other.allValues)
+        allKeys(std::move(other.allKeys)), allValues(std::move(other.allValues)), allIndices(std::move(other.allIndices))
     {
     }
 
@@ -67,6 +70,7 @@ public:
     {
         allKeys = other.allKeys;
         allValues = other.allValues;
+        allIndices = other.allIndices;
 
         //
 
@@ -75,8 +79,9 @@ public:
 
     SmartPointerMap& operator= (SmartPointerMap&& other)
     {
-        allKeys = other.allKeys;
-        allValues = other.allValues;
+        allKeys = std::move(other.allKeys);
+        allValues = std::move(other.allValues);
+        allIndices = std::move(other.allIndices);
 
         //
 
@@ -92,63 +97,30 @@ public:
     {
         allKeys.clear();
         allValues.clear();
+        allIndices.clear();
     }
 
     uint32_t find(const K& key) const
     {
-        uint32_t start = 0;
-        uint32_t end = allKeys.size();
-
-        uint32_t result = 0;
-
-        while (start < end)
-        {
-            result = (end + start) / 2;
-
-            if (key == allKeys[result])
-            {
-                return result;
-            }
-            else if (end - start == 1)
-            {
-                break;
-            }
-
-            if (key < allKeys[result])
-            {
-                end = result;
-            }
-            else if (key > allKeys[result])
-            {
-                start = result;
-            }
-        }
-
-        return allKeys.size();
+        return allIndices.find(key, allKeys);
     }
 
     VkBool32 set(const K& key, const V& value)
     {
-        for (uint32_t i = 0; i < allKeys.size(); i++)
+        uint32_t index = find(key);
+
+        if (index != allKeys.size())
         {
-            if (key == allKeys[i])
-            {
-                allValues[i] = value;
-
-                return VK_TRUE;
-            }
-            else if (key < allKeys[i])
-            {
-                allKeys.insert(i, key);
-                allValues.insert(i, value);
-
-                return VK_TRUE;
-            }
+            allValues[index] = value;
+
+            return VK_TRUE;
         }
 
         allKeys.append(key);
         allValues.append(value);
 
+        allIndices.append(allKeys);
+
         return VK_TRUE;
     }
 
@@ -171,6 +143,8 @@ public:
             return VK_FALSE;
         }
 
+        allIndices.removeAt(index, allKeys);
+
         allKeys.removeAt(index);
         allValues.removeAt(index);
 
@@ -182,6 +156,26 @@ public:
         return find(key) != allKeys.size();
     }
 
+    /**
+     * Sorts the entries by their keys. Otherwise, the entries are kept in insertion order.
+     */
+    void sort()
+    {
+        Vector<K> allSortedKeys;
+        SmartPointerVector<V> allSortedValues;
+
+        for (const uint32_t index : MapIndex<K>::sortedOrder(allKeys))
+        {
+            allSortedKeys.append(allKeys[index]);
+            allSortedValues.append(allValues[index]);
+        }
+
+        allKeys = std::move(allSortedKeys);
+        allValues = std::move(allSortedValues);
+
+        allIndices.rebuild(allKeys);
+    }
+
     V& operator[](const K& key)
     {
         uint32_t index = find(key);
@@ -43,58 +43,65 @@ protected:
     uint32_t topElement;
     uint32_t allDataCount;
 
-    uint32_t getAllocSize()
+    uint32_t getAllocSize() const
     {
     	uint32_t tempAllDataCount = allDataCount * 2;
 
     	return tempAllDataCount > 0 ? tempAllDataCount : 1;
     }
 
+    void reallocate(const uint32_t newAllDataCount)
+    {
+        V* newAllData = containerAllocate<V>(newAllDataCount);
+
+        for (uint32_t i = 0; i < topElement; i++)
+        {
+            new (&newAllData[i]) V(std::move(allData[i]));
+
+            allData[i].~V();
+        }
+
+        containerFree(allData);
+
+        allData = newAllData;
+        allDataCount = newAllDataCount;
+    }
+
 public:
 
     SmartPointerVector() :
-        SmartPointerVector(0)
+        allData(nullptr), topElement(0), allDataCount(0)
     {
-
     }
 
     SmartPointerVector(const uint32_t allDataCount) :
         allData(nullptr), topElement(0), allDataCount(0)
     {
-        allData = new V[allDataCount];
+        allData = containerAllocate<V>(allDataCount);
 
-        if (!allData)
-        {
-        	throw std::bad_alloc();
-        }
+        this->allDataCount = allDataCount;
 
         for (uint32_t i = 0; i < allDataCount; i++)
         {
-            allData[i] = nullptr;
-        }
+            new (&allData[i]) V();
 
-        this->topElement = allDataCount;
-        this->allDataCount = allDataCount;
+            topElement++;
+        }
     }
 
     SmartPointerVector(const SmartPointerVector& other) :
         allData(nullptr), topElement(0), allDataCount(0)
     {
-        allData = new V[other.allDataCount];
+        allData = containerAllocate<V>(other.topElement);
 
-        if (!allData)
-        {
-        	throw std::bad_alloc();
-        }
+        allDataCount = other.topElement;
 
-        for (uint32_t i = 0; i < other.allDataCount; i++)
+        for (uint32_t i = 0; i < other.topElement; i++)
         {
-            allData[i] = nullptr;
-            allData[i] = other.allData[i];
-        }
+            new (&allData[i]) V(other.allData[i]);
 
-        this->topElement = other.topElement;
-        this->allDataCount = other.allDataCount;
+            topElement++;
+        }
     }
 
     SmartPointerVector(SmartPointerVector&& other) :
@@ -107,56 +114,47 @@ public:
 
     SmartPointerVector& operator= (const SmartPointerVector& other)
     {
-    	clear();
-
-        if (allData)
+        if (this == &other)
         {
-            delete[] allData;
-
-            allData = nullptr;
+            return *this;
         }
 
-        topElement = 0;
-        allDataCount = 0;
+        clear();
 
-    	//
+        if (allDataCount < other.topElement)
+        {
+            containerFree(allData);
 
-        allData = new V[other.allDataCount];
+            allData = nullptr;
+            allDataCount = 0;
 
-        if (!allData)
-        {
-        	throw std::bad_alloc();
-        }
+            allData = containerAllocate<V>(other.topElement);
 
-        for (uint32_t i = 0; i < other.allDataCount; i++)
-        {
-            allData[i] = nullptr;
-            allData[i] = other.allData[i];
+            allDataCount = other.topElement;
         }
 
-        this->topElement = other.topElement;
-        this->allDataCount = other.allDataCount;
+        for (uint32_t i = 0; i < other.topElement; i++)
+        {
+            new (&allData[i]) V(other.allData[i]);
 
-        //
+            topElement++;
+        }
 
-    	return *this;
+        return *this;
     }
 
     SmartPointerVector& operator= (SmartPointerVector&& other)
     {
-    	clear();
-
-        if (allData)
+        if (this == &other)
         {
-            delete[] allData;
-
-            allData = nullptr;
+            return *this;
         }
 
-        topElement = 0;
-        allDataCount = 0;
+        clear();
+
+        containerFree(allData);
 
-    	//
+        //
 
         allData = other.allData;
         topElement = other.topElement;
@@ -175,14 +173,9 @@ public:
     {
         clear();
 
-        if (allData)
-        {
-            delete[] allData;
-
-            allData = nullptr;
-        }
+        containerFree(allData);
 
-        topElement = 0;
+        allData = nullptr;
         allDataCount = 0;
     }
 
@@ -190,46 +183,97 @@ public:
     {
         for (uint32_t i = 0; i < topElement; i++)
         {
-            allData[i].reset();
+            allData[i].~V();
         }
 
         topElement = 0;
     }
 
-    void append(const V& value)
+    /**
+     * Allocates storage for at least the given count of elements.
+     */
+    void reserve(const uint32_t count)
+    {
+        if (count > allDataCount)
+        {
+            reallocate(count);
+        }
+    }
+
+    /**
+     * Releases the storage, which is not used by the elements.
+     */
+    void shrinkToFit()
+    {
+        if (topElement < allDataCount)
+        {
+            reallocate(topElement);
+        }
+    }
+
+    /**
+     * Constructs the element in place at the end.
+     */
+    template<class... Args>
+    V& emplace(Args&&... args)
     {
         if (topElement >= allDataCount)
         {
-            V* newAllData = new V[getAllocSize()];
+            // Construct first, as the arguments may reference an element.
+
+            const uint32_t newAllDataCount = getAllocSize();
+
+            V* newAllData = containerAllocate<V>(newAllDataCount);
 
-            if (!newAllData)
+            try
             {
-            	throw std::bad_alloc();
+                new (&newAllData[topElement]) V(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                containerFree(newAllData);
+
+                throw;
             }
 
-            for (uint32_t i = 0; i < getAllocSize(); i++)
+            for (uint32_t i = 0; i < topElement; i++)
             {
-                newAllData[i] = nullptr;
+                new (&newAllData[i]) V(std::move(allData[i]));
 
-                if (i < allDataCount)
-                {
-                    newAllData[i] = allData[i];
-                    allData[i].reset();
-                }
+                allData[i].~V();
             }
 
-            delete[] allData;
+            containerFree(allData);
 
             allData = newAllData;
-
-            allDataCount = getAllocSize();
+            allDataCount = newAllDataCount;
+        }
+        else
+        {
+            new (&allData[topElement]) V(std::forward<Args>(args)...);
         }
 
-        allData[topElement] = value;
         topElement++;
+
+        return allData[topElement - 1];
+    }
+
+    void append(const V& value)
+    {
+        emplace(value);
+    }
+
+    void append(V&& value)
+    {
+        emplace(std::move(value));
     }
 
     VkBool32 insert(const uint32_t index, const V& value)
+    {
+        return insert(index, V(value));
+    }
+
+    VkBool32 insert(const uint32_t index, V&& value)
     {
         if (index > topElement)
         {
@@ -238,44 +282,24 @@ public:
 
         if (index == topElement)
         {
-            append(value);
+            emplace(std::move(value));
 
             return VK_TRUE;
         }
 
-        if (topElement + 1 >= allDataCount)
+        if (topElement >= allDataCount)
         {
-            V* newAllData = new V[getAllocSize()];
-
-            if (!newAllData)
-            {
-            	throw std::bad_alloc();
-            }
-
-            for (uint32_t i = 0; i < getAllocSize(); i++)
-            {
-                newAllData[i] = nullptr;
-
-                if (i < allDataCount)
-                {
-                    newAllData[i] = allData[i];
-                    allData[i].reset();
-                }
-            }
-
-            delete[] allData;
-
-            allData = newAllData;
-
-            allDataCount = getAllocSize();
+            reallocate(getAllocSize());
         }
 
-        for (uint32_t copyIndex = topElement; copyIndex >= index + 1; copyIndex--)
+        new (&allData[topElement]) V(std::move(allData[topElement - 1]));
+
+        for (uint32_t copyIndex = topElement - 1; copyIndex >= index + 1; copyIndex--)
         {
-            allData[copyIndex] = allData[copyIndex - 1];
+            allData[copyIndex] = std::move(allData[copyIndex - 1]);
         }
 
-        allData[index] = value;
+        allData[index] = std::move(value);
         topElement++;
 
         return VK_TRUE;
@@ -287,26 +311,7 @@ public:
         {
             if (allData[i] == value)
             {
-                allData[i].reset();
-
-                allData[i] = nullptr;
-
-                if (i == topElement - 1)
-                {
-                    topElement--;
-
-                    return VK_TRUE;
-                }
-
-                for (uint32_t copyIndex = i; copyIndex < topElement - 1; copyIndex++)
-                {
-                    allData[copyIndex] = allData[copyIndex + 1];
-                    allData[copyIndex + 1].reset();
-                }
-
-                topElement--;
-
-                return VK_TRUE;
+                return removeAt(i);
             }
         }
 
@@ -320,7 +325,16 @@ public:
             return VK_FALSE;
         }
 
-        return remove(allData[index]);
+        for (uint32_t copyIndex = index; copyIndex < topElement - 1; copyIndex++)
+        {
+            allData[copyIndex] = std::move(allData[copyIndex + 1]);
+        }
+
+        topElement--;
+
+        allData[topElement].~V();
+
+        return VK_TRUE;
     }
 
     VkBool32 contains(const V& value) const
@@ -345,9 +359,7 @@ public:
     	else if (index == topElement)
     	{
     		// Allow to append at the end.
-    		V v;
-
-    		append(v);
+    		return emplace();
     	}
 
         return allData[index];
@@ -360,7 +372,7 @@ public:
     		throw std::out_of_range(std::to_string(index) + " >= " + std::to_string(topElement));
     	}
 
-    	return allData[index];
+        return allData[index];
     }
 
     const V* data() const
@@ -373,6 +385,11 @@ public:
         return topElement;
     }
 
+    uint32_t capacity() const
+    {
+        return allDataCount;
+    }
+
     uint32_t index(const V& value) const
     {
         for (uint32_t i = 0; i < topElement; i++)
@@ -0,0 +1,212 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_WORKSTEALINGDEQUE_HPP_
+#define VKTS_WORKSTEALINGDEQUE_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Fixed capacity, lock-free work stealing deque (Chase-Lev).
+ *
+ * Only the owning thread is allowed to push and pop at the bottom end.
+ * Any thread is allowed to steal from the top end.
+ *
+ * ELEMENT has to be trivially copyable, e.g. a pointer.
+ * Capacity has to be a power of two.
+ */
+template<class ELEMENT>
+class WorkStealingDeque
+{
+
+private:
+
+    const int64_t capacity;
+
+    const int64_t mask;
+
+    std::atomic<ELEMENT>* allElements;
+
+    std::atomic<int64_t> top;
+
+    std::atomic<int64_t> bottom;
+
+public:
+
+    WorkStealingDeque() = delete;
+
+    explicit WorkStealingDeque(const uint32_t capacity) :
+        capacity((int64_t)capacity), mask((int64_t)capacity - 1), allElements(nullptr), top(0), bottom(0)
+    {
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+        {
+            throw std::invalid_argument("Capacity has to be a power of two");
+        }
+
+        allElements = new std::atomic<ELEMENT>[capacity];
+
+        if (!allElements)
+        {
+            throw std::bad_alloc();
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque& other) = delete;
+
+    WorkStealingDeque(WorkStealingDeque&& other) = delete;
+
+    ~WorkStealingDeque()
+    {
+        delete[] allElements;
+    }
+
+    WorkStealingDeque& operator =(const WorkStealingDeque& other) = delete;
+
+    WorkStealingDeque& operator =(WorkStealingDeque && other) = delete;
+
+    /**
+     * Owner thread only. Returns VK_FALSE, if the deque is full.
+     */
+    VkBool32 push(const ELEMENT& element)
+    {
+        int64_t currentBottom = bottom.load(std::memory_order_relaxed);
+        int64_t currentTop = top.load(std::memory_order_acquire);
+
+        if (currentBottom - currentTop >= capacity)
+        {
+            return VK_FALSE;
+        }
+
+        allElements[currentBottom & mask].store(element, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_release);
+
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+
+        return VK_TRUE;
+    }
+
+    /**
+     * Owner thread only. Takes the most recently pushed element.
+     */
+    VkBool32 pop(ELEMENT& result)
+    {
+        int64_t currentBottom = bottom.load(std::memory_order_relaxed) - 1;
+
+        bottom.store(currentBottom, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        int64_t currentTop = top.load(std::memory_order_relaxed);
+
+        if (currentTop > currentBottom)
+        {
+            // Empty, so restore.
+            bottom.store(currentBottom + 1, std::memory_order_relaxed);
+
+            return VK_FALSE;
+        }
+
+        ELEMENT element = allElements[currentBottom & mask].load(std::memory_order_relaxed);
+
+        if (currentTop == currentBottom)
+        {
+            // Last element, so race against the thieves.
+            VkBool32 won = (VkBool32)top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+            bottom.store(currentBottom + 1, std::memory_order_relaxed);
+
+            if (!won)
+            {
+                return VK_FALSE;
+            }
+        }
+
+        result = element;
+
+        return VK_TRUE;
+    }
+
+    /**
+     * Thread safe. Takes the oldest element.
+     * Returns VK_FALSE, if the deque is empty or the race against another thread was lost.
+     */
+    VkBool32 steal(ELEMENT& result)
+    {
+        int64_t currentTop = top.load(std::memory_order_acquire);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        int64_t currentBottom = bottom.load(std::memory_order_acquire);
+
+        if (currentTop >= currentBottom)
+        {
+            return VK_FALSE;
+        }
+
+        ELEMENT element = allElements[currentTop & mask].load(std::memory_order_relaxed);
+
+        if (!top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return VK_FALSE;
+        }
+
+        result = element;
+
+        return VK_TRUE;
+    }
+
+    /**
+     * Thread safe, but only a snapshot.
+     */
+    VkBool32 empty() const
+    {
+        return (VkBool32)(bottom.load(std::memory_order_acquire) <= top.load(std::memory_order_acquire));
+    }
+
+    /**
+     * Thread safe, but only a snapshot.
+     */
+    uint32_t size() const
+    {
+        int64_t currentSize = bottom.load(std::memory_order_acquire) - top.load(std::memory_order_acquire);
+
+        return currentSize > 0 ? (uint32_t)currentSize : 0;
+    }
+
+    uint32_t getCapacity() const
+    {
+        return (uint32_t)capacity;
+    }
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_WORKSTEALINGDEQUE_HPP_ */
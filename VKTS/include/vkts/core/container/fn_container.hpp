@@ -0,0 +1,91 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_CONTAINER_HPP_
+#define VKTS_FN_CONTAINER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Allocates uninitialized storage for the given count of elements, aligned as required by the element type.
+ *
+ * @ThreadSafe
+ */
+template<class V>
+V* containerAllocate(const uint32_t count)
+{
+    if (count == 0)
+    {
+        return nullptr;
+    }
+
+    const size_t size = sizeof(V) * (size_t)count;
+
+    if (alignof(V) <= alignof(std::max_align_t))
+    {
+        return static_cast<V*>(::operator new(size));
+    }
+
+    // Over aligned types: The original pointer is stored in front of the aligned data.
+
+    uint8_t* memory = static_cast<uint8_t*>(::operator new(size + alignof(V) + sizeof(void*)));
+
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(memory) + sizeof(void*) + alignof(V) - 1) & ~(uintptr_t)(alignof(V) - 1);
+
+    reinterpret_cast<void**>(aligned)[-1] = memory;
+
+    return reinterpret_cast<V*>(aligned);
+}
+
+/**
+ * Frees storage allocated by containerAllocate. All elements have to be destroyed before.
+ *
+ * @ThreadSafe
+ */
+template<class V>
+void containerFree(V* data)
+{
+    if (!data)
+    {
+        return;
+    }
+
+    if (alignof(V) <= alignof(std::max_align_t))
+    {
+        ::operator delete(data);
+
+        return;
+    }
+
+    ::operator delete(reinterpret_cast<void**>(data)[-1]);
+}
+
+}
+
+#endif /* VKTS_FN_CONTAINER_HPP_ */
@@ -29,9 +29,18 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#define VKTS_FILE_ASYNC_DEFAULT_THREADS 2
+
 namespace vkts
 {
 
+/**
+ * Called on an I/O thread after the file is loaded. The buffer is empty, if the file could not be loaded.
+ */
+typedef std::function<void(const std::string& filename, const IBinaryBufferSP& buffer)> FileLoadBinaryFunction;
+
+typedef std::function<void(const std::string& filename, const ITextBufferSP& text)> FileLoadTextFunction;
+
 /**
  * Not thread Safe.
  */
@@ -49,6 +58,77 @@ VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY fileLoadBinary(const char* filename);
  */
 VKTS_APICALL ITextBufferSP VKTS_APIENTRY fileLoadText(const char* filename);
 
+/**
+ *
+ * @ThreadSafe
+ *
+ * Maps the file read only into memory, so it is paged in on access and not copied.
+ * If mapping is not possible, the file is loaded and returned as a read only buffer as well.
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY fileMapBinary(const char* filename, const VkTsFileAccess access = VKTS_FILE_ACCESS_NORMAL);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Read only text of a memory mapped file. Falls back to a copy, if the text can not be terminated in place.
+ */
+VKTS_APICALL ITextBufferSP VKTS_APIENTRY fileMapText(const char* filename);
+
+/**
+ * Not thread Safe.
+ *
+ * Number of I/O threads for the asynchronous loads. Zero selects VKTS_FILE_ASYNC_DEFAULT_THREADS.
+ * Already running I/O threads are stopped after the pending requests are processed. The I/O threads are lazily created by the next request.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY fileSetAsyncThreadCount(const uint32_t count);
+
+/**
+ * Not thread Safe.
+ */
+VKTS_APICALL uint32_t VKTS_APIENTRY fileGetAsyncThreadCount();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Loads the file like fileLoadBinary on an I/O thread. The function is called before the future becomes ready.
+ */
+VKTS_APICALL std::shared_future<IBinaryBufferSP> VKTS_APIENTRY fileLoadBinaryAsync(const char* filename, const VkTsFilePriority priority = VKTS_FILE_PRIORITY_NORMAL, const FileLoadBinaryFunction& function = FileLoadBinaryFunction());
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Loads the file like fileLoadText on an I/O thread. The function is called before the future becomes ready.
+ */
+VKTS_APICALL std::shared_future<ITextBufferSP> VKTS_APIENTRY fileLoadTextAsync(const char* filename, const VkTsFilePriority priority = VKTS_FILE_PRIORITY_NORMAL, const FileLoadTextFunction& function = FileLoadTextFunction());
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Many small files are queued as one request and loaded in the given order by one I/O thread.
+ * The returned futures are in the same order as the filenames. The function is called for every file.
+ */
+VKTS_APICALL std::vector<std::shared_future<IBinaryBufferSP>> VKTS_APIENTRY fileLoadBinaryBatch(const std::vector<std::string>& allFilenames, const VkTsFilePriority priority = VKTS_FILE_PRIORITY_NORMAL, const FileLoadBinaryFunction& function = FileLoadBinaryFunction());
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Number of queued and currently loaded files.
+ */
+VKTS_APICALL uint32_t VKTS_APIENTRY fileGetAsyncPendingCount();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Blocks, until all queued files are loaded.
+ */
+VKTS_APICALL void VKTS_APIENTRY fileWaitAsync();
+
 /**
  *
  * @ThreadSafe
@@ -73,6 +153,20 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY fileSaveText(const char* filename, const ITe
  */
 VKTS_APICALL VkBool32 VKTS_APIENTRY fileCreateDirectory(const char* directory);
 
+/**
+ *
+ * @ThreadSafe
+ *
+ * An existing new file is replaced. Renaming a completely written temporary file makes saving atomic.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY fileRename(const char* oldFilename, const char* newFilename);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY fileRemove(const char* filename);
+
 /**
  *
  * @ThreadSafe
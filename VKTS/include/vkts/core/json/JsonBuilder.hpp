@@ -0,0 +1,106 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONBUILDER_HPP_
+#define VKTS_JSONBUILDER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+class JsonArena;
+
+/**
+ * Builds JSON values out of the events. Every complete value is allocated in its own arena,
+ * so the memory of a value is released independent of the other values.
+ */
+class JsonBuilder : public JsonHandler
+{
+
+private:
+
+	std::shared_ptr<JsonArena> arena;
+
+	// Open objects and arrays. For objects, the key of the next value is stored.
+	std::vector<JSONvalueSP> allContainers;
+
+	std::vector<VkBool32> allObjects;
+
+	std::vector<std::string> allKeys;
+
+	JSONvalueSP value;
+
+	void startValue();
+
+	VkBool32 addValue(const JSONvalueSP& currentValue);
+
+	VkBool32 endContainer(const VkBool32 isObject);
+
+public:
+
+	JsonBuilder();
+	JsonBuilder(const JsonBuilder& other) = delete;
+	JsonBuilder(JsonBuilder&& other) = delete;
+	virtual ~JsonBuilder();
+
+	JsonBuilder& operator =(const JsonBuilder& other) = delete;
+	JsonBuilder& operator =(JsonBuilder && other) = delete;
+
+	/**
+	 * Returns the last complete value.
+	 */
+	const JSONvalueSP& getValue() const;
+
+	//
+
+	virtual VkBool32 startObject() override;
+
+	virtual VkBool32 key(const std::string& key) override;
+
+	virtual VkBool32 endObject() override;
+
+	virtual VkBool32 startArray() override;
+
+	virtual VkBool32 endArray() override;
+
+	virtual VkBool32 stringValue(const std::string& value) override;
+
+	virtual VkBool32 integerValue(const int32_t value) override;
+
+	virtual VkBool32 floatValue(const float value) override;
+
+	virtual VkBool32 trueValue() override;
+
+	virtual VkBool32 falseValue() override;
+
+	virtual VkBool32 nullValue() override;
+
+};
+
+}
+
+#endif /* VKTS_JSONBUILDER_HPP_ */
@@ -0,0 +1,127 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONHANDLER_HPP_
+#define VKTS_JSONHANDLER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Receives the decoded JSON text as events, without building JSON values.
+ * Returning false from any event stops decoding.
+ */
+class JsonHandler
+{
+
+public:
+
+	JsonHandler()
+	{
+	}
+
+	virtual ~JsonHandler()
+	{
+	}
+
+	/**
+	 * Called before every value. If true is returned, the value is skipped without any further events.
+	 */
+	virtual VkBool32 skipValue()
+	{
+		return VK_FALSE;
+	}
+
+	/**
+	 * Called with the text of the skipped value, which points into the decoded text.
+	 */
+	virtual VkBool32 skippedValue(const char* jsonText, const uint64_t length)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 startObject()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 key(const std::string& key)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 endObject()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 startArray()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 endArray()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 stringValue(const std::string& value)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 integerValue(const int32_t value)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 floatValue(const float value)
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 trueValue()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 falseValue()
+	{
+		return VK_TRUE;
+	}
+
+	virtual VkBool32 nullValue()
+	{
+		return VK_TRUE;
+	}
+
+};
+
+}
+
+#endif /* VKTS_JSONHANDLER_HPP_ */
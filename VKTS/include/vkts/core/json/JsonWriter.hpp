@@ -0,0 +1,121 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONWRITER_HPP_
+#define VKTS_JSONWRITER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Writes the events as JSON text into a reusable buffer. If a file is given, the buffer
+ * is flushed to the file whenever it is full, so large documents are never held in memory.
+ */
+class JsonWriter : public JsonHandler
+{
+
+private:
+
+	FILE* file;
+
+	const VkBool32 compact;
+
+	std::string text;
+
+	// Open objects and arrays and the number of their written values.
+	std::vector<VkBool32> allObjects;
+
+	std::vector<uint32_t> allCounts;
+
+	VkBool32 hasKey;
+
+	VkBool32 startValue();
+
+	void startElement();
+
+	void writeString(const std::string& value);
+
+	VkBool32 endValue();
+
+	VkBool32 endContainer(const VkBool32 isObject);
+
+public:
+
+	JsonWriter(const VkBool32 compact);
+	JsonWriter(FILE* file, const VkBool32 compact);
+	JsonWriter(const JsonWriter& other) = delete;
+	JsonWriter(JsonWriter&& other) = delete;
+	virtual ~JsonWriter();
+
+	JsonWriter& operator =(const JsonWriter& other) = delete;
+	JsonWriter& operator =(JsonWriter && other) = delete;
+
+	/**
+	 * Returns the written and not yet flushed text.
+	 */
+	const std::string& getText() const;
+
+	/**
+	 * Clears the text and the state but keeps the allocated buffer.
+	 */
+	void reset();
+
+	/**
+	 * Writes the text to the file and clears it.
+	 */
+	VkBool32 flush();
+
+	//
+
+	virtual VkBool32 startObject() override;
+
+	virtual VkBool32 key(const std::string& key) override;
+
+	virtual VkBool32 endObject() override;
+
+	virtual VkBool32 startArray() override;
+
+	virtual VkBool32 endArray() override;
+
+	virtual VkBool32 stringValue(const std::string& value) override;
+
+	virtual VkBool32 integerValue(const int32_t value) override;
+
+	virtual VkBool32 floatValue(const float value) override;
+
+	virtual VkBool32 trueValue() override;
+
+	virtual VkBool32 falseValue() override;
+
+	virtual VkBool32 nullValue() override;
+
+};
+
+}
+
+#endif /* VKTS_JSONWRITER_HPP_ */
@@ -41,8 +41,34 @@ VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecode(const std::string& jsonText);
 /**
  *
  * @ThreadSafe
+ *
+ * Decodes the text in place, e.g. of a memory mapped file, without copying it into a string.
+ */
+VKTS_APICALL JSONvalueSP VKTS_APIENTRY jsonDecode(const char* jsonText, const uint64_t length);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Decodes the text as events into the handler, without building JSON values.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY jsonRead(const char* jsonText, const uint64_t length, JsonHandler& jsonHandler);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Writes the value as events into the handler, e.g. a JsonWriter streaming into a file.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY jsonWrite(const JSONvalueSP& value, JsonHandler& jsonHandler);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Compact text is written without any whitespace.
  */
-VKTS_APICALL std::string VKTS_APIENTRY jsonEncode(const JSONvalueSP& value);
+VKTS_APICALL std::string VKTS_APIENTRY jsonEncode(const JSONvalueSP& value, const VkBool32 compact = VK_FALSE);
 
 }
 
@@ -62,6 +62,52 @@ VKTS_APICALL int32_t VKTS_APIENTRY logGetLevel();
  */
 VKTS_APICALL void VKTS_APIENTRY logPrint(const int32_t verbosity, const char* fileName, const int32_t lineNumber, const char* format, ...);
 
+/**
+ * Not thread Safe.
+ *
+ * Default is synchronous. In deferred mode, string arguments are copied, but the format has to stay valid e.g. a string literal.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY logSetMode(const VkTsLogMode mode, const VkTsLogPolicy policy = VKTS_LOG_POLICY_DROP);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkTsLogMode VKTS_APIENTRY logGetMode();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Maximum messages per second of one call site i.e. file and line. Zero disables the limit.
+ */
+VKTS_APICALL void VKTS_APIENTRY logSetRateLimit(const uint32_t messagesPerSecond);
+
+/**
+ * Not thread Safe.
+ *
+ * Writes the messages in binary form into the given file instead of printing them. nullptr switches back to printing.
+ * Per message: double time in seconds, int32_t verbosity, uint32_t thread index, int32_t line number,
+ * uint32_t file name length, the file name, uint32_t message length and the message.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY logSetBinaryOutput(const char* filename);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Blocks, until all messages logged before are written.
+ */
+VKTS_APICALL void VKTS_APIENTRY logFlush();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Messages dropped because of a full buffer and messages suppressed by the rate limit.
+ */
+VKTS_APICALL void VKTS_APIENTRY logGetDropCount(uint64_t& droppedCount, uint64_t& rateLimitedCount);
+
 /**
  * Not thread Safe.
  */
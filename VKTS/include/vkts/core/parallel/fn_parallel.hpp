@@ -0,0 +1,114 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_PARALLEL_HPP_
+#define VKTS_FN_PARALLEL_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_PARALLEL_DEFAULT_CHUNKS 64
+
+namespace vkts
+{
+
+/**
+ * Executes the half open range [begin, end) of one chunk.
+ */
+typedef std::function<void(const uint32_t begin, const uint32_t end)> ParallelForFunction;
+
+/**
+ * Not thread Safe.
+ *
+ * Number of helper threads. Zero selects the number of processors minus one, as the calling thread helps as well.
+ * Already running helper threads are stopped. The helper threads are lazily created by the next parallel call.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parallelSetThreadCount(const uint32_t count);
+
+/**
+ * Not thread Safe.
+ */
+VKTS_APICALL uint32_t VKTS_APIENTRY parallelGetThreadCount();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Returns the used grain size. The chunks only depend on the range and the grain size, but not on the number of threads.
+ * A grain size of zero splits the range into VKTS_PARALLEL_DEFAULT_CHUNKS chunks.
+ */
+VKTS_APICALL uint32_t VKTS_APIENTRY parallelGetGrain(const uint32_t begin, const uint32_t end, const uint32_t grain);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Splits the range into chunks of grain size and executes them in parallel. The calling thread executes chunks as well
+ * and returns after all chunks are executed. Nested calls are allowed.
+ */
+VKTS_APICALL void VKTS_APIENTRY parallelFor(const uint32_t begin, const uint32_t end, const uint32_t grain, const ParallelForFunction& function);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Every chunk is mapped in parallel. The chunk results are reduced in chunk order on the calling thread,
+ * so the result is reproducible independent of the number of threads.
+ */
+template<class T>
+T parallelReduce(const uint32_t begin, const uint32_t end, const uint32_t grain, const T& identity, const std::function<T(const uint32_t begin, const uint32_t end)>& map, const std::function<T(const T& left, const T& right)>& reduce)
+{
+    if (end <= begin)
+    {
+        return identity;
+    }
+
+    uint32_t currentGrain = parallelGetGrain(begin, end, grain);
+
+    std::vector<T> allResults((end - begin + currentGrain - 1) / currentGrain, identity);
+
+    parallelFor(begin, end, currentGrain, [&](const uint32_t chunkBegin, const uint32_t chunkEnd)
+    {
+        allResults[(chunkBegin - begin) / currentGrain] = map(chunkBegin, chunkEnd);
+    });
+
+    T result = identity;
+
+    for (size_t i = 0; i < allResults.size(); i++)
+    {
+        result = reduce(result, allResults[i]);
+    }
+
+    return result;
+}
+
+/**
+ * Not thread Safe.
+ */
+VKTS_APICALL void VKTS_APIENTRY parallelTerminate();
+
+}
+
+#endif /* VKTS_FN_PARALLEL_HPP_ */
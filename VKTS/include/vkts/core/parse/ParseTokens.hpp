@@ -0,0 +1,84 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_PARSETOKENS_HPP_
+#define VKTS_PARSETOKENS_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_PARSE_TOKEN_UNKNOWN -1
+
+namespace vkts
+{
+
+/**
+ * Fixed set of keywords, looked up by a perfect hash. The index of a keyword is its position
+ * in the constructor list, so a parser can switch over it instead of comparing each keyword.
+ */
+class ParseTokens
+{
+
+private:
+
+	std::vector<std::string> allTokens;
+
+	std::vector<int32_t> allSlots;
+
+	uint32_t seed;
+
+	uint32_t hash(const char* token, const uint32_t length, const uint32_t currentSeed) const;
+
+	VkBool32 build(const uint32_t slotCount, const uint32_t currentSeed);
+
+public:
+
+	ParseTokens(std::initializer_list<const char*> allTokens);
+	ParseTokens(const ParseTokens& other) = delete;
+	ParseTokens(ParseTokens&& other) = delete;
+	~ParseTokens();
+
+	ParseTokens& operator =(const ParseTokens& other) = delete;
+	ParseTokens& operator =(ParseTokens && other) = delete;
+
+	/**
+	 * Returns the index of the token or VKTS_PARSE_TOKEN_UNKNOWN.
+	 *
+	 * @ThreadSafe
+	 */
+	int32_t find(const char* token, const uint32_t length) const;
+
+	/**
+	 * Returns the index of the first token of the buffer. The cursor is placed after the token.
+	 *
+	 * @ThreadSafe
+	 */
+	int32_t find(const char** cursor) const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_PARSETOKENS_HPP_ */
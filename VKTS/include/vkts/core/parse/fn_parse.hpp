@@ -32,6 +32,70 @@
 namespace vkts
 {
 
+/**
+ * Skips white space and returns the next token, which is not zero terminated. The cursor is placed after the token.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextToken(const char** cursor, const char** token, uint32_t* length);
+
+/**
+ * Copies the next token. The string has to hold stringSize + 1 characters.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextString(const char** cursor, char* string, const uint32_t stringSize);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextBool(const char** cursor, VkBool32* scalar);
+
+/**
+ * Parses the next number independent of the locale. The result is correctly rounded.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextFloat(const char** cursor, float* scalar);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextInt(const char** cursor, int32_t* scalar);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextUIntHex(const char** cursor, uint32_t* scalar);
+
+/**
+ * Parses the next count numbers, e.g. after the keyword found by ParseTokens::find, without tokenizing the keyword again.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextFloats(const char** cursor, float* vec, const uint32_t count);
+
+/**
+ * Parses the next count integers, e.g. after the keyword found by ParseTokens::find, without tokenizing the keyword again.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY parseNextInts(const char** cursor, int32_t* ivec, const uint32_t count);
+
+/**
+ * Returns the float nearest to mantissa * 10^exponent, independent of the locale.
+ * The decimal number has to be gathered from the unsigned text between start and end, which is only converted again in rare cases.
+ * Truncated has to be set, if the mantissa does not hold all significant digits.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL float VKTS_APIENTRY parseDecimalFloat(const char* start, const char* end, const uint64_t mantissa, const int32_t exponent, const VkBool32 truncated);
+
+//
+
 VKTS_APICALL VkBool32 VKTS_APIENTRY parseSkipBuffer(const char* buffer);
 
 VKTS_APICALL void VKTS_APIENTRY parseUnknownBuffer(const char* buffer);
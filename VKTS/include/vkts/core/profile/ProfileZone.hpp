@@ -0,0 +1,93 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_PROFILEZONE_HPP_
+#define VKTS_PROFILEZONE_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_PROFILE_ZONE_CONCAT_INNER(a, b) a ## b
+#define VKTS_PROFILE_ZONE_CONCAT(a, b) VKTS_PROFILE_ZONE_CONCAT_INNER(a, b)
+
+/**
+ * Records the enclosing scope as a zone. Defining VKTS_NO_PROFILE_ZONE removes all zones at compile time.
+ */
+#ifdef VKTS_NO_PROFILE_ZONE
+#define VKTS_PROFILE_ZONE(name)
+#else
+#define VKTS_PROFILE_ZONE(name) vkts::ProfileZone VKTS_PROFILE_ZONE_CONCAT(profileZone, __LINE__)(name)
+#endif
+
+namespace vkts
+{
+
+/**
+ * Scoped zone. If zone profiling is disabled, only the enabled flag is checked.
+ *
+ * Not thread Safe.
+ */
+class ProfileZone
+{
+
+private:
+
+    const char* name;
+
+    uint64_t beginTime;
+
+public:
+
+    ProfileZone() = delete;
+    ProfileZone(const ProfileZone& other) = delete;
+    ProfileZone(ProfileZone&& other) = delete;
+
+    explicit ProfileZone(const char* name) :
+        name(nullptr), beginTime(0)
+    {
+        if (profileZoneIsEnabled())
+        {
+            this->name = name;
+
+            beginTime = profileZoneGetTime();
+        }
+    }
+
+    ~ProfileZone()
+    {
+        if (name)
+        {
+            profileZoneRecord(name, beginTime, profileZoneGetTime());
+        }
+    }
+
+    ProfileZone& operator =(const ProfileZone& other) = delete;
+    ProfileZone& operator =(ProfileZone && other) = delete;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_PROFILEZONE_HPP_ */
@@ -44,6 +44,67 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY profileApplicationGetRam(uint64_t& ram);
 
 VKTS_APICALL VkBool32 VKTS_APIENTRY profileApplicationGetFps(uint32_t& fps, const double deltaTime);
 
+//
+// Zone profiling.
+//
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Zones are only recorded, if enabled. Default is disabled.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileZoneSetEnabled(const VkBool32 enabled);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY profileZoneIsEnabled();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Nanoseconds since the first call.
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY profileZoneGetTime();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Records a zone into the ring buffer of the calling thread. The name has to stay valid e.g. a string literal.
+ * If the ring buffer is full, the oldest zones are overwritten.
+ */
+VKTS_APICALL void VKTS_APIENTRY profileZoneRecord(const char* name, const uint64_t beginTime, const uint64_t endTime);
+
+/**
+ * Not thread Safe.
+ *
+ * Discards all recorded zones. Fails, if recording is enabled. Zones still open, when recording was disabled, have to end before.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY profileZoneReset();
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Saves all recorded zones in the Chrome trace event format, viewable in chrome://tracing.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY profileZoneSaveChromeTrace(const char* filename);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Saves all recorded zones in a compact binary format:
+ * Header "VKTSZONE", uint32_t version, uint32_t name count, uint32_t zone count.
+ * Per name uint32_t length and the characters. Per zone uint32_t name index, uint32_t thread index,
+ * uint64_t begin time and uint64_t duration in nanoseconds.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY profileZoneSaveBinary(const char* filename);
+
 VKTS_APICALL void VKTS_APIENTRY profileTerminate();
 
 }
@@ -48,14 +48,19 @@ public:
 
     virtual const char* getString() const = 0;
 
-    virtual uint32_t getLength() const = 0;
+    virtual uint64_t getLength() const = 0;
 
     virtual VkBool32 seek(const int64_t offset, const VkTsSearch search) = 0;
 
     virtual const char* gets(char* str, const uint32_t num) = 0;
 
+    /**
+     * Read only buffers e.g. memory mapped files do not write and return VK_FALSE.
+     */
     virtual VkBool32 puts(const char* str) = 0;
 
+    virtual VkBool32 isReadOnly() const = 0;
+
 };
 
 typedef std::shared_ptr<ITextBuffer> ITextBufferSP;
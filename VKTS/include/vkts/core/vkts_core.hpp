@@ -41,13 +41,21 @@
 #include <cmath>
 #include <condition_variable>
 #include <cstdarg>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
+#include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <queue>
+#include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <string>
@@ -112,6 +120,39 @@ typedef enum VkTsSearch_
     VKTS_SEARCH_ABSOLUTE = 0, VKTS_SEARCH_RELATVE = 1
 } VkTsSearch;
 
+/**
+ * Expected access pattern of a memory mapped file.
+ */
+typedef enum VkTsFileAccess_
+{
+    VKTS_FILE_ACCESS_NORMAL = 0, VKTS_FILE_ACCESS_SEQUENTIAL = 1, VKTS_FILE_ACCESS_RANDOM = 2, VKTS_FILE_ACCESS_WILL_NEED = 3
+} VkTsFileAccess;
+
+/**
+ * Order, in which asynchronous file requests are processed. Requests with the same priority are processed first in, first out.
+ */
+typedef enum VkTsFilePriority_
+{
+    VKTS_FILE_PRIORITY_LOW = 0, VKTS_FILE_PRIORITY_NORMAL = 1, VKTS_FILE_PRIORITY_HIGH = 2
+} VkTsFilePriority;
+
+/**
+ * Synchronous prints on the calling thread. Asynchronous copies the message into a buffer of the calling thread,
+ * which is printed by a background thread. Deferred does postpone the formatting to the background thread as well.
+ */
+typedef enum VkTsLogMode_
+{
+    VKTS_LOG_MODE_SYNC = 0, VKTS_LOG_MODE_ASYNC = 1, VKTS_LOG_MODE_ASYNC_DEFERRED = 2
+} VkTsLogMode;
+
+/**
+ * What happens, if the buffer of a thread is full.
+ */
+typedef enum VkTsLogPolicy_
+{
+    VKTS_LOG_POLICY_DROP = 0, VKTS_LOG_POLICY_BLOCK = 1
+} VkTsLogPolicy;
+
 typedef struct VkTsDynamicOffset_
 {
     uint32_t offset;
@@ -131,12 +172,16 @@ typedef struct VkTsDynamicOffset_
  * Container.
  */
 
+#include <vkts/core/container/fn_container.hpp>
+
 #include <vkts/core/container/List.hpp>
 #include <vkts/core/container/SmartPointerList.hpp>
 #include <vkts/core/container/SmartPointerVector.hpp>
 #include <vkts/core/container/ThreadsafeQueue.hpp>
 #include <vkts/core/container/Vector.hpp>
+#include <vkts/core/container/WorkStealingDeque.hpp>
 
+#include <vkts/core/container/MapIndex.hpp>
 #include <vkts/core/container/Map.hpp>
 #include <vkts/core/container/SmartPointerMap.hpp>
 
@@ -157,6 +202,7 @@ typedef struct VkTsDynamicOffset_
  */
 
 #include <vkts/core/parse/fn_parse.hpp>
+#include <vkts/core/parse/ParseTokens.hpp>
 
 /**
  * Time.
@@ -170,12 +216,20 @@ typedef struct VkTsDynamicOffset_
 
 #include <vkts/core/processor/fn_processor.hpp>
 
+/**
+ * Parallel.
+ */
+
+#include <vkts/core/parallel/fn_parallel.hpp>
+
 /**
  * Profile.
  */
 
 #include <vkts/core/profile/fn_profile.hpp>
 
+#include <vkts/core/profile/ProfileZone.hpp>
+
 /**
  * Binary buffer.
  */
@@ -206,6 +260,8 @@ typedef struct VkTsDynamicOffset_
 
 #include <vkts/core/json/JsonVisitor.hpp>
 
+#include <vkts/core/json/JsonHandler.hpp>
+
 #include <vkts/core/json/JSONvalue.hpp>
 #include <vkts/core/json/JSONnumber.hpp>
 
@@ -218,6 +274,9 @@ typedef struct VkTsDynamicOffset_
 #include <vkts/core/json/JSONfloat.hpp>
 #include <vkts/core/json/JSONinteger.hpp>
 
+#include <vkts/core/json/JsonBuilder.hpp>
+#include <vkts/core/json/JsonWriter.hpp>
+
 #include <vkts/core/json/fn_json.hpp>
 
 #endif /* VKTS_VKTS_CORE_HPP_ */
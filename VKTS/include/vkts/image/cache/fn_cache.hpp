@@ -36,6 +36,80 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY cacheGetEnabled();
 
 VKTS_APICALL void VKTS_APIENTRY cacheSetEnabled(const VkBool32 enabled);
 
+/**
+ * Writes the index, if the usage of entries changed since it was written. Has to be called before the application exits.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheFlush();
+
+/**
+ * Creates the content address of derived data, e.g. a prefiltered cube map or a converted image.
+ * The key covers the source bytes, the processing parameters and the cache version. Zero is never returned.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheCreateKey(const void* data, const size_t size, const std::string& parameters);
+
+/**
+ * Zero is returned, if the image data is not valid.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheCreateKey(const IImageDataSP& imageData, const std::string& parameters);
+
+/**
+ * Derives a key from another key, e.g. for further processing of an already keyed source.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheCreateKey(const uint64_t key, const std::string& parameters);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL uint64_t VKTS_APIENTRY cacheGetMaxSize();
+
+/**
+ * The least recently used entries are removed, as long as the cache is larger than the given size in bytes.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL void VKTS_APIENTRY cacheSetMaxSize(const uint64_t maxSize);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY cacheLoadBinary(const uint64_t key);
+
+/**
+ * The entry is written to a temporary file and renamed, when complete.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheSaveBinary(const uint64_t key, const void* data, const uint32_t size);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheSaveBinary(const uint64_t key, const IBinaryBufferSP& buffer);
+
+/**
+ * Returns an empty vector, if the entry does not exist or is corrupt.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL SmartPointerVector<IImageDataSP> VKTS_APIENTRY cacheLoadImageDatas(const uint64_t key);
+
+/**
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY cacheSaveImageDatas(const uint64_t key, const SmartPointerVector<IImageDataSP>& allImageData);
+
 /**
  *
  * @ThreadSafe
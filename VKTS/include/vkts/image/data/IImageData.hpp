@@ -99,6 +99,42 @@ public:
 
     virtual glm::vec4 getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const = 0;
 
+    /**
+     * Tightly packed texels of one row of the given level, or nullptr, e.g. for block formats.
+     * No state is changed, so several threads can access the rows at the same time.
+     */
+    virtual const void* getRowData(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const = 0;
+
+    /**
+     * As getRowData, but nullptr for read only data, e.g. a mapped file.
+     */
+    virtual void* getWritableRowData(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) = 0;
+
+    template<typename T>
+    const T* getRow(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const
+    {
+        return static_cast<const T*>(getRowData(y, z, mipLevel, arrayLayer));
+    }
+
+    template<typename T>
+    T* getWritableRow(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer)
+    {
+        return static_cast<T*>(getWritableRowData(y, z, mipLevel, arrayLayer));
+    }
+
+    /**
+     * Converts count texels, starting at x, to RGBA.
+     *
+     * @ThreadSafe
+     */
+    virtual VkBool32 readRow(glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count, const uint32_t mipLevel, const uint32_t arrayLayer) const = 0;
+
+    /**
+     * Converts count RGBA values to texels, starting at x. UNORM values are clamped.
+     * Several threads can write at the same time, as long as the texels do not overlap.
+     */
+    virtual VkBool32 writeRow(const glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count, const uint32_t mipLevel, const uint32_t arrayLayer) = 0;
+
     virtual glm::vec4 getSample(const float x, const VkFilter filterX, const VkSamplerAddressMode addressModeX, const float y, const VkFilter filterY, const VkSamplerAddressMode addressModeY, const float z, const VkFilter filterZ, const VkSamplerAddressMode addressModeZ, const uint32_t mipLevel, const uint32_t arrayLayer) const = 0;
 
     virtual glm::vec4 getSampleCubeMap(const float x, const float y, const float z, const VkFilter filter, const uint32_t mipLevel) const = 0;
@@ -161,18 +161,44 @@ VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataMerge(const SmartPointerVector<
 /**
  *
  * @ThreadSafe
+ *
+ * Every level is filtered from the previous one. SRGB formats and LDR color data are averaged in linear space.
+ * The rows of a level are filtered in parallel.
+ */
+VKTS_APICALL SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, const VkBool32 addSourceAsCopy, const std::string& name, const enum VkTsMipmapFilter filter = VKTS_MIPMAP_FILTER_BOX, const enum VkTsImageDataType imageDataType = VKTS_NON_COLOR_DATA);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Same as imageDataMipmap, but all levels of all array layers are stored in one image data. Only the first level of the source is used.
  */
-VKTS_APICALL SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, const VkBool32 addSourceAsCopy, const std::string& name);
+VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataMipmapChain(const IImageDataSP& sourceImage, const std::string& name, const enum VkTsMipmapFilter filter = VKTS_MIPMAP_FILTER_BOX, const enum VkTsImageDataType imageDataType = VKTS_NON_COLOR_DATA);
 
 /**
  *
  * @ThreadSafe
+ *
+ * The source is an equirectangular image. All rows of all six sides are sampled in parallel.
  */
 VKTS_APICALL SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataCubemap(const IImageDataSP& sourceImage, const uint32_t length, const std::string& name);
 
 /**
  *
  * @ThreadSafe
+ *
+ * Same as imageDataCubemap, but the six sides and all their mip levels are stored in one image data of the given format.
+ * VK_FORMAT_UNDEFINED keeps the source format. The source is read only once and the result can be passed to the prefilter functions.
+ * Like in imageDataMipmap, the mip levels of LDR color data are filtered in linear space.
+ */
+VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataCubemapChain(const IImageDataSP& sourceImage, const uint32_t length, const std::string& name, const VkFormat targetFormat = VK_FORMAT_UNDEFINED, const enum VkTsMipmapFilter filter = VKTS_MIPMAP_FILTER_BOX, const enum VkTsImageDataType imageDataType = VKTS_NON_COLOR_DATA);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * The prefilter functions and imageDataEnvironmentBRDF run on all threads of parallelFor. The result does not depend on the number of threads.
+ * If the source cube map has mip levels, each sample is fetched from the mip level matching its solid angle, so fewer samples are needed.
  */
 VKTS_APICALL SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterCookTorrance(const IImageDataSP& sourceImage, const uint32_t samples, const std::string& name);
 
@@ -194,6 +220,32 @@ VKTS_APICALL SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterLa
  */
 VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataEnvironmentBRDF(const uint32_t length, const uint32_t samples, const std::string& name);
 
+/**
+ * Only formats, which can be created by imageDataEncode, are returned as true.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY imageDataIsEncodable(const VkFormat format);
+
+/**
+ * Returns the format imageDataEncode creates for the given source and requested format.
+ * SRGB sources get the SRGB variant of BC1, BC3 and BC7, otherwise the UNORM variant is used.
+ * VK_FORMAT_UNDEFINED is returned, if the source can not be encoded to the requested format.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkFormat VKTS_APIENTRY imageDataGetEncodeFormat(const VkFormat sourceFormat, const VkFormat requestedFormat);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Encodes all mip levels and array layers to BC1, BC3, BC4, BC5, BC6H unsigned or BC7. Blocks are encoded in parallel.
+ * The target format is selected by imageDataGetEncodeFormat, so SRGB sources stay non-linear and are stored in a SRGB block format.
+ * If the cache is enabled, the result is loaded from and stored to it.
+ */
+VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataEncode(const IImageDataSP& sourceImage, const VkFormat requestedFormat, const std::string& name, const enum VkTsEncodeQuality quality = VKTS_ENCODE_QUALITY_NORMAL);
+
 }
 
 #endif /* VKTS_FN_IMAGE_DATA_HPP_ */
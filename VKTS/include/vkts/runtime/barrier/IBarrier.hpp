@@ -0,0 +1,97 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_IBARRIER_HPP_
+#define VKTS_IBARRIER_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Reusable barrier for a fixed group of threads.
+ *
+ * Timing values are in seconds and refer to the last completed barrier generation.
+ */
+class IBarrier
+{
+
+public:
+
+    IBarrier()
+    {
+    }
+
+    virtual ~IBarrier()
+    {
+    }
+
+    /**
+     *
+     * @ThreadSafe
+     *
+     * Blocks until all threads of the group did arrive. Returns VK_FALSE, if the barrier was killed.
+     * The thread index is only used for the timing. Pass -1, if no timing is needed.
+     */
+    virtual VkBool32 sync(const int32_t threadIndex = -1) = 0;
+
+    /**
+     *
+     * @ThreadSafe
+     *
+     * Releases all waiting threads. All following sync calls fail.
+     */
+    virtual void kill() = 0;
+
+    virtual VkBool32 isKilled() const = 0;
+
+    virtual int32_t getThreadCount() const = 0;
+
+    virtual uint64_t getGeneration() const = 0;
+
+    /**
+     * Index of the thread, which did arrive last. -1, if unknown.
+     */
+    virtual int32_t getLastArrivedThreadIndex() const = 0;
+
+    /**
+     * Time between the arrival of the first thread and the given thread.
+     */
+    virtual double getArrivalSkew(const int32_t threadIndex) const = 0;
+
+    /**
+     * Time the given thread did wait in the barrier.
+     */
+    virtual double getWaitTime(const int32_t threadIndex) const = 0;
+
+};
+
+typedef std::shared_ptr<IBarrier> IBarrierSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_IBARRIER_HPP_ */
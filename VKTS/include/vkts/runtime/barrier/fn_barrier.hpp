@@ -34,9 +34,26 @@ namespace vkts
 
 /**
  * Not thread Safe.
+ *
+ * Creates the engine barrier for the current number of update threads.
  */
 VKTS_APICALL VkBool32 VKTS_APIENTRY barrierInit();
 
+/**
+ *
+ * @ThreadSafe
+ *
+ * Creates a barrier for a group of threads. The calling thread spins up to spinCount times before it is parked.
+ */
+VKTS_APICALL IBarrierSP VKTS_APIENTRY barrierCreate(const int32_t threadCount, const uint32_t spinCount = VKTS_BARRIER_SPIN_COUNT);
+
+/**
+ * Not thread Safe.
+ *
+ * Engine barrier used by barrierSync(). The thread index is the update thread index.
+ */
+VKTS_APICALL IBarrierSP VKTS_APIENTRY barrierGet();
+
 /**
  *
  * @ThreadSafe
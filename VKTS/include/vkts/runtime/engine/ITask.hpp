@@ -36,6 +36,7 @@ class ITask
 {
 
     friend class TaskExecutor;
+    friend class TaskGraph;
 
 private:
 
@@ -0,0 +1,91 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_ITASKGRAPH_HPP_
+#define VKTS_ITASKGRAPH_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Directed acyclic graph of tasks. A task is executed as soon as all its dependencies are executed.
+ * The graph can be sent once per frame. The nodes are kept, so no reallocation is needed for the next frame.
+ */
+class ITaskGraph
+{
+
+public:
+
+    ITaskGraph()
+    {
+    }
+
+    virtual ~ITaskGraph()
+    {
+    }
+
+    /**
+     * Returns the index of the added task or -1, if the graph is executing.
+     */
+    virtual int32_t addTask(const ITaskSP& task) = 0;
+
+    /**
+     * Task at afterIndex is executed after the task at beforeIndex.
+     */
+    virtual VkBool32 addDependency(const int32_t beforeIndex, const int32_t afterIndex) = 0;
+
+    /**
+     * Task sent as a regular task after all tasks of the graph are executed.
+     * It can be received by IUpdateThreadContext::receiveExecutedTask().
+     */
+    virtual VkBool32 setContinuation(const ITaskSP& continuation) = 0;
+
+    virtual uint32_t getNumberTasks() const = 0;
+
+    virtual const ITaskSP& getTask(const uint32_t index) const = 0;
+
+    virtual VkBool32 clear() = 0;
+
+    /**
+     * Thread safe.
+     */
+    virtual VkBool32 isFinished() const = 0;
+
+    /**
+     * Thread safe. Blocks until all tasks are executed.
+     * Returns VK_FALSE, if a task failed. Tasks, which did not start before the failure, are not executed.
+     */
+    virtual VkBool32 wait() const = 0;
+
+};
+
+typedef std::shared_ptr<ITaskGraph> ITaskGraphSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_ITASKGRAPH_HPP_ */
@@ -67,18 +67,51 @@ public:
 
     virtual uint64_t getDeltaTicks() const = 0;
 
+    /**
+     * Fraction of the way from the last to the next tick, for interpolating the fixed step simulation.
+     */
+    virtual double getTickAlpha() const = 0;
+
+    //
+    // Frame pacing functions.
+    //
+
+    /**
+     * Current target time of one frame. Adaptive pacing changes it during runtime.
+     */
+    virtual double getFrameTime() const = 0;
+
+    /**
+     * Number of frames, which did miss their deadline.
+     */
+    virtual uint64_t getMissedFrames() const = 0;
+
     //
     // Task functions
     //
 
-    virtual VkBool32 sendTask(const ITaskSP& task) const = 0;
+    /**
+     * If too many tasks are pending, the wait mode decides, if the call blocks, fails or fails after the timeout in seconds.
+     */
+    virtual VkBool32 sendTask(const ITaskSP& task, const VkTsTaskWait wait = VKTS_TASK_WAIT_BLOCK, const double timeout = 0.0) const = 0;
 
     virtual VkBool32 receiveExecutedTask(ITaskSP& task, const VkBool32 wait = VK_TRUE) const = 0;
 
+    /**
+     * Executes the tasks of the graph in parallel. Tasks of the graph are not added to the executed tasks.
+     * Use ITaskGraph::wait() or the continuation task, to know when the graph is finished.
+     */
+    virtual VkBool32 sendTaskGraph(const ITaskGraphSP& taskGraph) const = 0;
+
     virtual void resetSendTasks() const = 0;
 
     virtual void resetExecutedTasks() const = 0;
 
+    /**
+     * Latency histograms of the send and of the executed tasks, accumulated since engine start.
+     */
+    virtual void getTaskLatency(VkTsTaskLatency& sendLatency, VkTsTaskLatency& executedLatency) const = 0;
+
 };
 
 // No smart pointer by purpose.
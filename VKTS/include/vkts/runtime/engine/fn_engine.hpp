@@ -49,6 +49,22 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY engineAddUpdateThread(const IUpdateThreadSP&
  */
 VKTS_APICALL VkBool32 VKTS_APIENTRY engineSetTicksPerSecond(const double ticksPerSecond);
 
+/**
+ * Not thread Safe.
+ *
+ * Paces the update loop of every update thread. Default is no pacing.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY engineSetFramePacing(const VkTsFramePacing framePacing, const double framesPerSecond = VKTS_FRAMES_PER_SECOND);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Time of the last present and the refresh interval of the display in seconds, as measured by timeGetRaw().
+ * Used by vsync and adaptive frame pacing.
+ */
+VKTS_APICALL void VKTS_APIENTRY engineSetVsyncTiming(const double presentTime, const double refreshInterval);
+
 /**
  * Not thread Safe.
  */
@@ -69,6 +85,14 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY engineSetTaskExecutorCount(const uint32_t co
  */
 VKTS_APICALL uint32_t VKTS_APIENTRY engineGetTaskExecutorCount();
 
+/**
+ * Latency histograms of the send and of the executed tasks of the current or last run.
+ * Returns VK_FALSE, if the engine did not run with task executors.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY engineGetTaskLatency(VkTsTaskLatency& sendLatency, VkTsTaskLatency& executedLatency);
+
 /**
  * Not thread Safe.
  */
@@ -52,10 +52,56 @@
 #define VKTS_TICKS_PER_SECOND_MIN 1.0
 #define VKTS_TICKS_PER_SECOND_MAX 480.0
 
+#define VKTS_FRAMES_PER_SECOND 60.0
+#define VKTS_FRAMES_PER_SECOND_MIN 1.0
+#define VKTS_FRAMES_PER_SECOND_MAX 480.0
+
+#define VKTS_FRAME_PACING_SPIN_TIME 0.002
+#define VKTS_FRAME_PACING_MAX_FRAME_MULTIPLIER 4.0
+#define VKTS_FRAME_PACING_HEADROOM 0.8
+#define VKTS_FRAME_PACING_ADAPT_FRAMES 30
+
+#define VKTS_BARRIER_SPIN_COUNT 1000
+
+#define VKTS_TASK_LATENCY_BUCKETS 16
+
+/**
+ * Types.
+ */
+
+typedef enum VkTsTaskWait_
+{
+    VKTS_TASK_WAIT_BLOCK = 0, VKTS_TASK_WAIT_TRY = 1, VKTS_TASK_WAIT_TIMEOUT = 2
+} VkTsTaskWait;
+
+/**
+ * None spins as fast as possible, fixed waits for the frame rate, vsync aligns the frame rate to the display refresh and
+ * adaptive drops to an integer fraction of the frame rate, as long as the frames do not fit.
+ */
+typedef enum VkTsFramePacing_
+{
+    VKTS_FRAME_PACING_NONE = 0, VKTS_FRAME_PACING_FIXED = 1, VKTS_FRAME_PACING_VSYNC = 2, VKTS_FRAME_PACING_ADAPTIVE = 3
+} VkTsFramePacing;
+
+/**
+ * Time in seconds between sending and receiving a task.
+ * Bucket 0 counts latencies below one microsecond, bucket n latencies below 2^n microseconds.
+ * The last bucket counts all remaining latencies.
+ */
+typedef struct VkTsTaskLatency_
+{
+    uint64_t count;
+    double total;
+    double maximum;
+    uint64_t buckets[VKTS_TASK_LATENCY_BUCKETS];
+} VkTsTaskLatency;
+
 /**
  * Barrier.
  */
 
+#include <vkts/runtime/barrier/IBarrier.hpp>
+
 #include <vkts/runtime/barrier/fn_barrier.hpp>
 
 /**
@@ -63,9 +109,11 @@
  */
 
 #include <vkts/runtime/engine/ITask.hpp>
+#include <vkts/runtime/engine/ITaskGraph.hpp>
 #include <vkts/runtime/engine/IUpdateThreadContext.hpp>
 #include <vkts/runtime/engine/IUpdateThread.hpp>
 
 #include <vkts/runtime/engine/fn_engine.hpp>
+#include <vkts/runtime/engine/fn_task_graph.hpp>
 
 #endif /* VKTS_RUNTIME_HPP_ */
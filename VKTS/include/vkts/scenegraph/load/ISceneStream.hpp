@@ -0,0 +1,114 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_ISCENESTREAM_HPP_
+#define VKTS_ISCENESTREAM_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+/**
+ * Change of the scene, which is recorded by the loading thread and executed by the render thread.
+ */
+typedef std::function<void(const ISceneSP& scene)> SceneStreamFunction;
+
+/**
+ * Prepares the write descriptor sets of the given buffer, e.g. the uniform buffers of the application.
+ */
+typedef std::function<VkBool32(const uint32_t currentBuffer)> SceneStreamDescriptorSetsFunction;
+
+class ISceneStream: public IDestroyable
+{
+
+public:
+
+    ISceneStream() :
+        IDestroyable()
+    {
+    }
+
+    virtual ~ISceneStream()
+    {
+    }
+
+    //
+    // Render thread.
+    //
+
+    /**
+     * Empty, until the loading thread has started.
+     */
+    virtual ISceneSP getScene() const = 0;
+
+    /**
+     * Executes the published changes. Returns VK_TRUE, if the scene changed. Command buffers of the scene have to be
+     * rebuilt afterwards, as objects were added or textures were replaced. The device must not use the descriptor sets
+     * of the scene during the update.
+     * Has to be called once per frame. Replaced objects are released after the given number of retire frames, as
+     * command buffers still in flight can use them.
+     */
+    virtual VkBool32 update() = 0;
+
+    /**
+     * Sets, how the descriptor sets of added objects and of objects with replaced textures are written during update.
+     * Without it, the application has to write the descriptor sets of the scene after each change.
+     */
+    virtual void setDescriptorSets(const uint32_t bufferCount, const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const SceneStreamDescriptorSetsFunction& function) = 0;
+
+    /**
+     * Writes the descriptor sets of the object for all buffers. Called by the published changes.
+     */
+    virtual VkBool32 updateDescriptorSets(const IObjectSP& object) = 0;
+
+    /**
+     * VK_TRUE, if loading has ended and all changes were executed.
+     */
+    virtual VkBool32 isFinished() const = 0;
+
+    virtual VkBool32 isLoaded() const = 0;
+
+    //
+    // Loading thread.
+    //
+
+    virtual void setScene(const ISceneSP& scene) = 0;
+
+    /**
+     * Objects captured by the function are kept alive until the function is retired.
+     */
+    virtual void publish(const SceneStreamFunction& function) = 0;
+
+    virtual void finish(const VkBool32 loaded) = 0;
+
+};
+
+typedef std::shared_ptr<ISceneStream> ISceneStreamSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_ISCENESTREAM_HPP_ */
@@ -35,8 +35,35 @@ namespace vkts
 /**
  *
  * @ThreadSafe
+ *
+ * If parallel is set, images are decoded and sub meshes are parsed on all threads in advance. The Vulkan objects
+ * are still created on the calling thread in the same order as without it. Set by default.
+ */
+VKTS_APICALL ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory = VK_FALSE, const VkBool32 parallel = VK_TRUE);
+
+/**
+ * Has to submit the recorded commands of the scene manager and wait for them, before a new recording is started.
+ */
+typedef std::function<VkBool32()> SceneStreamFlushFunction;
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Loads like sceneLoad, but publishes the scene to the stream. Each object is published, as soon as the meshes of its
+ * nodes are uploaded, while its textures still sample a 1x1 placeholder. Afterwards, the images are uploaded from the smallest
+ * to the largest mip level and replace the placeholders. Before anything is published, flush is called.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY sceneLoadStreaming(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ISceneStreamSP& sceneStream, const SceneStreamFlushFunction& flush, const VkBool32 freeHostMemory = VK_FALSE, const VkBool32 parallel = VK_TRUE);
+
+/**
+ *
+ * @ThreadSafe
+ *
+ * Converts the sub mesh libraries referenced by the scene into binary files, which are stored next to the text files
+ * with the suffix ".bin". As long as the text is unchanged, sceneLoad uses the binary files instead.
  */
-VKTS_APICALL ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory = VK_FALSE);
+VKTS_APICALL VkBool32 VKTS_APIENTRY sceneSaveBinary(const char* filename);
 
 }
 
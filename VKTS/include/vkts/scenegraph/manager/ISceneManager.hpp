@@ -32,6 +32,9 @@
 namespace vkts
 {
 
+/**
+ * Can be used and filled from several threads e.g. by a parallel scene load. So the getAll functions return a copy.
+ */
 class ISceneManager: public IDestroyable
 {
 
@@ -60,7 +63,7 @@ public:
 
     virtual VkBool32 removeObject(const IObjectSP& object) = 0;
 
-    virtual const SmartPointerMap<std::string, IObjectSP>& getAllObjects() const = 0;
+    virtual SmartPointerMap<std::string, IObjectSP> getAllObjects() const = 0;
 
     //
 
@@ -70,7 +73,7 @@ public:
 
     virtual VkBool32 removeCamera(const ICameraSP& camera) = 0;
 
-    virtual const SmartPointerMap<std::string, ICameraSP>& getAllCameras() const = 0;
+    virtual SmartPointerMap<std::string, ICameraSP> getAllCameras() const = 0;
 
     //
 
@@ -80,7 +83,7 @@ public:
 
     virtual VkBool32 removeLight(const ILightSP& light) = 0;
 
-    virtual const SmartPointerMap<std::string, ILightSP>& getAllLights() const = 0;
+    virtual SmartPointerMap<std::string, ILightSP> getAllLights() const = 0;
 
     //
 
@@ -90,7 +93,7 @@ public:
 
     virtual VkBool32 removeParticleSystem(const IParticleSystemSP& particleSystem) = 0;
 
-    virtual const SmartPointerMap<std::string, IParticleSystemSP>& getAllParticleSystems() const = 0;
+    virtual SmartPointerMap<std::string, IParticleSystemSP> getAllParticleSystems() const = 0;
 
     //
 
@@ -169,7 +172,7 @@ public:
 
     virtual VkBool32 removeImageData(const IImageDataSP& imageData) = 0;
 
-    virtual const SmartPointerMap<std::string, IImageDataSP>& getAllImageDatas() const = 0;
+    virtual SmartPointerMap<std::string, IImageDataSP> getAllImageDatas() const = 0;
 
     //
 
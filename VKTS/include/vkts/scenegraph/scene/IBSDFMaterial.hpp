@@ -72,6 +72,11 @@ public:
 
     virtual VkBool32 removeTextureObject(const ITextureObjectSP& textureObject) = 0;
 
+    /**
+     * Keeps the binding of the old texture object. The descriptor sets have to be updated afterwards.
+     */
+    virtual VkBool32 replaceTextureObject(const ITextureObjectSP& oldTextureObject, const ITextureObjectSP& newTextureObject) = 0;
+
     virtual uint32_t getNumberTextureObjects() const = 0;
 
     virtual const SmartPointerVector<ITextureObjectSP>& getTextureObjects() const = 0;
@@ -52,6 +52,8 @@
 #define VKTS_SHADER_DIRECTORY "shader/SPIR/V/"
 #define VKTS_TEXTURE_DIRECTORY "texture/"
 
+#define VKTS_SCENE_STREAM_RETIRE_FRAMES 3
+
 /**
  * Types.
  */
@@ -158,6 +160,10 @@ typedef enum VkTsInterpolator_
  * Scene load.
  */
 
+#include <vkts/scenegraph/load/ISceneStream.hpp>
+
+#include <vkts/scenegraph/load/fn_scene_stream.hpp>
+
 #include <vkts/scenegraph/load/fn_gltf_load.hpp>
 #include <vkts/scenegraph/load/fn_scene_load.hpp>
 
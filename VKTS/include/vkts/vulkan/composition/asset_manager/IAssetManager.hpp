@@ -84,7 +84,10 @@ public:
 
     virtual VkBool32 removeImageData(const IImageDataSP& imageData) = 0;
 
-    virtual const SmartPointerMap<std::string, IImageDataSP>& getAllImageDatas() const = 0;
+    /**
+     * Returns a copy, as image data can be added from other threads meanwhile.
+     */
+    virtual SmartPointerMap<std::string, IImageDataSP> getAllImageDatas() const = 0;
 
     //
 
@@ -32,10 +32,20 @@
 namespace vkts
 {
 
-VKTS_APICALL IImageDataSP VKTS_APIENTRY createDeviceImageData(const IAssetManagerSP& assetManager, IImageDataSP& imageData);
+/**
+ * Converts the image data to a format the device supports. If an encode format is given and the device supports its block
+ * format, the image data is encoded by imageDataEncode. SRGB image data is encoded to the SRGB variant of the format.
+ */
+VKTS_APICALL IImageDataSP VKTS_APIENTRY createDeviceImageData(const IAssetManagerSP& assetManager, IImageDataSP& imageData, const VkFormat encodeFormat = VK_FORMAT_UNDEFINED);
 
 VKTS_APICALL IImageObjectSP VKTS_APIENTRY createImageObject(const IAssetManagerSP& assetManager, const std::string& imageObjectName, const IImageDataSP& imageData, const VkBool32 environment);
 
+/**
+ * Uploads one mip level. Without a previous image object, an image with all mip levels is created. Otherwise, its image is
+ * reused, which holds the smaller mip levels. The returned image object only views the uploaded mip levels.
+ */
+VKTS_APICALL IImageObjectSP VKTS_APIENTRY createImageObject(const IAssetManagerSP& assetManager, const std::string& imageObjectName, const IImageDataSP& imageData, const IImageObjectSP& previousImageObject, const uint32_t mipLevel);
+
 VKTS_APICALL ITextureObjectSP VKTS_APIENTRY createTextureObject(const IAssetManagerSP& assetManager, const std::string& textureObjectName, const VkBool32 mipmap, const VkFilter filter, const VkSamplerAddressMode samplerAddressMode, const IImageObjectSP& imageObject);
 
 VKTS_APICALL ITextureObjectSP VKTS_APIENTRY createTextureObject(const IAssetManagerSP& assetManager, const glm::vec4& color, const VkFormat format);
@@ -48,6 +58,13 @@ VKTS_APICALL IBufferObjectSP VKTS_APIENTRY createVertexBufferObject(const IAsset
 
 VKTS_APICALL IShaderModuleSP VKTS_APIENTRY createShaderModule(const IAssetManagerSP& assetManager, const std::string& shaderModuleName, const IBinaryBufferSP& binaryBuffer);
 
+/**
+ * Creates the pipeline cache with the data saved by a previous run, if it is in the cache and matches the device.
+ */
+VKTS_APICALL IPipelineCacheSP VKTS_APIENTRY createPipelineCache(const IContextObjectSP& contextObject, const std::string& pipelineCacheName);
+
+VKTS_APICALL VkBool32 VKTS_APIENTRY savePipelineCache(const IContextObjectSP& contextObject, const std::string& pipelineCacheName, const IPipelineCacheSP& pipelineCache);
+
 }
 
 #endif /* VKTS_FN_CREATE_OBJECT_HPP_ */
@@ -44,6 +44,20 @@ VKTS_APICALL IImageObjectSP VKTS_APIENTRY imageObjectCreate(IImageSP& stageImage
  */
 VKTS_APICALL IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const std::string& name, const VkImageCreateInfo& imageCreateInfo, const VkAccessFlags srcAccessMask, const VkAccessFlags dstAccessMask, const VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange, const VkMemoryPropertyFlags memoryPropertyFlags);
 
+/**
+ * Views the given subresource range of an existing image.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IContextObjectSP& contextObject, const std::string& name, const IImageDataSP& imageData, const IImageSP& image, const IDeviceMemorySP& deviceMemory, const VkImageSubresourceRange& subresourceRange);
+
+/**
+ * Uploads one mip level of all array layers. Other mip levels of the image are not accessed.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY imageObjectUploadMipLevel(IBufferSP& stageBuffer, IDeviceMemorySP& stageDeviceMemory, const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const IImageSP& image, const IDeviceMemorySP& deviceMemory, const IImageDataSP& imageData, const uint32_t mipLevel);
+
 
 /**
  *
@@ -58,6 +58,11 @@ public:
 
     virtual const VkPipelineCache getPipelineCache() const = 0;
 
+    /**
+     * Retrieves the current content, e.g. for saving it until the next start.
+     */
+    virtual IBinaryBufferSP getData() const = 0;
+
 };
 
 typedef std::shared_ptr<IPipelineCache> IPipelineCacheSP;
@@ -83,6 +83,10 @@ static void terminateApp()
 		contextObject.reset();
 	}
 
+	// Usage of cached assets is only written at the end.
+
+	vkts::cacheFlush();
+
 	//
 
 	vkts::engineTerminate();
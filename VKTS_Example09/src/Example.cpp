@@ -27,7 +27,7 @@
 #include "Example.hpp"
 
 Example::Example(const vkts::IContextObjectSP& contextObject, const int32_t windowIndex, const vkts::IVisualContextSP& visualContext, const vkts::ISurfaceSP& surface) :
-		IUpdateThread(), contextObject(contextObject), windowIndex(windowIndex), visualContext(visualContext), surface(surface), depthFormat(VK_FORMAT_D32_SFLOAT), camera(nullptr), inputController(nullptr), allUpdateables(), commandPool(nullptr), imageAcquiredSemaphore(nullptr), betweenSemaphore(nullptr), renderingCompleteSemaphore(nullptr), descriptorSetLayout(nullptr), vertexViewProjectionUniformBuffer(nullptr), fragmentUniformBuffer(nullptr), shadowUniformBuffer(nullptr), skinningVertexShaderModule(nullptr), skinningFragmentShaderModule(nullptr), skinningShadowFragmentShaderModule(nullptr), standardVertexShaderModule(nullptr), standardFragmentShaderModule(nullptr), standardShadowFragmentShaderModule(nullptr), pipelineLayout(nullptr), loadTask(), sceneLoaded(VK_FALSE), sceneManager(nullptr), sceneFactory(nullptr), scene(nullptr), swapchain(nullptr), renderPass(nullptr), shadowRenderPass(nullptr), allOpaqueGraphicsPipelines(), allBlendGraphicsPipelines(), allBlendCwGraphicsPipelines(), allShadowGraphicsPipelines(), shadowTexture(), msaaColorTexture(nullptr), msaaDepthTexture(nullptr), depthTexture(nullptr), shadowImageView(), msaaColorImageView(nullptr), msaaDepthStencilImageView(nullptr), depthStencilImageView(nullptr), shadowSampler(nullptr), swapchainImagesCount(0), swapchainImageView(), framebuffer(), shadowFramebuffer(), cmdBuffer(), shadowCmdBuffer(), cmdBufferFence()
+		IUpdateThread(), contextObject(contextObject), windowIndex(windowIndex), visualContext(visualContext), surface(surface), depthFormat(VK_FORMAT_D32_SFLOAT), camera(nullptr), inputController(nullptr), allUpdateables(), commandPool(nullptr), imageAcquiredSemaphore(nullptr), betweenSemaphore(nullptr), renderingCompleteSemaphore(nullptr), descriptorSetLayout(nullptr), vertexViewProjectionUniformBuffer(nullptr), fragmentUniformBuffer(nullptr), shadowUniformBuffer(nullptr), skinningVertexShaderModule(nullptr), skinningFragmentShaderModule(nullptr), skinningShadowFragmentShaderModule(nullptr), standardVertexShaderModule(nullptr), standardFragmentShaderModule(nullptr), standardShadowFragmentShaderModule(nullptr), pipelineLayout(nullptr), loadTask(), sceneStream(), queueMutex(), sceneLoaded(VK_FALSE), sceneManager(nullptr), sceneFactory(nullptr), scene(nullptr), swapchain(nullptr), renderPass(nullptr), shadowRenderPass(nullptr), allOpaqueGraphicsPipelines(), allBlendGraphicsPipelines(), allBlendCwGraphicsPipelines(), allShadowGraphicsPipelines(), shadowTexture(), msaaColorTexture(nullptr), msaaDepthTexture(nullptr), depthTexture(nullptr), shadowImageView(), msaaColorImageView(nullptr), msaaDepthStencilImageView(nullptr), depthStencilImageView(nullptr), shadowSampler(nullptr), swapchainImagesCount(0), swapchainImageView(), framebuffer(), shadowFramebuffer(), cmdBuffer(), shadowCmdBuffer(), cmdBufferFence()
 {
 }
 
@@ -1583,22 +1583,26 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
 	submitInfo.signalSemaphoreCount = 0;
 	submitInfo.pSignalSemaphores = nullptr;
 
-	result = contextObject->getQueue()->submit(1, &submitInfo, VK_NULL_HANDLE);
-
-	if (result != VK_SUCCESS)
 	{
-		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
+		std::lock_guard<std::mutex> queueLockGuard(queueMutex);
 
-		return VK_FALSE;
-	}
+		result = contextObject->getQueue()->submit(1, &submitInfo, VK_NULL_HANDLE);
 
-	result = contextObject->getQueue()->waitIdle();
+		if (result != VK_SUCCESS)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
 
-	if (result != VK_SUCCESS)
-	{
-		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for idle queue.");
+			return VK_FALSE;
+		}
 
-		return VK_FALSE;
+		result = contextObject->getQueue()->waitIdle();
+
+		if (result != VK_SUCCESS)
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for idle queue.");
+
+			return VK_FALSE;
+		}
 	}
 
 	updateCmdBuffer->destroy();
@@ -1650,6 +1654,9 @@ VkBool32 Example::buildResources(const vkts::IUpdateThreadContext& updateContext
 				scene->updateDescriptorSetsRecursive(VKTS_DESCRIPTOR_SET_COUNT, writeDescriptorSets, i);
 			}
 		}
+
+		// The number of swapchain images can change.
+		sceneStream->setDescriptorSets(swapchainImagesCount, VKTS_DESCRIPTOR_SET_COUNT, writeDescriptorSets, [this](const uint32_t currentBuffer) { return updateDescriptorSets((int32_t)currentBuffer); });
 	}
 
 	for (int32_t i = 0; i < (int32_t)swapchainImagesCount; i++)
@@ -1682,7 +1689,11 @@ void Example::terminateResources(const vkts::IUpdateThreadContext& updateContext
 	{
 		if (contextObject->getDevice().get())
 		{
-			contextObject->getDevice()->waitIdle();
+			{
+				std::lock_guard<std::mutex> queueLockGuard(queueMutex);
+
+				contextObject->getDevice()->waitIdle();
+			}
 
 			for (int32_t i = 0; i < (int32_t)swapchainImagesCount; i++)
 			{
@@ -1924,7 +1935,16 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	loadTask = ILoadTaskSP(new LoadTask(contextObject, descriptorSetLayout, renderFactory, sceneManager, sceneFactory, scene));
+	sceneStream = vkts::sceneStreamCreate();
+
+	if (!sceneStream.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create scene stream.");
+
+		return VK_FALSE;
+	}
+
+	loadTask = ILoadTaskSP(new LoadTask(contextObject, descriptorSetLayout, renderFactory, sceneManager, sceneFactory, sceneStream, queueMutex));
 
 	if (!loadTask.get())
 	{
@@ -1957,8 +1977,116 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 //
 VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 {
+	vkts::ITaskSP executedTask;
+
+	// Do not wait. Received before the scene is queried, so a finished load task has always set it.
+	if (loadTask.get())
+	{
+		updateContext.receiveExecutedTask(executedTask, VK_FALSE);
+	}
+
+	if (!sceneLoaded)
+	{
+		scene = sceneStream->getScene();
+
+		if (scene.get())
+		{
+			vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Scene streaming");
+
+			sceneLoaded = VK_TRUE;
+
+			// Sorted by binding
+			dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION] = VkTsDynamicOffset{0, (uint32_t)contextObject->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(vkts::alignmentGetSizeInBytes(16 * sizeof(float) * 2, 16))};
+			dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_TRANSFORM] = VkTsDynamicOffset{0, (uint32_t)sceneFactory->getSceneRenderFactory()->getTransformUniformBufferAlignmentSize(sceneManager)};
+			dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_LIGHT] = VkTsDynamicOffset{0, (uint32_t)contextObject->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(vkts::alignmentGetSizeInBytes(3 * sizeof(float), 16))};
+			dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_BONE_TRANSFORM] = VkTsDynamicOffset{0, (uint32_t)sceneFactory->getSceneRenderFactory()->getJointsUniformBufferAlignmentSize(sceneManager)};
+			dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_SHADOW] = VkTsDynamicOffset{0, (uint32_t)contextObject->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(vkts::alignmentGetSizeInBytes(16 * sizeof(float), 16))};
+
+			dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION] = VkTsDynamicOffset{swapchainImagesCount * dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION].stride, dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION].stride};
+			dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_TRANSFORM] = dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_TRANSFORM];
+			dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_LIGHT] = dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_LIGHT];
+			dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_BONE_TRANSFORM]= dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_BONE_TRANSFORM];
+			dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_SHADOW]= dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_SHADOW];
+
+			// The stream writes the descriptor sets of added objects and replaced textures.
+			sceneStream->setDescriptorSets(swapchainImagesCount, VKTS_DESCRIPTOR_SET_COUNT, writeDescriptorSets, [this](const uint32_t currentBuffer) { return updateDescriptorSets((int32_t)currentBuffer); });
+
+			for (int32_t i = 0; i < (int32_t)swapchainImagesCount; i++)
+			{
+				if (!buildCmdBuffer(i))
+				{
+					return VK_FALSE;
+				}
+			}
+		}
+	}
+
+	if (executedTask.get())
+	{
+		if (!sceneStream->isLoaded())
+		{
+			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load scene.");
+
+			return VK_FALSE;
+		}
+
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Scene loaded");
+
+		//
+		// Free resources.
+		//
+
+		if (sceneFactory.get())
+		{
+			sceneFactory.reset();
+		}
+
+		if (sceneManager.get())
+		{
+			sceneManager->destroy();
+
+			sceneManager.reset();
+		}
+
+		if (renderFactory.get())
+		{
+			renderFactory.reset();
+		}
+
+		// Destroys the load task.
+		loadTask = ILoadTaskSP();
+	}
+
 	if (sceneLoaded)
 	{
+		if (!sceneStream->isFinished())
+		{
+			// The published changes write descriptor sets, so the device must not use them meanwhile.
+			{
+				std::lock_guard<std::mutex> queueLockGuard(queueMutex);
+
+				if (contextObject->getQueue()->waitIdle() != VK_SUCCESS)
+				{
+					vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for idle queue.");
+
+					return VK_FALSE;
+				}
+			}
+
+			if (sceneStream->update())
+			{
+				for (int32_t i = 0; i < (int32_t)swapchainImagesCount; i++)
+				{
+					if (!buildCmdBuffer(i))
+					{
+						return VK_FALSE;
+					}
+				}
+			}
+		}
+
+		//
+
 		for (uint32_t i = 0; i < allUpdateables.size(); i++)
 		{
 			allUpdateables[i]->update(updateContext.getDeltaTime(), updateContext.getDeltaTicks(), updateContext.getTickTime());
@@ -2069,6 +2197,9 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 			submitInfo.signalSemaphoreCount = 1;
 			submitInfo.pSignalSemaphores = &signalSemaphores;
 
+			// Submitting and presenting until the end of the frame.
+			std::unique_lock<std::mutex> queueUniqueLock(queueMutex);
+
 			// Added fence for later waiting.
 			result = contextObject->getQueue()->submit(1, &submitInfo, VK_NULL_HANDLE);
 
@@ -2153,6 +2284,8 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 
 			result = swapchain->queuePresent(contextObject->getQueue()->getQueue(), 1, &waitSemaphores, 1, &swapchains, &currentBuffer, nullptr);
 
+			queueUniqueLock.unlock();
+
 			if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
 			{
 				// Do nothing, as everything is buffered and synchronized.
@@ -2199,119 +2332,6 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 			}
 		}
 	}
-	else
-	{
-		vkts::ITaskSP executedTask;
-
-		// Do not wait.
-		if (!updateContext.receiveExecutedTask(executedTask, VK_FALSE))
-		{
-			return VK_TRUE;
-		}
-
-		//
-
-		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Scene loaded");
-
-		sceneLoaded = VK_TRUE;
-
-		//
-
-		VkCommandBuffer updateCommandBuffer = loadTask->getCommandBuffer();
-
-		//
-
-		VkSubmitInfo submitInfo{};
-
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-
-		submitInfo.waitSemaphoreCount = 0;
-		submitInfo.pWaitSemaphores = nullptr;
-		submitInfo.commandBufferCount = 1;
-		submitInfo.pCommandBuffers = &updateCommandBuffer;
-		submitInfo.signalSemaphoreCount = 0;
-		submitInfo.pSignalSemaphores = nullptr;
-
-		auto result = contextObject->getQueue()->submit(1, &submitInfo, VK_NULL_HANDLE);
-
-		if (result != VK_SUCCESS)
-		{
-			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
-
-			return VK_FALSE;
-		}
-
-		result = contextObject->getQueue()->waitIdle();
-
-		if (result != VK_SUCCESS)
-		{
-			vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for idle queue.");
-
-			return VK_FALSE;
-		}
-
-		//
-
-		// Sorted by binding
-		dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION] = VkTsDynamicOffset{0, (uint32_t)contextObject->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(vkts::alignmentGetSizeInBytes(16 * sizeof(float) * 2, 16))};
-		dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_TRANSFORM] = VkTsDynamicOffset{0, (uint32_t)sceneFactory->getSceneRenderFactory()->getTransformUniformBufferAlignmentSize(sceneManager)};
-		dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_LIGHT] = VkTsDynamicOffset{0, (uint32_t)contextObject->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(vkts::alignmentGetSizeInBytes(3 * sizeof(float), 16))};
-		dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_BONE_TRANSFORM] = VkTsDynamicOffset{0, (uint32_t)sceneFactory->getSceneRenderFactory()->getJointsUniformBufferAlignmentSize(sceneManager)};
-		dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_SHADOW] = VkTsDynamicOffset{0, (uint32_t)contextObject->getPhysicalDevice()->getUniformBufferAlignmentSizeInBytes(vkts::alignmentGetSizeInBytes(16 * sizeof(float), 16))};
-
-		dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION] = VkTsDynamicOffset{swapchainImagesCount * dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION].stride, dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_VIEWPROJECTION].stride};
-		dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_TRANSFORM] = dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_TRANSFORM];
-		dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_LIGHT] = dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_LIGHT];
-		dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_BONE_TRANSFORM]= dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_BONE_TRANSFORM];
-		dynamicOffsetsShadowPass[VKTS_BINDING_UNIFORM_BUFFER_SHADOW]= dynamicOffsetsColorPass[VKTS_BINDING_UNIFORM_BUFFER_SHADOW];
-
-		//
-		// Free resources.
-		//
-
-		if (sceneFactory.get())
-		{
-			sceneFactory.reset();
-		}
-
-		if (sceneManager.get())
-		{
-			sceneManager->destroy();
-
-			sceneManager.reset();
-		}
-
-		if (renderFactory.get())
-		{
-			renderFactory.reset();
-		}
-
-		// Destroys the load task.
-		loadTask = ILoadTaskSP();
-
-		//
-
-		if (scene.get())
-		{
-			for (uint32_t i = 0; i < swapchainImagesCount; i++)
-			{
-				if (!updateDescriptorSets(i))
-				{
-					return VK_FALSE;
-				}
-
-				scene->updateDescriptorSetsRecursive(VKTS_DESCRIPTOR_SET_COUNT, writeDescriptorSets, i);
-			}
-		}
-
-		for (int32_t i = 0; i < (int32_t)swapchainImagesCount; i++)
-		{
-			if (!buildCmdBuffer(i))
-			{
-				return VK_FALSE;
-			}
-		}
-	}
 
 	return VK_TRUE;
 }
@@ -2321,7 +2341,7 @@ VkBool32 Example::update(const vkts::IUpdateThreadContext& updateContext)
 //
 void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 {
-	if (loadTask.get() && !sceneLoaded)
+	if (loadTask.get())
 	{
 		vkts::ITaskSP executedTask;
 
@@ -2339,6 +2359,11 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 
 			//
 
+			if (sceneStream.get())
+			{
+				sceneStream->destroy();
+			}
+
 			if (sceneFactory.get())
 			{
 				sceneFactory.reset();
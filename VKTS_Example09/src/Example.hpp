@@ -108,6 +108,11 @@ private:
 
 	ILoadTaskSP loadTask;
 
+	vkts::ISceneStreamSP sceneStream;
+
+	// The load task submits its uploads to the same queue.
+	std::mutex queueMutex;
+
 	VkBool32 sceneLoaded;
 	vkts::ISceneRenderFactorySP renderFactory;
 	vkts::ISceneManagerSP sceneManager;
@@ -26,9 +26,77 @@
 
 #include "LoadTask.hpp"
 
+VkBool32 LoadTask::flush()
+{
+	auto result = cmdBuffer->endCommandBuffer();
+
+	if (result != VK_SUCCESS)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not end command buffer.");
+
+		return VK_FALSE;
+	}
+
+	VkSubmitInfo submitInfo{};
+
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+
+	submitInfo.waitSemaphoreCount = 0;
+	submitInfo.pWaitSemaphores = nullptr;
+	submitInfo.commandBufferCount = cmdBuffer->getCommandBufferCount();
+	submitInfo.pCommandBuffers = cmdBuffer->getCommandBuffers();
+	submitInfo.signalSemaphoreCount = 0;
+	submitInfo.pSignalSemaphores = nullptr;
+
+	{
+		std::lock_guard<std::mutex> queueLockGuard(queueMutex);
+
+		result = contextObject->getQueue()->submit(1, &submitInfo, fence->getFence());
+	}
+
+	if (result != VK_SUCCESS)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not submit queue.");
+
+		return VK_FALSE;
+	}
+
+	// Only waiting for the uploads, so the render thread can continue to submit.
+
+	result = fence->waitForFence(UINT64_MAX);
+
+	if (result != VK_SUCCESS)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not wait for fence.");
+
+		return VK_FALSE;
+	}
+
+	result = fence->reset();
+
+	if (result != VK_SUCCESS)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not reset fence.");
+
+		return VK_FALSE;
+	}
+
+	result = cmdBuffer->beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, VK_FALSE, 0, 0);
+
+	if (result != VK_SUCCESS)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not begin command buffer.");
+
+		return VK_FALSE;
+	}
+
+	return VK_TRUE;
+}
+
 VkBool32 LoadTask::execute()
 {
-	commandPool = vkts::commandPoolCreate(contextObject->getDevice()->getDevice(), 0, contextObject->getQueue()->getQueueFamilyIndex());
+	// The command buffer is recorded again after each flush.
+	commandPool = vkts::commandPoolCreate(contextObject->getDevice()->getDevice(), VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, contextObject->getQueue()->getQueueFamilyIndex());
 
 	if (!commandPool.get())
 	{
@@ -58,6 +126,18 @@ VkBool32 LoadTask::execute()
 
 		return VK_FALSE;
 	}
+
+	//
+
+	fence = vkts::fenceCreate(contextObject->getDevice()->getDevice(), 0);
+
+	if (!fence.get())
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create fence.");
+
+		return VK_FALSE;
+	}
+
 	//
 
 	auto result = cmdBuffer->beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, VK_FALSE, 0, 0);
@@ -108,9 +188,9 @@ VkBool32 LoadTask::execute()
 
 	//
 
-	scene = vkts::sceneLoad(VKTS_SCENE_NAME, sceneManager, sceneFactory, VK_TRUE);
+	// Objects appear, as soon as their meshes are uploaded. Textures are refined afterwards.
 
-	if (!scene.get())
+	if (!vkts::sceneLoadStreaming(VKTS_SCENE_NAME, sceneManager, sceneFactory, sceneStream, [this]() { return flush(); }, VK_TRUE))
 	{
 		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load scene.");
 
@@ -128,18 +208,21 @@ VkBool32 LoadTask::execute()
 		return VK_FALSE;
 	}
 
-	vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Number objects: %d", scene->getNumberObjects());
-
 	return VK_TRUE;
 }
 
-LoadTask::LoadTask(const vkts::IContextObjectSP& contextObject, const vkts::IDescriptorSetLayoutSP& descriptorSetLayout, vkts::ISceneRenderFactorySP& renderFactory, vkts::ISceneManagerSP& sceneManager, vkts::ISceneFactorySP& sceneFactory, vkts::ISceneSP& scene) :
-	ITask(0), contextObject(contextObject), descriptorSetLayout(descriptorSetLayout), renderFactory(renderFactory), sceneManager(sceneManager), sceneFactory(sceneFactory), scene(scene), commandPool(), cmdBuffer(), commandObject()
+LoadTask::LoadTask(const vkts::IContextObjectSP& contextObject, const vkts::IDescriptorSetLayoutSP& descriptorSetLayout, vkts::ISceneRenderFactorySP& renderFactory, vkts::ISceneManagerSP& sceneManager, vkts::ISceneFactorySP& sceneFactory, const vkts::ISceneStreamSP& sceneStream, std::mutex& queueMutex) :
+	ITask(0), contextObject(contextObject), descriptorSetLayout(descriptorSetLayout), renderFactory(renderFactory), sceneManager(sceneManager), sceneFactory(sceneFactory), sceneStream(sceneStream), queueMutex(queueMutex), commandPool(), cmdBuffer(), commandObject(), fence()
 {
 }
 
 LoadTask::~LoadTask()
 {
+	if (fence.get())
+	{
+		fence->destroy();
+	}
+
 	if (commandObject.get())
 	{
 		commandObject->destroy();
@@ -155,13 +238,3 @@ LoadTask::~LoadTask()
 		commandPool->destroy();
 	}
 }
-
-VkCommandBuffer LoadTask::getCommandBuffer() const
-{
-	if (cmdBuffer.get())
-	{
-		return cmdBuffer->getCommandBuffer();
-	}
-
-	return VK_NULL_HANDLE;
-}
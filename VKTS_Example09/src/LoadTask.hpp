@@ -46,11 +46,18 @@ private:
 	vkts::ISceneRenderFactorySP& renderFactory;
 	vkts::ISceneManagerSP& sceneManager;
 	vkts::ISceneFactorySP& sceneFactory;
-	vkts::ISceneSP& scene;
+
+	const vkts::ISceneStreamSP sceneStream;
+
+	// The queue is shared with the render thread.
+	std::mutex& queueMutex;
 
 	vkts::ICommandPoolSP commandPool;
 	vkts::ICommandBuffersSP cmdBuffer;
 	vkts::ICommandObjectSP commandObject;
+	vkts::IFenceSP fence;
+
+	VkBool32 flush();
 
 protected:
 
@@ -58,11 +65,9 @@ protected:
 
 public:
 
-	LoadTask(const vkts::IContextObjectSP& contextObject, const vkts::IDescriptorSetLayoutSP& descriptorSetLayout, vkts::ISceneRenderFactorySP& renderFactory, vkts::ISceneManagerSP& sceneManager, vkts::ISceneFactorySP& sceneFactory, vkts::ISceneSP& scene);
+	LoadTask(const vkts::IContextObjectSP& contextObject, const vkts::IDescriptorSetLayoutSP& descriptorSetLayout, vkts::ISceneRenderFactorySP& renderFactory, vkts::ISceneManagerSP& sceneManager, vkts::ISceneFactorySP& sceneFactory, const vkts::ISceneStreamSP& sceneStream, std::mutex& queueMutex);
 	virtual ~LoadTask();
 
-    VkCommandBuffer getCommandBuffer() const;
-
 };
 
 typedef std::shared_ptr<LoadTask> ILoadTaskSP;
@@ -83,6 +83,20 @@ static void terminateApp()
 		contextObject.reset();
 	}
 
+	// Usage of cached assets is only written at the end.
+
+	vkts::cacheFlush();
+
+	//
+
+	VkTsTaskLatency sendLatency;
+	VkTsTaskLatency executedLatency;
+
+	if (vkts::engineGetTaskLatency(sendLatency, executedLatency) && sendLatency.count > 0)
+	{
+		vkts::logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Task latency: %llu tasks, %f s average, %f s maximum", (unsigned long long)sendLatency.count, sendLatency.total / (double)sendLatency.count, sendLatency.maximum);
+	}
+
 	//
 
 	vkts::engineTerminate();
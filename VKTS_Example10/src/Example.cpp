@@ -1853,7 +1853,7 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+	pipelineCache = vkts::createPipelineCache(contextObject, "VKTS_Example10");
 
 	if (!pipelineCache.get())
 	{
@@ -2427,6 +2427,8 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 
 			if (pipelineCache.get())
 			{
+				vkts::savePipelineCache(contextObject, "VKTS_Example10", pipelineCache);
+
 				pipelineCache->destroy();
 			}
 
@@ -87,6 +87,10 @@ static void terminateApp()
 
 	vkts::profileTerminate();
 
+	// Usage of cached assets is only written at the end.
+
+	vkts::cacheFlush();
+
 	//
 
 	vkts::engineTerminate();
@@ -1370,7 +1370,7 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+	pipelineCache = vkts::createPipelineCache(contextObject, "VKTS_Example12");
 
 	if (!pipelineCache.get())
 	{
@@ -2109,6 +2109,8 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 
 			if (pipelineCache.get())
 			{
+				vkts::savePipelineCache(contextObject, "VKTS_Example12", pipelineCache);
+
 				pipelineCache->destroy();
 			}
 
@@ -1378,7 +1378,7 @@ VkBool32 Example::init(const vkts::IUpdateThreadContext& updateContext)
 
 	//
 
-	pipelineCache = vkts::pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+	pipelineCache = vkts::createPipelineCache(contextObject, "VKTS_Example13");
 
 	if (!pipelineCache.get())
 	{
@@ -2151,6 +2151,8 @@ void Example::terminate(const vkts::IUpdateThreadContext& updateContext)
 
 			if (pipelineCache.get())
 			{
+				vkts::savePipelineCache(contextObject, "VKTS_Example13", pipelineCache);
+
 				pipelineCache->destroy();
 			}
 
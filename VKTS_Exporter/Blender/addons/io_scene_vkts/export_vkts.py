@@ -476,6 +476,9 @@ def saveTextures(context, filepath, imagesLibraryName, materials, simplify):
                 fw_image("environment true\n")
             if nameOfImage in preFilteredImages:
                 fw_image("pre_filtered true\n")
+        # Mip maps of color images are filtered in linear space.
+        if not image.is_float and image.colorspace_settings.name == 'sRGB':
+            fw_image("color_data true\n")
         fw_image("image_data %s\n" % (nameOfImage + extension))
         fw_image("\n")
     
@@ -46,6 +46,11 @@ BinaryBuffer::BinaryBuffer(const uint8_t* data, const uint32_t size) :
 }
 
 BinaryBuffer::BinaryBuffer(const std::vector<uint8_t>& data) :
+	IBinaryBuffer(), data(data), pos(0)
+{
+}
+
+BinaryBuffer::BinaryBuffer(std::vector<uint8_t>&& data) :
 	IBinaryBuffer(), data(std::move(data)), pos(0)
 {
 }
@@ -91,9 +96,9 @@ const uint8_t* BinaryBuffer::getCurrentByteData() const
     return &data[pos];
 }
 
-uint32_t BinaryBuffer::getSize() const
+uint64_t BinaryBuffer::getSize() const
 {
-    return (uint32_t)data.size();
+    return (uint64_t)data.size();
 }
 
 VkBool32 BinaryBuffer::seek(const int64_t offset, const VkTsSearch search)
@@ -107,7 +112,7 @@ VkBool32 BinaryBuffer::seek(const int64_t offset, const VkTsSearch search)
                 return VK_FALSE;
             }
 
-            pos = static_cast<uint32_t>(offset);
+            pos = static_cast<uint64_t>(offset);
 
             return VK_TRUE;
         }
@@ -121,7 +126,7 @@ VkBool32 BinaryBuffer::seek(const int64_t offset, const VkTsSearch search)
                     return VK_FALSE;
                 }
 
-                pos -= static_cast<uint32_t>(-offset);
+                pos -= static_cast<uint64_t>(-offset);
             }
             else if (offset > 0)
             {
@@ -130,7 +135,7 @@ VkBool32 BinaryBuffer::seek(const int64_t offset, const VkTsSearch search)
                     return VK_FALSE;
                 }
 
-                pos += static_cast<uint32_t>(offset);
+                pos += static_cast<uint64_t>(offset);
             }
 
             return VK_TRUE;
@@ -153,15 +158,15 @@ uint32_t BinaryBuffer::read(void* ptr, const uint32_t sizeElement, const uint32_
         return 0;
     }
 
-    uint32_t bytesRead = sizeElement * countElement;
+    uint64_t bytesRead = (uint64_t)sizeElement * (uint64_t)countElement;
 
     bytesRead = glm::min(bytesRead, getSize() - pos);
 
-    uint32_t countElementRead = bytesRead / sizeElement;
+    uint32_t countElementRead = (uint32_t)(bytesRead / sizeElement);
 
-    bytesRead = sizeElement * countElementRead;
+    bytesRead = (uint64_t)sizeElement * (uint64_t)countElementRead;
 
-    memcpy(ptr, &data[pos], bytesRead);
+    memcpy(ptr, &data[pos], (size_t)bytesRead);
 
     pos += bytesRead;
 
@@ -175,25 +180,23 @@ uint32_t BinaryBuffer::write(const void* ptr, const uint32_t sizeElement, const
         return 0;
     }
 
-    uint32_t bytesWrite = sizeElement * countElement;
+    uint64_t bytesWrite = (uint64_t)sizeElement * (uint64_t)countElement;
 
     if (pos + bytesWrite > getSize())
     {
-        data.resize(pos + bytesWrite, 0);
+        data.resize((size_t)(pos + bytesWrite), 0);
     }
 
-    uint32_t countElementWrite = bytesWrite / sizeElement;
-
-    bytesWrite = sizeElement * countElementWrite;
+    uint32_t countElementWrite = countElement;
 
-    memcpy(&data[pos], ptr, bytesWrite);
+    memcpy(&data[pos], ptr, (size_t)bytesWrite);
 
     pos += bytesWrite;
 
     return countElementWrite;
 }
 
-VkBool32 BinaryBuffer::copy(void* data, const uint32_t dataSize) const
+VkBool32 BinaryBuffer::copy(void* data, const uint64_t dataSize) const
 {
     if (!data || !getData())
     {
@@ -205,11 +208,16 @@ VkBool32 BinaryBuffer::copy(void* data, const uint32_t dataSize) const
     	return VK_FALSE;
     }
 
-    memcpy(data, getData(), getSize());
+    memcpy(data, getData(), (size_t)getSize());
 
     return VK_TRUE;
 }
 
+VkBool32 BinaryBuffer::isReadOnly() const
+{
+    return VK_FALSE;
+}
+
 //
 // ICloneable
 //
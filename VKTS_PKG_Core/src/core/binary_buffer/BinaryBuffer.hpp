@@ -39,7 +39,7 @@ private:
 
     std::vector<uint8_t> data;
 
-    uint32_t pos;
+    uint64_t pos;
 
 public:
 
@@ -47,6 +47,7 @@ public:
     explicit BinaryBuffer(const uint32_t size);
     BinaryBuffer(const uint8_t* data, const uint32_t size);
     explicit BinaryBuffer(const std::vector<uint8_t>& data);
+    explicit BinaryBuffer(std::vector<uint8_t>&& data);
     BinaryBuffer(const BinaryBuffer& other) = delete;
     BinaryBuffer(BinaryBuffer&& other) = delete;
     virtual ~BinaryBuffer();
@@ -68,7 +69,7 @@ public:
 
     virtual const uint8_t* getCurrentByteData() const override;
 
-    virtual uint32_t getSize() const override;
+    virtual uint64_t getSize() const override;
 
     virtual VkBool32 seek(const int64_t offset, const VkTsSearch search) override;
 
@@ -76,7 +77,9 @@ public:
 
     virtual uint32_t write(const void* ptr, const uint32_t sizeElement, const uint32_t countElement) override;
 
-    virtual VkBool32 copy(void* data, const uint32_t dataSize) const override;
+    virtual VkBool32 copy(void* data, const uint64_t dataSize) const override;
+
+    virtual VkBool32 isReadOnly() const override;
 
     //
     // ICloneable
@@ -0,0 +1,199 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "MappedBinaryBuffer.hpp"
+
+namespace vkts
+{
+
+MappedBinaryBuffer::MappedBinaryBuffer(const std::shared_ptr<const uint8_t>& data, const uint64_t size) :
+    IBinaryBuffer(), data(data), size(data.get() ? size : 0), pos(0)
+{
+}
+
+MappedBinaryBuffer::~MappedBinaryBuffer()
+{
+    reset();
+}
+
+const std::shared_ptr<const uint8_t>& MappedBinaryBuffer::getSharedData() const
+{
+    return data;
+}
+
+//
+// IBinaryBuffer
+//
+
+void MappedBinaryBuffer::reset()
+{
+    data.reset();
+
+    size = 0;
+
+    pos = 0;
+}
+
+const void* MappedBinaryBuffer::getData() const
+{
+    return static_cast<const void*>(data.get());
+}
+
+const uint8_t* MappedBinaryBuffer::getByteData() const
+{
+    return data.get();
+}
+
+const void* MappedBinaryBuffer::getCurrentData() const
+{
+	return static_cast<const void*>(getCurrentByteData());
+}
+
+const uint8_t* MappedBinaryBuffer::getCurrentByteData() const
+{
+    if (pos >= size)
+    {
+        return nullptr;
+    }
+
+    return data.get() + pos;
+}
+
+uint64_t MappedBinaryBuffer::getSize() const
+{
+    return size;
+}
+
+VkBool32 MappedBinaryBuffer::seek(const int64_t offset, const VkTsSearch search)
+{
+    switch (search)
+    {
+        case VKTS_SEARCH_ABSOLUTE:
+        {
+            if (offset < 0 || offset > static_cast<int64_t>(size))
+            {
+                return VK_FALSE;
+            }
+
+            pos = static_cast<uint64_t>(offset);
+
+            return VK_TRUE;
+        }
+        break;
+        case VKTS_SEARCH_RELATVE:
+        {
+            if (offset < 0)
+            {
+                if (static_cast<int64_t>(pos) < -offset)
+                {
+                    return VK_FALSE;
+                }
+
+                pos -= static_cast<uint64_t>(-offset);
+            }
+            else if (offset > 0)
+            {
+                if (static_cast<int64_t>(size - pos) < offset)
+                {
+                    return VK_FALSE;
+                }
+
+                pos += static_cast<uint64_t>(offset);
+            }
+
+            return VK_TRUE;
+        }
+        break;
+    }
+
+    return VK_FALSE;
+}
+
+uint32_t MappedBinaryBuffer::read(void* ptr, const uint32_t sizeElement, const uint32_t countElement)
+{
+    if (!ptr || sizeElement == 0 || countElement == 0)
+    {
+        return 0;
+    }
+
+    if (pos >= size)
+    {
+        return 0;
+    }
+
+    uint64_t bytesRead = (uint64_t)sizeElement * (uint64_t)countElement;
+
+    bytesRead = glm::min(bytesRead, size - pos);
+
+    uint32_t countElementRead = (uint32_t)(bytesRead / sizeElement);
+
+    bytesRead = (uint64_t)sizeElement * (uint64_t)countElementRead;
+
+    memcpy(ptr, data.get() + pos, (size_t)bytesRead);
+
+    pos += bytesRead;
+
+    return countElementRead;
+}
+
+uint32_t MappedBinaryBuffer::write(const void* ptr, const uint32_t sizeElement, const uint32_t countElement)
+{
+    return 0;
+}
+
+VkBool32 MappedBinaryBuffer::copy(void* data, const uint64_t dataSize) const
+{
+    if (!data || !getData())
+    {
+        return VK_FALSE;
+    }
+
+    if (dataSize < size)
+    {
+    	return VK_FALSE;
+    }
+
+    memcpy(data, getData(), (size_t)size);
+
+    return VK_TRUE;
+}
+
+VkBool32 MappedBinaryBuffer::isReadOnly() const
+{
+    return VK_TRUE;
+}
+
+//
+// ICloneable
+//
+
+IBinaryBufferSP MappedBinaryBuffer::clone() const
+{
+    // Data is read only, so it can be shared.
+    return IBinaryBufferSP(new MappedBinaryBuffer(data, size));
+}
+
+} /* namespace vkts */
@@ -0,0 +1,99 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_MAPPEDBINARYBUFFER_HPP_
+#define VKTS_MAPPEDBINARYBUFFER_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * Read only buffer, e.g. a memory mapped file or a view into another buffer.
+ * The shared data does release the mapping, when the last buffer or view is gone.
+ */
+class MappedBinaryBuffer: public IBinaryBuffer
+{
+
+private:
+
+    std::shared_ptr<const uint8_t> data;
+
+    uint64_t size;
+
+    uint64_t pos;
+
+public:
+
+    MappedBinaryBuffer() = delete;
+    MappedBinaryBuffer(const std::shared_ptr<const uint8_t>& data, const uint64_t size);
+    MappedBinaryBuffer(const MappedBinaryBuffer& other) = delete;
+    MappedBinaryBuffer(MappedBinaryBuffer&& other) = delete;
+    virtual ~MappedBinaryBuffer();
+
+    MappedBinaryBuffer& operator =(const MappedBinaryBuffer& other) = delete;
+    MappedBinaryBuffer& operator =(MappedBinaryBuffer && other) = delete;
+
+    const std::shared_ptr<const uint8_t>& getSharedData() const;
+
+    //
+    // IBinaryBuffer
+    //
+
+    virtual void reset() override;
+
+    virtual const void* getData() const override;
+
+    virtual const uint8_t* getByteData() const override;
+
+    virtual const void* getCurrentData() const override;
+
+    virtual const uint8_t* getCurrentByteData() const override;
+
+    virtual uint64_t getSize() const override;
+
+    virtual VkBool32 seek(const int64_t offset, const VkTsSearch search) override;
+
+    virtual uint32_t read(void* ptr, const uint32_t sizeElement, const uint32_t countElement) override;
+
+    virtual uint32_t write(const void* ptr, const uint32_t sizeElement, const uint32_t countElement) override;
+
+    virtual VkBool32 copy(void* data, const uint64_t dataSize) const override;
+
+    virtual VkBool32 isReadOnly() const override;
+
+    //
+    // ICloneable
+    //
+
+    virtual IBinaryBufferSP clone() const override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_MAPPEDBINARYBUFFER_HPP_ */
@@ -27,6 +27,7 @@
 #include <vkts/core/vkts_core.hpp>
 
 #include "BinaryBuffer.hpp"
+#include "MappedBinaryBuffer.hpp"
 
 namespace vkts
 {
@@ -48,6 +49,19 @@ IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const std::vector<uint8_t>& dat
     return result;
 }
 
+IBinaryBufferSP VKTS_APIENTRY binaryBufferCreateView(const IBinaryBufferSP& buffer, const uint64_t offset, const uint64_t size)
+{
+    if (!buffer.get() || !buffer->getData() || size == 0 || offset + size > buffer->getSize())
+    {
+        return IBinaryBufferSP();
+    }
+
+    // Shares the ownership of the buffer, but points into its data.
+    auto data = std::shared_ptr<const uint8_t>(buffer, buffer->getByteData() + offset);
+
+    return IBinaryBufferSP(new MappedBinaryBuffer(data, size));
+}
+
 IBinaryBufferSP VKTS_APIENTRY binaryBufferCreate(const uint32_t size)
 {
     if (size == 0)
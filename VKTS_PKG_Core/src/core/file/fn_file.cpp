@@ -27,6 +27,8 @@
 #include <vkts/core/vkts_core.hpp>
 
 #include "../binary_buffer/BinaryBuffer.hpp"
+#include "../binary_buffer/MappedBinaryBuffer.hpp"
+#include "../text_buffer/MappedTextBuffer.hpp"
 #include "../text_buffer/TextBuffer.hpp"
 
 #include "fn_file_internal.hpp"
@@ -38,7 +40,7 @@ static std::mutex g_fileMutex;
 
 static std::string g_baseDirectory = std::string("");
 
-static VkBool32 fileSave(const char* filename, const void* data, const uint32_t size)
+static VkBool32 fileSave(const char* filename, const void* data, const uint64_t size)
 {
     if (!filename || !data || size == 0)
     {
@@ -67,7 +69,7 @@ static VkBool32 fileSave(const char* filename, const void* data, const uint32_t
         return VK_FALSE;
     }
 
-    size_t elementsWritten = fwrite(data, 1, size, file);
+    size_t elementsWritten = fwrite(data, 1, (size_t)size, file);
 
     fclose(file);
 
@@ -104,9 +106,56 @@ IBinaryBufferSP VKTS_APIENTRY fileLoadBinary(const char* filename)
 	return _fileLoadBinary(filename);
 }
 
+IBinaryBufferSP VKTS_APIENTRY _fileLoadBinaryReadOnly(const char* filename)
+{
+    auto buffer = _fileLoadBinary(filename);
+
+    if (!buffer.get())
+    {
+        return IBinaryBufferSP();
+    }
+
+    // The view keeps the loaded buffer alive.
+    auto data = std::shared_ptr<const uint8_t>(buffer, buffer->getByteData());
+
+    return IBinaryBufferSP(new MappedBinaryBuffer(data, buffer->getSize()));
+}
+
+ITextBufferSP VKTS_APIENTRY _fileCreateText(const IBinaryBufferSP& buffer)
+{
+    if (!buffer.get())
+    {
+        return ITextBufferSP();
+    }
+
+    if (!buffer->getData() || buffer->getSize() == 0)
+    {
+        return ITextBufferSP();
+    }
+
+    std::string text((const char*)buffer->getData(), (size_t)buffer->getSize());
+
+    // Text is moved.
+    return ITextBufferSP(new TextBuffer(text));
+}
+
 ITextBufferSP VKTS_APIENTRY fileLoadText(const char* filename)
 {
-    auto buffer = fileLoadBinary(filename);
+    return _fileCreateText(fileLoadBinary(filename));
+}
+
+IBinaryBufferSP VKTS_APIENTRY fileMapBinary(const char* filename, const VkTsFileAccess access)
+{
+    VkBool32 zeroTerminated = VK_FALSE;
+
+	return _fileMapBinary(filename, access, zeroTerminated);
+}
+
+ITextBufferSP VKTS_APIENTRY fileMapText(const char* filename)
+{
+    VkBool32 zeroTerminated = VK_FALSE;
+
+    auto buffer = _fileMapBinary(filename, VKTS_FILE_ACCESS_SEQUENTIAL, zeroTerminated);
 
     if (!buffer.get())
     {
@@ -118,7 +167,12 @@ ITextBufferSP VKTS_APIENTRY fileLoadText(const char* filename)
         return ITextBufferSP();
     }
 
-    std::string text((const char*)buffer->getData(), buffer->getSize());
+    if (zeroTerminated)
+    {
+        return ITextBufferSP(new MappedTextBuffer(buffer, buffer->getSize()));
+    }
+
+    std::string text((const char*)buffer->getData(), (size_t)buffer->getSize());
 
     // Text is moved.
     return ITextBufferSP(new TextBuffer(text));
@@ -166,6 +220,44 @@ VkBool32 VKTS_APIENTRY fileCreateDirectory(const char* directory)
 	return _fileCreateDirectory(directory);
 }
 
+VkBool32 VKTS_APIENTRY fileRename(const char* oldFilename, const char* newFilename)
+{
+    if (!oldFilename || !newFilename)
+    {
+        return VK_FALSE;
+    }
+
+	std::lock_guard<std::mutex> fileLockGuard(g_fileMutex);
+
+    std::string finalOldFilename = g_baseDirectory + std::string(oldFilename);
+    std::string finalNewFilename = g_baseDirectory + std::string(newFilename);
+
+    if (std::rename(finalOldFilename.c_str(), finalNewFilename.c_str()) == 0)
+    {
+        return VK_TRUE;
+    }
+
+    // Some platforms do not replace an existing file.
+
+    std::remove(finalNewFilename.c_str());
+
+    return std::rename(finalOldFilename.c_str(), finalNewFilename.c_str()) == 0;
+}
+
+VkBool32 VKTS_APIENTRY fileRemove(const char* filename)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+	std::lock_guard<std::mutex> fileLockGuard(g_fileMutex);
+
+    std::string finalFilename = g_baseDirectory + std::string(filename);
+
+    return std::remove(finalFilename.c_str()) == 0;
+}
+
 VkBool32 VKTS_APIENTRY fileGetDirectory(char* directory, const char* filename)
 {
     if (!directory || !filename)
@@ -196,7 +288,7 @@ VkBool32 VKTS_APIENTRY fileGetDirectory(char* directory, const char* filename)
 
 void VKTS_APIENTRY fileTerminate()
 {
-    // Nothing for now.
+    _fileAsyncTerminate();
 }
 
 }
@@ -27,6 +27,7 @@
 #include <vkts/core/vkts_core.hpp>
 
 #include "../binary_buffer/BinaryBuffer.hpp"
+#include "../binary_buffer/MappedBinaryBuffer.hpp"
 
 #include "fn_file_internal.hpp"
 
@@ -89,7 +90,23 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
 
 	//
 
-    auto buffer = IBinaryBufferSP(new BinaryBuffer(data, size));
+	IBinaryBufferSP buffer;
+
+	if (data)
+	{
+		buffer = IBinaryBufferSP(new BinaryBuffer(data, size));
+	}
+	else
+	{
+		// The asset has no buffer, so it is read instead.
+
+		std::vector<uint8_t> readData(size);
+
+		if (AAsset_read(sourceAsset, readData.data(), size) == (int)size)
+		{
+			buffer = IBinaryBufferSP(new BinaryBuffer(std::move(readData)));
+		}
+	}
 
 	AAsset_close(sourceAsset);
 
@@ -101,6 +118,68 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
 	return buffer;
 }
 
+IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename, const VkTsFileAccess access, VkBool32& zeroTerminated)
+{
+	zeroTerminated = VK_FALSE;
+
+    if (!filename)
+    {
+        return IBinaryBufferSP();
+    }
+
+    //
+
+    if (!::g_app)
+	{
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No android application.");
+
+		return IBinaryBufferSP();
+	}
+
+	AAssetManager* assetManager = ::g_app->activity->assetManager;
+
+    if (!assetManager)
+    {
+		vkts::logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No asset manager.");
+
+		return IBinaryBufferSP();
+    }
+
+    AAsset* sourceAsset = AAssetManager_open(assetManager, filename, access == VKTS_FILE_ACCESS_RANDOM ? AASSET_MODE_RANDOM : AASSET_MODE_BUFFER);
+
+    if (!sourceAsset)
+    {
+		return IBinaryBufferSP();
+    }
+
+    // Uncompressed assets are mapped, so the buffer is not copied.
+
+    const uint8_t* address = (const uint8_t*)AAsset_getBuffer(sourceAsset);
+
+	const uint64_t size = (uint64_t)AAsset_getLength64(sourceAsset);
+
+	if (!address || size == 0)
+	{
+		AAsset_close(sourceAsset);
+
+		if (!address && size > 0)
+		{
+			// The asset has no buffer, so it is read instead.
+
+			return _fileLoadBinaryReadOnly(filename);
+		}
+
+		return IBinaryBufferSP();
+	}
+
+    auto data = std::shared_ptr<const uint8_t>(address, [sourceAsset](const uint8_t* address)
+    {
+    	AAsset_close(sourceAsset);
+    });
+
+    return IBinaryBufferSP(new MappedBinaryBuffer(data, size));
+}
+
 VkBool32 VKTS_APIENTRY _filePrepareSaveBinary(const char* filename)
 {
 	if (!::g_app)
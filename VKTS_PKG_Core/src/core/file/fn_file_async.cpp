@@ -0,0 +1,349 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "fn_file_internal.hpp"
+
+namespace vkts
+{
+
+typedef std::shared_ptr<std::thread> ThreadSP;
+
+typedef struct FileAsyncRequest_
+{
+    std::vector<std::string> allFilenames;
+
+    std::vector<std::promise<IBinaryBufferSP>> allBinaryPromises;
+
+    FileLoadBinaryFunction binaryFunction;
+
+    std::promise<ITextBufferSP> textPromise;
+
+    FileLoadTextFunction textFunction;
+
+    VkBool32 text;
+} FileAsyncRequest;
+
+typedef std::shared_ptr<FileAsyncRequest> FileAsyncRequestSP;
+
+static std::mutex g_fileAsyncMutex;
+
+static std::condition_variable g_fileAsyncConditionVariable;
+
+static std::condition_variable g_fileAsyncDoneConditionVariable;
+
+static SmartPointerVector<ThreadSP> g_fileAsyncThreads;
+
+// One first in, first out queue per priority.
+static std::list<FileAsyncRequestSP> g_fileAsyncRequests[VKTS_FILE_PRIORITY_HIGH + 1];
+
+static uint32_t g_fileAsyncPendingCount = 0;
+
+static VkBool32 g_fileAsyncRun = VK_FALSE;
+
+static uint32_t g_fileAsyncThreadCount = 0;
+
+static VkBool32 fileAsyncHasRequest()
+{
+    for (int32_t priority = VKTS_FILE_PRIORITY_HIGH; priority >= VKTS_FILE_PRIORITY_LOW; priority--)
+    {
+        if (g_fileAsyncRequests[priority].size() > 0)
+        {
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+static FileAsyncRequestSP fileAsyncPopRequest()
+{
+    for (int32_t priority = VKTS_FILE_PRIORITY_HIGH; priority >= VKTS_FILE_PRIORITY_LOW; priority--)
+    {
+        if (g_fileAsyncRequests[priority].size() > 0)
+        {
+            auto request = g_fileAsyncRequests[priority].front();
+
+            g_fileAsyncRequests[priority].pop_front();
+
+            return request;
+        }
+    }
+
+    return FileAsyncRequestSP();
+}
+
+static void fileAsyncDone(const uint32_t count)
+{
+    std::lock_guard<std::mutex> fileAsyncLockGuard(g_fileAsyncMutex);
+
+    g_fileAsyncPendingCount -= count;
+
+    if (g_fileAsyncPendingCount == 0)
+    {
+        g_fileAsyncDoneConditionVariable.notify_all();
+    }
+}
+
+static void fileAsyncProcess(const FileAsyncRequestSP& request, const VkBool32 load)
+{
+    if (request->text)
+    {
+        ITextBufferSP text;
+
+        if (load)
+        {
+            VKTS_PROFILE_ZONE("fileLoadTextAsync");
+
+            // Loading does not touch the save state, so the I/O threads do not serialize on the file mutex.
+            text = _fileCreateText(_fileLoadBinary(request->allFilenames[0].c_str()));
+        }
+
+        if (request->textFunction)
+        {
+            request->textFunction(request->allFilenames[0], text);
+        }
+
+        request->textPromise.set_value(text);
+
+        fileAsyncDone(1);
+
+        return;
+    }
+
+    for (size_t i = 0; i < request->allFilenames.size(); i++)
+    {
+        IBinaryBufferSP buffer;
+
+        if (load)
+        {
+            VKTS_PROFILE_ZONE("fileLoadBinaryAsync");
+
+            buffer = _fileLoadBinary(request->allFilenames[i].c_str());
+        }
+
+        if (request->binaryFunction)
+        {
+            request->binaryFunction(request->allFilenames[i], buffer);
+        }
+
+        request->allBinaryPromises[i].set_value(buffer);
+
+        fileAsyncDone(1);
+    }
+}
+
+static void fileAsyncWorker()
+{
+    std::unique_lock<std::mutex> fileAsyncUniqueLock(g_fileAsyncMutex);
+
+    while (true)
+    {
+        g_fileAsyncConditionVariable.wait(fileAsyncUniqueLock, [] {return !g_fileAsyncRun || fileAsyncHasRequest();});
+
+        if (!g_fileAsyncRun)
+        {
+            return;
+        }
+
+        // Highest priority and oldest request first.
+
+        auto request = fileAsyncPopRequest();
+
+        fileAsyncUniqueLock.unlock();
+
+        fileAsyncProcess(request, VK_TRUE);
+
+        fileAsyncUniqueLock.lock();
+    }
+}
+
+static void fileAsyncStopThreads(std::unique_lock<std::mutex>& fileAsyncUniqueLock)
+{
+    g_fileAsyncRun = VK_FALSE;
+
+    g_fileAsyncConditionVariable.notify_all();
+
+    fileAsyncUniqueLock.unlock();
+
+    for (size_t i = 0; i < g_fileAsyncThreads.size(); i++)
+    {
+        g_fileAsyncThreads[i]->join();
+    }
+
+    fileAsyncUniqueLock.lock();
+
+    g_fileAsyncThreads.clear();
+}
+
+static void fileAsyncSubmit(const FileAsyncRequestSP& request, const VkTsFilePriority priority)
+{
+    std::lock_guard<std::mutex> fileAsyncLockGuard(g_fileAsyncMutex);
+
+    if (!g_fileAsyncRun)
+    {
+        uint32_t threadCount = g_fileAsyncThreadCount > 0 ? g_fileAsyncThreadCount : VKTS_FILE_ASYNC_DEFAULT_THREADS;
+
+        for (uint32_t i = 0; i < threadCount; i++)
+        {
+            g_fileAsyncThreads.append(ThreadSP(new std::thread(fileAsyncWorker)));
+        }
+
+        g_fileAsyncRun = VK_TRUE;
+    }
+
+    g_fileAsyncRequests[priority].push_back(request);
+
+    g_fileAsyncPendingCount += (uint32_t)request->allFilenames.size();
+
+    g_fileAsyncConditionVariable.notify_one();
+}
+
+//
+
+VkBool32 VKTS_APIENTRY fileSetAsyncThreadCount(const uint32_t count)
+{
+    std::unique_lock<std::mutex> fileAsyncUniqueLock(g_fileAsyncMutex);
+
+    // Running I/O threads process all pending requests before they stop.
+
+    g_fileAsyncDoneConditionVariable.wait(fileAsyncUniqueLock, [] {return g_fileAsyncPendingCount == 0;});
+
+    if (g_fileAsyncRun)
+    {
+        fileAsyncStopThreads(fileAsyncUniqueLock);
+    }
+
+    g_fileAsyncThreadCount = count;
+
+    return VK_TRUE;
+}
+
+uint32_t VKTS_APIENTRY fileGetAsyncThreadCount()
+{
+    std::lock_guard<std::mutex> fileAsyncLockGuard(g_fileAsyncMutex);
+
+    return g_fileAsyncThreadCount > 0 ? g_fileAsyncThreadCount : VKTS_FILE_ASYNC_DEFAULT_THREADS;
+}
+
+std::shared_future<IBinaryBufferSP> VKTS_APIENTRY fileLoadBinaryAsync(const char* filename, const VkTsFilePriority priority, const FileLoadBinaryFunction& function)
+{
+    auto request = FileAsyncRequestSP(new FileAsyncRequest());
+
+    request->allFilenames.push_back(filename ? std::string(filename) : std::string(""));
+    request->allBinaryPromises.resize(1);
+    request->binaryFunction = function;
+    request->text = VK_FALSE;
+
+    std::shared_future<IBinaryBufferSP> future = request->allBinaryPromises[0].get_future().share();
+
+    fileAsyncSubmit(request, priority);
+
+    return future;
+}
+
+std::shared_future<ITextBufferSP> VKTS_APIENTRY fileLoadTextAsync(const char* filename, const VkTsFilePriority priority, const FileLoadTextFunction& function)
+{
+    auto request = FileAsyncRequestSP(new FileAsyncRequest());
+
+    request->allFilenames.push_back(filename ? std::string(filename) : std::string(""));
+    request->textFunction = function;
+    request->text = VK_TRUE;
+
+    std::shared_future<ITextBufferSP> future = request->textPromise.get_future().share();
+
+    fileAsyncSubmit(request, priority);
+
+    return future;
+}
+
+std::vector<std::shared_future<IBinaryBufferSP>> VKTS_APIENTRY fileLoadBinaryBatch(const std::vector<std::string>& allFilenames, const VkTsFilePriority priority, const FileLoadBinaryFunction& function)
+{
+    std::vector<std::shared_future<IBinaryBufferSP>> allFutures;
+
+    if (allFilenames.size() == 0)
+    {
+        return allFutures;
+    }
+
+    auto request = FileAsyncRequestSP(new FileAsyncRequest());
+
+    request->allFilenames = allFilenames;
+    request->allBinaryPromises.resize(allFilenames.size());
+    request->binaryFunction = function;
+    request->text = VK_FALSE;
+
+    for (size_t i = 0; i < request->allBinaryPromises.size(); i++)
+    {
+        allFutures.push_back(request->allBinaryPromises[i].get_future().share());
+    }
+
+    fileAsyncSubmit(request, priority);
+
+    return allFutures;
+}
+
+uint32_t VKTS_APIENTRY fileGetAsyncPendingCount()
+{
+    std::lock_guard<std::mutex> fileAsyncLockGuard(g_fileAsyncMutex);
+
+    return g_fileAsyncPendingCount;
+}
+
+void VKTS_APIENTRY fileWaitAsync()
+{
+    std::unique_lock<std::mutex> fileAsyncUniqueLock(g_fileAsyncMutex);
+
+    g_fileAsyncDoneConditionVariable.wait(fileAsyncUniqueLock, [] {return g_fileAsyncPendingCount == 0;});
+}
+
+void VKTS_APIENTRY _fileAsyncTerminate()
+{
+    std::unique_lock<std::mutex> fileAsyncUniqueLock(g_fileAsyncMutex);
+
+    if (g_fileAsyncRun)
+    {
+        fileAsyncStopThreads(fileAsyncUniqueLock);
+    }
+
+    // Not yet processed requests are completed with empty buffers, so no future is left waiting.
+
+    auto request = fileAsyncPopRequest();
+
+    while (request.get())
+    {
+        fileAsyncUniqueLock.unlock();
+
+        fileAsyncProcess(request, VK_FALSE);
+
+        fileAsyncUniqueLock.lock();
+
+        request = fileAsyncPopRequest();
+    }
+}
+
+}
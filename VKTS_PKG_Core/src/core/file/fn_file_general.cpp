@@ -107,7 +107,7 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
         return IBinaryBufferSP();
     }
 
-    uint32_t size = static_cast<uint32_t>(length);
+    uint64_t size = static_cast<uint64_t>(length);
 
     if (size == 0)
     {
@@ -116,13 +116,12 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
         return IBinaryBufferSP();
     }
 
-    std::vector<uint8_t> data(size);
-
-    memset(&data[0], 0, size);
+    // Already zero initialized.
+    std::vector<uint8_t> data((size_t)size);
 
     rewind(file);
 
-    auto elementsRead = fread(&data[0], 1, size, file);
+    auto elementsRead = fread(&data[0], 1, (size_t)size, file);
 
     fclose(file);
 
@@ -133,7 +132,8 @@ IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename)
         return IBinaryBufferSP();
     }
 
-    auto buffer = IBinaryBufferSP(new BinaryBuffer(data));
+    // Data is moved and not copied.
+    auto buffer = IBinaryBufferSP(new BinaryBuffer(std::move(data)));
 
     //
 
@@ -36,6 +36,16 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY _fileInit();
 
 VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY _fileLoadBinary(const char* filename);
 
+/**
+ * Loads the file like _fileLoadBinary, but returns it as a read only buffer. Used, if a file can not be mapped.
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY _fileLoadBinaryReadOnly(const char* filename);
+
+/**
+ * Zero terminated is set, if the byte after the mapped data is readable and zero.
+ */
+VKTS_APICALL IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename, const VkTsFileAccess access, VkBool32& zeroTerminated);
+
 VKTS_APICALL void VKTS_APIENTRY _fileSetBaseDirectory(const char* directory);
 
 VKTS_APICALL const char* VKTS_APIENTRY _fileGetBaseDirectory();
@@ -44,6 +54,10 @@ VKTS_APICALL VkBool32 VKTS_APIENTRY _filePrepareSaveBinary(const char* filename)
 
 VKTS_APICALL VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory);
 
+VKTS_APICALL ITextBufferSP VKTS_APIENTRY _fileCreateText(const IBinaryBufferSP& buffer);
+
+VKTS_APICALL void VKTS_APIENTRY _fileAsyncTerminate();
+
 }
 
 #endif /* VKTS_FN_FILE_INTERNAL_HPP_ */
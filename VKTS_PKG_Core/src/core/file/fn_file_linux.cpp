@@ -26,13 +26,85 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "../binary_buffer/MappedBinaryBuffer.hpp"
+
 #include "fn_file_internal.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace vkts
 {
 
+IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename, const VkTsFileAccess access, VkBool32& zeroTerminated)
+{
+	zeroTerminated = VK_FALSE;
+
+    if (!filename)
+    {
+        return IBinaryBufferSP();
+    }
+
+    //
+
+    std::string mapFilename = _fileGetBaseDirectory() + std::string(filename);
+
+    int fileDescriptor = open(mapFilename.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return IBinaryBufferSP();
+    }
+
+    struct stat sb;
+
+    if (fstat(fileDescriptor, &sb) != 0 || sb.st_size <= 0)
+    {
+    	close(fileDescriptor);
+
+        return IBinaryBufferSP();
+    }
+
+    uint64_t size = static_cast<uint64_t>(sb.st_size);
+
+    void* address = mmap(nullptr, (size_t)size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // Mapping stays valid after closing.
+    close(fileDescriptor);
+
+    if (address == MAP_FAILED)
+    {
+        return _fileLoadBinaryReadOnly(filename);
+    }
+
+    switch (access)
+    {
+    	case VKTS_FILE_ACCESS_SEQUENTIAL:
+    		madvise(address, (size_t)size, MADV_SEQUENTIAL);
+    		break;
+    	case VKTS_FILE_ACCESS_RANDOM:
+    		madvise(address, (size_t)size, MADV_RANDOM);
+    		break;
+    	case VKTS_FILE_ACCESS_WILL_NEED:
+    		madvise(address, (size_t)size, MADV_WILLNEED);
+    		break;
+    	default:
+    		break;
+    }
+
+    // The rest of the last page is filled with zeros.
+    zeroTerminated = (size % (uint64_t)sysconf(_SC_PAGESIZE)) != 0;
+
+    auto data = std::shared_ptr<const uint8_t>(static_cast<const uint8_t*>(address), [size](const uint8_t* address)
+    {
+    	munmap(const_cast<uint8_t*>(address), (size_t)size);
+    });
+
+    return IBinaryBufferSP(new MappedBinaryBuffer(data, size));
+}
+
 VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory)
 {
 	if (!directory)
@@ -26,11 +26,89 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "../binary_buffer/MappedBinaryBuffer.hpp"
+
 #include "fn_file_internal.hpp"
 
 namespace vkts
 {
 
+IBinaryBufferSP VKTS_APIENTRY _fileMapBinary(const char* filename, const VkTsFileAccess access, VkBool32& zeroTerminated)
+{
+	zeroTerminated = VK_FALSE;
+
+    if (!filename)
+    {
+        return IBinaryBufferSP();
+    }
+
+    //
+
+    std::string mapFilename = _fileGetBaseDirectory() + std::string(filename);
+
+    DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL;
+
+    if (access == VKTS_FILE_ACCESS_SEQUENTIAL)
+    {
+    	flagsAndAttributes |= FILE_FLAG_SEQUENTIAL_SCAN;
+    }
+    else if (access == VKTS_FILE_ACCESS_RANDOM)
+    {
+    	flagsAndAttributes |= FILE_FLAG_RANDOM_ACCESS;
+    }
+
+    HANDLE file = CreateFile(mapFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flagsAndAttributes, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return IBinaryBufferSP();
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+    	CloseHandle(file);
+
+        return IBinaryBufferSP();
+    }
+
+    uint64_t size = static_cast<uint64_t>(fileSize.QuadPart);
+
+    HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    // Mapping keeps the file open.
+    CloseHandle(file);
+
+    if (!mapping)
+    {
+        return _fileLoadBinaryReadOnly(filename);
+    }
+
+    void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    CloseHandle(mapping);
+
+    if (!address)
+    {
+        return _fileLoadBinaryReadOnly(filename);
+    }
+
+    SYSTEM_INFO systemInfo;
+
+    GetSystemInfo(&systemInfo);
+
+    // The rest of the last page is filled with zeros.
+    zeroTerminated = (size % (uint64_t)systemInfo.dwPageSize) != 0;
+
+    auto data = std::shared_ptr<const uint8_t>(static_cast<const uint8_t*>(address), [](const uint8_t* address)
+    {
+    	UnmapViewOfFile(address);
+    });
+
+    return IBinaryBufferSP(new MappedBinaryBuffer(data, size));
+}
+
 VkBool32 VKTS_APIENTRY _fileCreateDirectory(const char* directory)
 {
 	if (!directory)
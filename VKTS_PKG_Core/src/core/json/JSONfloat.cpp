@@ -26,6 +26,8 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "fn_json_internal.hpp"
+
 namespace vkts
 {
 
@@ -62,21 +64,9 @@ void JSONfloat::setValue(float value)
 
 VkBool32 JSONfloat::encode(std::string& jsonText, int32_t& spaces) const
 {
-	char buffer[2048];
-
-	float dummy;
-	float fractpart = fabsf(modff(getValue(), &dummy));
-
-	if (fabsf(getValue()) >= 1000000.0f || (fractpart <= 0.0000001f && fractpart > 0.0f))
-	{
-		sprintf(buffer, "%e", getValue());
-	}
-	else
-	{
-		sprintf(buffer, "%.6f", getValue());
-	}
+	char buffer[VKTS_JSON_NUMBER_BUFFER_SIZE];
 
-	jsonText += std::string(buffer);
+	jsonText.append(buffer, _jsonFormatFloat(buffer, getValue()) - buffer);
 
 	return VK_TRUE;
 }
@@ -26,6 +26,8 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "fn_json_internal.hpp"
+
 namespace vkts
 {
 
@@ -61,11 +63,9 @@ void JSONinteger::setValue(int32_t value)
 
 VkBool32 JSONinteger::encode(std::string& jsonText, int32_t& spaces) const
 {
-	char buffer[2048];
-
-	sprintf(buffer, "%d", getValue());
+	char buffer[VKTS_JSON_NUMBER_BUFFER_SIZE];
 
-	jsonText += std::string(buffer);
+	jsonText.append(buffer, _jsonFormatInteger(buffer, getValue()) - buffer);
 
 	return VK_TRUE;
 }
@@ -26,7 +26,7 @@
 
 #include <vkts/core/vkts_core.hpp>
 
-#define VKTS_JSON_TAB_STEP 3
+#include "fn_json_internal.hpp"
 
 namespace vkts
 {
@@ -0,0 +1,76 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "JsonArena.hpp"
+
+namespace vkts
+{
+
+JsonArena::JsonArena() :
+	allBlocks(), current(nullptr), remaining(0)
+{
+}
+
+JsonArena::~JsonArena()
+{
+}
+
+void* JsonArena::allocate(const size_t size, const size_t alignment)
+{
+	size_t padding = current ? (alignment - ((uintptr_t)current & (alignment - 1))) & (alignment - 1) : 0;
+
+	if (!current || padding + size > remaining)
+	{
+		// Large allocations get an own block, so the current block can still be used.
+
+		size_t blockSize = size + alignment > VKTS_JSON_ARENA_BLOCK_SIZE ? size + alignment : VKTS_JSON_ARENA_BLOCK_SIZE;
+
+		allBlocks.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[blockSize]));
+
+		uint8_t* block = allBlocks.back().get();
+
+		padding = (alignment - ((uintptr_t)block & (alignment - 1))) & (alignment - 1);
+
+		if (blockSize != VKTS_JSON_ARENA_BLOCK_SIZE)
+		{
+			return block + padding;
+		}
+
+		current = block;
+		remaining = blockSize;
+	}
+
+	void* result = current + padding;
+
+	current += padding + size;
+	remaining -= padding + size;
+
+	return result;
+}
+
+}
@@ -0,0 +1,120 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_JSONARENA_HPP_
+#define VKTS_JSONARENA_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_JSON_ARENA_BLOCK_SIZE 65536
+
+namespace vkts
+{
+
+/**
+ * Bump allocator for the nodes of one decoded JSON document. Memory is only released, when the arena is destroyed.
+ */
+class JsonArena
+{
+
+private:
+
+	std::vector<std::unique_ptr<uint8_t[]>> allBlocks;
+
+	uint8_t* current;
+
+	size_t remaining;
+
+public:
+
+	JsonArena();
+	JsonArena(const JsonArena& other) = delete;
+	JsonArena(JsonArena&& other) = delete;
+	~JsonArena();
+
+	JsonArena& operator =(const JsonArena& other) = delete;
+	JsonArena& operator =(JsonArena && other) = delete;
+
+	/**
+	 * Not thread Safe.
+	 */
+	void* allocate(const size_t size, const size_t alignment);
+
+};
+
+typedef std::shared_ptr<JsonArena> JsonArenaSP;
+
+/**
+ * Every node allocated with std::allocate_shared keeps the arena alive, so a node can outlive the decoded document.
+ */
+template<class T>
+class JsonArenaAllocator
+{
+
+public:
+
+	typedef T value_type;
+
+	JsonArenaSP arena;
+
+	explicit JsonArenaAllocator(const JsonArenaSP& arena) :
+		arena(arena)
+	{
+	}
+
+	template<class U>
+	JsonArenaAllocator(const JsonArenaAllocator<U>& other) :
+		arena(other.arena)
+	{
+	}
+
+	T* allocate(const size_t n)
+	{
+		return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T* p, const size_t n)
+	{
+		// Released with the arena.
+	}
+
+};
+
+template<class T, class U>
+bool operator ==(const JsonArenaAllocator<T>& a, const JsonArenaAllocator<U>& b)
+{
+	return a.arena == b.arena;
+}
+
+template<class T, class U>
+bool operator !=(const JsonArenaAllocator<T>& a, const JsonArenaAllocator<U>& b)
+{
+	return a.arena != b.arena;
+}
+
+}
+
+#endif /* VKTS_JSONARENA_HPP_ */
@@ -0,0 +1,191 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "JsonArena.hpp"
+
+namespace vkts
+{
+
+template<class T, class... Args>
+static std::shared_ptr<T> jsonCreate(const JsonArenaSP& arena, Args&&... args)
+{
+	return std::allocate_shared<T>(JsonArenaAllocator<T>(arena), std::forward<Args>(args)...);
+}
+
+JsonBuilder::JsonBuilder() :
+	JsonHandler(), arena(), allContainers(), allObjects(), allKeys(), value()
+{
+}
+
+JsonBuilder::~JsonBuilder()
+{
+}
+
+void JsonBuilder::startValue()
+{
+	if (allContainers.size() == 0)
+	{
+		// Previous values keep their arena alive.
+		arena = JsonArenaSP(new JsonArena());
+	}
+}
+
+VkBool32 JsonBuilder::addValue(const JSONvalueSP& currentValue)
+{
+	if (allContainers.size() == 0)
+	{
+		value = currentValue;
+	}
+	else if (allObjects.back())
+	{
+		static_cast<JSONobject*>(allContainers.back().get())->addKeyValue(allKeys.back(), currentValue);
+	}
+	else
+	{
+		static_cast<JSONarray*>(allContainers.back().get())->addValue(currentValue);
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::endContainer(const VkBool32 isObject)
+{
+	if (allContainers.size() == 0 || allObjects.back() != isObject)
+	{
+		return VK_FALSE;
+	}
+
+	allContainers.pop_back();
+	allObjects.pop_back();
+	allKeys.pop_back();
+
+	return VK_TRUE;
+}
+
+const JSONvalueSP& JsonBuilder::getValue() const
+{
+	return value;
+}
+
+//
+
+VkBool32 JsonBuilder::startObject()
+{
+	startValue();
+
+	JSONvalueSP jsonObject = jsonCreate<JSONobject>(arena);
+
+	addValue(jsonObject);
+
+	allContainers.push_back(jsonObject);
+	allObjects.push_back(VK_TRUE);
+	allKeys.push_back(std::string());
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::key(const std::string& key)
+{
+	if (allContainers.size() == 0 || !allObjects.back())
+	{
+		return VK_FALSE;
+	}
+
+	allKeys.back() = key;
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::endObject()
+{
+	return endContainer(VK_TRUE);
+}
+
+VkBool32 JsonBuilder::startArray()
+{
+	startValue();
+
+	JSONvalueSP jsonArray = jsonCreate<JSONarray>(arena);
+
+	addValue(jsonArray);
+
+	allContainers.push_back(jsonArray);
+	allObjects.push_back(VK_FALSE);
+	allKeys.push_back(std::string());
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonBuilder::endArray()
+{
+	return endContainer(VK_FALSE);
+}
+
+VkBool32 JsonBuilder::stringValue(const std::string& value)
+{
+	startValue();
+
+	return addValue(jsonCreate<JSONstring>(arena, value));
+}
+
+VkBool32 JsonBuilder::integerValue(const int32_t value)
+{
+	startValue();
+
+	return addValue(jsonCreate<JSONinteger>(arena, value));
+}
+
+VkBool32 JsonBuilder::floatValue(const float value)
+{
+	startValue();
+
+	return addValue(jsonCreate<JSONfloat>(arena, value));
+}
+
+VkBool32 JsonBuilder::trueValue()
+{
+	startValue();
+
+	return addValue(jsonCreate<JSONtrue>(arena));
+}
+
+VkBool32 JsonBuilder::falseValue()
+{
+	startValue();
+
+	return addValue(jsonCreate<JSONfalse>(arena));
+}
+
+VkBool32 JsonBuilder::nullValue()
+{
+	startValue();
+
+	return addValue(jsonCreate<JSONnull>(arena));
+}
+
+}
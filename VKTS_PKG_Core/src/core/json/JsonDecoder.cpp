@@ -28,242 +28,165 @@
 
 #include "JsonDecoder.hpp"
 
-namespace vkts
-{
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VKTS_JSON_SSE2
+#endif
 
-JsonDecoder::JsonDecoder() :
-	jsonText("")
-{
-}
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
-JsonDecoder::~JsonDecoder()
+namespace vkts
 {
-}
 
-//
-
-VkBool32 JsonDecoder::match(const std::string& token, uint32_t& index)
+static VkBool32 jsonIsWhitespace(const char character)
 {
-	uint32_t length = (uint32_t)token.length();
-
-	if ((uint32_t)jsonText.length() < index + length)
-	{
-		return VK_FALSE;
-	}
-
-	if (jsonText.substr(index, length).compare(token) == 0)
-	{
-		index += length;
-
-		return VK_TRUE;
-	}
-
-	return VK_FALSE;
+	return character == ' ' || character == '\n' || character == '\r' || character == '\t';
 }
 
-//
-
-VkBool32 JsonDecoder::decodeWhitespace(uint32_t& index)
+static VkBool32 jsonIsDigit(const char character)
 {
-	return match(JSON_Encode_character_tabulation, index) || match(JSON_Encode_line_feed, index) ||match(JSON_Encode_carriage_return, index) || match(JSON_space, index);
+	return character >= '0' && character <= '9';
 }
 
-//
+#ifdef VKTS_JSON_SSE2
 
-VkBool32 JsonDecoder::decodeLeftSquareBracket(uint32_t& index)
+static uint32_t jsonCountTrailingZeros(const uint32_t mask)
 {
-	return match(JSON_left_square_bracket, index);
-}
+#if defined(_MSC_VER)
+	unsigned long index;
 
-VkBool32 JsonDecoder::decodeLeftCurlyBracket(uint32_t& index)
-{
-	return match(JSON_left_curly_bracket, index);
-}
+	_BitScanForward(&index, mask);
 
-VkBool32 JsonDecoder::decodeRightSquareBracket(uint32_t& index)
-{
-	return match(JSON_right_square_bracket, index);
+	return (uint32_t)index;
+#else
+	return (uint32_t)__builtin_ctz(mask);
+#endif
 }
 
-VkBool32 JsonDecoder::decodeRightCurlyBracket(uint32_t& index)
-{
-	return match(JSON_right_curly_bracket, index);
-}
+#endif
 
-VkBool32 JsonDecoder::decodeColon(uint32_t& index)
+static const char* jsonSkipWhitespace(const char* current, const char* end)
 {
-	return match(JSON_colon, index);
-}
+#ifdef VKTS_JSON_SSE2
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i lineFeed = _mm_set1_epi8('\n');
+	const __m128i carriageReturn = _mm_set1_epi8('\r');
+	const __m128i characterTabulation = _mm_set1_epi8('\t');
 
-VkBool32 JsonDecoder::decodeComma(uint32_t& index)
-{
-	return match(JSON_comma, index);
-}
-
-//
-
-VkBool32 JsonDecoder::decodePlus(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_plus, index))
+	while (end - current >= 16)
 	{
-		characters += JSON_plus;
+		__m128i chunk = _mm_loadu_si128((const __m128i*)current);
 
-		return VK_TRUE;
-	}
+		__m128i whitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, lineFeed)), _mm_or_si128(_mm_cmpeq_epi8(chunk, carriageReturn), _mm_cmpeq_epi8(chunk, characterTabulation)));
 
-	return VK_FALSE;
-}
+		uint32_t mask = (uint32_t)_mm_movemask_epi8(whitespace) ^ 0xFFFF;
 
-VkBool32 JsonDecoder::decodeMinus(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_minus, index))
-	{
-		characters += JSON_minus;
+		if (mask)
+		{
+			return current + jsonCountTrailingZeros(mask);
+		}
 
-		return VK_TRUE;
+		current += 16;
 	}
+#endif
 
-	return VK_FALSE;
-}
-
-VkBool32 JsonDecoder::decodePoint(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_point, index))
+	while (current < end && jsonIsWhitespace(*current))
 	{
-		characters += JSON_point;
-
-		return VK_TRUE;
+		current++;
 	}
 
-	return VK_FALSE;
+	return current;
 }
 
-//
-
-VkBool32 JsonDecoder::decodeHexadecimalDigit(uint32_t& index, std::string& characters, int32_t& value)
+/**
+ * Returns the next quotation mark or reverse solidus.
+ */
+static const char* jsonFindStringEnd(const char* current, const char* end)
 {
-	if (match(JSON_A, index) || match(JSON_B, index) || match(JSON_C, index) || match(JSON_D, index) || match(JSON_E, index) || match(JSON_F, index))
-	{
-		characters += jsonText.substr(index - 1, 1);
-
-		value = static_cast<int32_t>(jsonText.substr(index - 1, 1)[0] - JSON_A[0]);
+#ifdef VKTS_JSON_SSE2
+	const __m128i quotationMark = _mm_set1_epi8('"');
+	const __m128i reverseSolidus = _mm_set1_epi8('\\');
 
-		return VK_TRUE;
-	}
-	if (match(JSON_a, index) || match(JSON_b, index) || match(JSON_c, index) || match(JSON_d, index) || match(JSON_e, index) || match(JSON_f, index))
+	while (end - current >= 16)
 	{
-		characters += jsonText.substr(index - 1, 1);
-
-		value = static_cast<int32_t>(jsonText.substr(index - 1, 1)[0] - JSON_a[0]);
+		__m128i chunk = _mm_loadu_si128((const __m128i*)current);
 
-		return VK_TRUE;
-	}
+		uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quotationMark), _mm_cmpeq_epi8(chunk, reverseSolidus)));
 
-	return VK_FALSE;
-}
+		if (mask)
+		{
+			return current + jsonCountTrailingZeros(mask);
+		}
 
-//
+		current += 16;
+	}
+#endif
 
-VkBool32 JsonDecoder::decodeDigit_0(uint32_t& index, std::string& characters, int32_t& value)
-{
-	if (match(JSON_0, index))
+	while (current < end && *current != '"' && *current != '\\')
 	{
-		characters += JSON_0;
-
-		value = 0;
-
-		return VK_TRUE;
+		current++;
 	}
 
-	return VK_FALSE;
+	return current;
 }
 
-VkBool32 JsonDecoder::decodeDigit_1_9(uint32_t& index, std::string& characters, int32_t& value)
+static void jsonAppendUtf8(std::string& value, const uint32_t codePoint)
 {
-	if (match(JSON_1, index) || match(JSON_2, index) || match(JSON_3, index) || match(JSON_4, index) || match(JSON_5, index) || match(JSON_6, index) || match(JSON_7, index) || match(JSON_8, index) || match(JSON_9, index))
+	if (codePoint < 0x80)
 	{
-		characters += jsonText.substr(index - 1, 1);
-
-		value = atoi(jsonText.substr(index - 1, 1).c_str());
-
-		return VK_TRUE;
+		value += static_cast<char>(codePoint);
 	}
-
-	return VK_FALSE;
-}
-
-VkBool32 JsonDecoder::decodeDigit(uint32_t& index, std::string& characters, int32_t& value)
-{
-	return decodeDigit_0(index, characters, value) || decodeDigit_1_9(index, characters, value);
-}
-
-VkBool32 JsonDecoder::decodeExponent(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_e, index) || match(JSON_E, index))
+	else if (codePoint < 0x800)
 	{
-		characters += JSON_e;
-
-		return VK_TRUE;
+		value += static_cast<char>(0xC0 | (codePoint >> 6));
+		value += static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else if (codePoint < 0x10000)
+	{
+		value += static_cast<char>(0xE0 | (codePoint >> 12));
+		value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		value += static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else
+	{
+		value += static_cast<char>(0xF0 | (codePoint >> 18));
+		value += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+		value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		value += static_cast<char>(0x80 | (codePoint & 0x3F));
 	}
-
-	return VK_FALSE;
 }
 
 //
 
-VkBool32 JsonDecoder::decodeQuotationMark(uint32_t& index, std::string& characters)
+JsonDecoder::JsonDecoder() :
+	current(nullptr), end(nullptr), jsonHandler(nullptr), characters()
 {
-	if (match(JSON_quotation_mark, index))
-	{
-		characters += JSON_quotation_mark;
-
-		return VK_TRUE;
-	}
-
-	return VK_FALSE;
 }
 
-VkBool32 JsonDecoder::decodeReverseSolidus(uint32_t& index, std::string& characters)
+JsonDecoder::~JsonDecoder()
 {
-	if (match(JSON_reverse_solidus, index))
-	{
-		// Do nothing.
-
-		return VK_TRUE;
-	}
-
-	return VK_FALSE;
 }
 
-VkBool32 JsonDecoder::decodeSolidus(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_solidus, index))
-	{
-		characters += JSON_solidus;
-
-		return VK_TRUE;
-	}
-
-	return VK_FALSE;
-}
+//
 
-VkBool32 JsonDecoder::decodeBackspace(uint32_t& index, std::string& characters)
+void JsonDecoder::decodeWhitespace()
 {
-	if (match(JSON_Decode_backspace, index))
+	// Most tokens are not preceded by whitespace.
+	if (current < end && !jsonIsWhitespace(*current))
 	{
-		characters += JSON_Encode_backspace;
-
-		return VK_TRUE;
+		return;
 	}
 
-	return VK_FALSE;
+	current = jsonSkipWhitespace(current, end);
 }
 
-VkBool32 JsonDecoder::decodeFormFeed(uint32_t& index, std::string& characters)
+VkBool32 JsonDecoder::match(const char token)
 {
-	if (match(JSON_Decode_form_feed, index))
+	if (current < end && *current == token)
 	{
-		characters += JSON_Encode_form_feed;
+		current++;
 
 		return VK_TRUE;
 	}
@@ -271,11 +194,11 @@ VkBool32 JsonDecoder::decodeFormFeed(uint32_t& index, std::string& characters)
 	return VK_FALSE;
 }
 
-VkBool32 JsonDecoder::decodeLineFeed(uint32_t& index, std::string& characters)
+VkBool32 JsonDecoder::match(const char* token, const size_t length)
 {
-	if (match(JSON_Decode_line_feed, index))
+	if ((size_t)(end - current) >= length && memcmp(current, token, length) == 0)
 	{
-		characters += JSON_Encode_line_feed;
+		current += length;
 
 		return VK_TRUE;
 	}
@@ -283,476 +206,538 @@ VkBool32 JsonDecoder::decodeLineFeed(uint32_t& index, std::string& characters)
 	return VK_FALSE;
 }
 
-VkBool32 JsonDecoder::decodeCarriageReturn(uint32_t& index, std::string& characters)
+//
+
+VkBool32 JsonDecoder::decodeHexadecimalNumber(uint32_t& value)
 {
-	if (match(JSON_Decode_carriage_return, index))
+	if (end - current < 4)
 	{
-		characters += JSON_Encode_carriage_return;
-
-		return VK_TRUE;
+		return VK_FALSE;
 	}
 
-	return VK_FALSE;
-}
+	value = 0;
 
-VkBool32 JsonDecoder::decodeCharacterTabulation(uint32_t& index, std::string& characters)
-{
-	if (match(JSON_Decode_character_tabulation, index))
+	for (uint32_t i = 0; i < 4; i++)
 	{
-		characters += JSON_Encode_character_tabulation;
+		char character = *current++;
 
-		return VK_TRUE;
+		if (character >= '0' && character <= '9')
+		{
+			value = value * 16 + (uint32_t)(character - '0');
+		}
+		else if (character >= 'A' && character <= 'F')
+		{
+			value = value * 16 + (uint32_t)(character - 'A' + 10);
+		}
+		else if (character >= 'a' && character <= 'f')
+		{
+			value = value * 16 + (uint32_t)(character - 'a' + 10);
+		}
+		else
+		{
+			return VK_FALSE;
+		}
 	}
 
-	return VK_FALSE;
+	return VK_TRUE;
 }
 
-VkBool32 JsonDecoder::decodeHexadecimalNumber(uint32_t& index, std::string& characters)
+VkBool32 JsonDecoder::decodeUnicode(std::string& value)
 {
-	int32_t value = 0;
-	int32_t tempValue = 0;
+	uint32_t codePoint;
 
-	uint32_t tempIndex = index;
-
-	if (!match(JSON_u, tempIndex))
+	if (!decodeHexadecimalNumber(codePoint))
 	{
 		return VK_FALSE;
 	}
 
-	if (tempIndex + 4 > jsonText.length())
+	// High surrogate followed by a low surrogate.
+	if (codePoint >= 0xD800 && codePoint <= 0xDBFF && match("\\u", 2))
 	{
-		return VK_FALSE;
-	}
+		uint32_t lowSurrogate;
 
-	while (tempIndex < jsonText.length())
-	{
-		if (!decodeDigit(tempIndex, characters, tempValue) && !decodeHexadecimalDigit(tempIndex, characters, tempValue))
+		if (!decodeHexadecimalNumber(lowSurrogate))
 		{
 			return VK_FALSE;
 		}
 
-		value = value * 16 + tempValue;
-	}
+		if (lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF)
+		{
+			codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+		}
+		else
+		{
+			jsonAppendUtf8(value, codePoint);
 
-	characters += static_cast<char>(value & 0xFF);
+			codePoint = lowSurrogate;
+		}
+	}
 
-	index = tempIndex;
+	jsonAppendUtf8(value, codePoint);
 
 	return VK_TRUE;
 }
 
 //
 
-VkBool32 JsonDecoder::decodeObject(uint32_t& index, JSONobjectSP& jsonObject)
+VkBool32 JsonDecoder::decodeObject()
 {
-	JSONobjectSP tempJsonObject = JSONobjectSP(new JSONobject());
-
-	uint32_t tempIndex = index;
-
-	VkBool32 loop = VK_TRUE;
-
-	while (decodeWhitespace(tempIndex));
-
-	if (!decodeLeftCurlyBracket(tempIndex))
+	if (!match('{') || !jsonHandler->startObject())
 	{
 		return VK_FALSE;
 	}
 
-	while (decodeWhitespace(tempIndex));
+	decodeWhitespace();
 
-	if (decodeRightCurlyBracket(tempIndex))
+	if (!match('}'))
 	{
-		//
-	}
-	else
-	{
-		while (decodeWhitespace(tempIndex));
-
-		while (loop)
+		do
 		{
-			JSONstringSP jsonString;
-			JSONvalueSP jsonValue;
-
-			loop = VK_FALSE;
+			decodeWhitespace();
 
-			if (!decodeString(tempIndex, jsonString))
+			if (!decodeString(characters) || !jsonHandler->key(characters))
 			{
 				return VK_FALSE;
 			}
 
-			while (decodeWhitespace(tempIndex));
+			decodeWhitespace();
 
-			if (!decodeColon(tempIndex))
+			if (!match(':'))
 			{
 				return VK_FALSE;
 			}
 
-			while (decodeWhitespace(tempIndex));
-
-			if (!decodeValue(tempIndex, jsonValue))
+			if (!decodeValue())
 			{
 				return VK_FALSE;
 			}
 
-			tempJsonObject->addKeyValue(jsonString->getValue(), jsonValue);
-
-			while (decodeWhitespace(tempIndex));
-
-			if (decodeComma(tempIndex))
-			{
-				loop = VK_TRUE;
-			}
-
-			while (decodeWhitespace(tempIndex));
+			decodeWhitespace();
 		}
+		while (match(','));
 
-		if (!decodeRightCurlyBracket(tempIndex))
+		if (!match('}'))
 		{
 			return VK_FALSE;
 		}
 	}
 
-	while (decodeWhitespace(tempIndex));
-
-	jsonObject = tempJsonObject;
-
-	index = tempIndex;
-
-	return VK_TRUE;
+	return jsonHandler->endObject();
 }
 
-VkBool32 JsonDecoder::decodeArray(uint32_t& index, JSONarraySP& jsonArray)
+VkBool32 JsonDecoder::decodeArray()
 {
-	JSONarraySP tempJsonArray = JSONarraySP(new JSONarray());
-
-	uint32_t tempIndex = index;
-
-	VkBool32 loop = VK_TRUE;
-
-	while (decodeWhitespace(tempIndex));
-
-	if (!decodeLeftSquareBracket(tempIndex))
+	if (!match('[') || !jsonHandler->startArray())
 	{
 		return VK_FALSE;
 	}
 
-	while (decodeWhitespace(tempIndex));
+	decodeWhitespace();
 
-	if (decodeRightSquareBracket(tempIndex))
-	{
-		//
-	}
-	else
+	if (!match(']'))
 	{
-		while (decodeWhitespace(tempIndex));
-
-		while (loop)
+		do
 		{
-			JSONvalueSP jsonValue;
-
-			loop = VK_FALSE;
-
-			if (!decodeValue(tempIndex, jsonValue))
+			if (!decodeValue())
 			{
 				return VK_FALSE;
 			}
 
-			tempJsonArray->addValue(jsonValue);
-
-			while (decodeWhitespace(tempIndex));
-
-			if (decodeComma(tempIndex))
-			{
-				loop = VK_TRUE;
-			}
-
-			while (decodeWhitespace(tempIndex));
+			decodeWhitespace();
 		}
+		while (match(','));
 
-		if (!decodeRightSquareBracket(tempIndex))
+		if (!match(']'))
 		{
 			return VK_FALSE;
 		}
 	}
 
-	while (decodeWhitespace(tempIndex));
-
-	jsonArray = tempJsonArray;
-
-	index = tempIndex;
-
-	return VK_TRUE;
+	return jsonHandler->endArray();
 }
 
-VkBool32 JsonDecoder::decodeNumber(uint32_t& index, JSONnumberSP& jsonNumber)
+VkBool32 JsonDecoder::decodeNumber()
 {
-	std::string tempString = "";
-	int32_t dummy;
+	const char* start = current;
 
-	uint32_t tempIndex = index;
+	VkBool32 negative = match('-');
 
-	VkBool32 isFloat = VK_FALSE;
+	const char* digitsStart = current;
 
-	while (decodeWhitespace(tempIndex));
+	// Up to 19 significant digits do fit into the mantissa.
+	uint64_t mantissa = 0;
+	int32_t digits = 0;
+	int32_t exponent = 0;
 
-	if (decodeMinus(tempIndex, tempString))
-	{
-		//
-	}
+	VkBool32 truncated = VK_FALSE;
 
-	if (decodeDigit_0(tempIndex, tempString, dummy))
+	VkBool32 isFloat = VK_FALSE;
+
+	if (match('0'))
 	{
 		//
 	}
-	else if (decodeDigit_1_9(tempIndex, tempString, dummy))
+	else if (current < end && *current >= '1' && *current <= '9')
 	{
-		VkBool32 loop = VK_TRUE;
-
-		while (loop)
+		while (current < end && jsonIsDigit(*current))
 		{
-			loop = decodeDigit(tempIndex, tempString, dummy);
+			if (digits < 19)
+			{
+				mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+				digits++;
+			}
+			else
+			{
+				// Digits beyond the precision only scale the mantissa.
+				exponent++;
+
+				truncated = VK_TRUE;
+			}
+
+			current++;
 		}
 	}
 	else
 	{
+		current = start;
+
 		return VK_FALSE;
 	}
 
-	if (decodePoint(tempIndex, tempString))
+	if (match('.'))
 	{
 		isFloat = VK_TRUE;
 
-		VkBool32 loop = VK_TRUE;
-
-		if (!decodeDigit(tempIndex, tempString, dummy))
+		if (current >= end || !jsonIsDigit(*current))
 		{
 			return VK_FALSE;
 		}
 
-		while (loop)
+		while (current < end && jsonIsDigit(*current))
 		{
-			loop = decodeDigit(tempIndex, tempString, dummy);
+			if (digits < 19)
+			{
+				mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+
+				// Leading zeros are not significant.
+				if (mantissa > 0)
+				{
+					digits++;
+				}
+
+				exponent--;
+			}
+			else
+			{
+				truncated = VK_TRUE;
+			}
+
+			current++;
 		}
 	}
 
-	if (decodeExponent(tempIndex, tempString))
+	if (match('e') || match('E'))
 	{
-		VkBool32 loop = VK_TRUE;
+		isFloat = VK_TRUE;
+
+		int32_t exponentSign = 1;
 
-		if (decodePlus(tempIndex, tempString) || decodeMinus(tempIndex, tempString))
+		if (match('-'))
 		{
-			//
+			exponentSign = -1;
+		}
+		else
+		{
+			match('+');
 		}
 
-		if (!decodeDigit(tempIndex, tempString, dummy))
+		if (current >= end || !jsonIsDigit(*current))
 		{
 			return VK_FALSE;
 		}
 
-		while (loop)
+		int32_t exponentValue = 0;
+
+		while (current < end && jsonIsDigit(*current))
 		{
-			loop = decodeDigit(tempIndex, tempString, dummy);
+			if (exponentValue < 100000)
+			{
+				exponentValue = exponentValue * 10 + (int32_t)(*current - '0');
+			}
+
+			current++;
 		}
+
+		exponent += exponentSign * exponentValue;
 	}
 
-	while (decodeWhitespace(tempIndex));
+	// Integers beyond the range are passed as float instead of wrapping around.
+
+	if (!isFloat && (exponent > 0 || mantissa > (negative ? 2147483648ull : 2147483647ull)))
+	{
+		isFloat = VK_TRUE;
+	}
 
 	if (isFloat)
 	{
-		jsonNumber = JSONfloatSP(new JSONfloat(tempString));
+		// Not using strtod, as it depends on the locale.
+
+		const float value = parseDecimalFloat(digitsStart, current, mantissa, exponent, truncated);
+
+		return jsonHandler->floatValue(negative ? -value : value);
 	}
 	else
 	{
-		jsonNumber = JSONintegerSP(new JSONinteger(tempString));
-	}
+		int64_t value = negative ? -(int64_t)mantissa : (int64_t)mantissa;
 
-	index = tempIndex;
-
-	return VK_TRUE;
+		return jsonHandler->integerValue(static_cast<int32_t>(value));
+	}
 }
 
-VkBool32 JsonDecoder::decodeString(uint32_t& index, JSONstringSP& jsonString)
+VkBool32 JsonDecoder::decodeString(std::string& value)
 {
-	std::string dummyString = "";
-	std::string tempString = "";
-
-	uint32_t tempIndex = index;
-
-	VkBool32 loop = VK_TRUE;
-
-	while (decodeWhitespace(tempIndex));
+	value.clear();
 
-	if (!decodeQuotationMark(tempIndex, dummyString))
+	if (!match('"'))
 	{
 		return VK_FALSE;
 	}
 
-	while (loop)
+	while (VK_TRUE)
 	{
-		loop = VK_FALSE;
+		const char* next = jsonFindStringEnd(current, end);
 
-		if (decodeQuotationMark(tempIndex, dummyString))
+		value.append(current, next - current);
+
+		current = next;
+
+		if (current >= end)
 		{
-			break;
+			return VK_FALSE;
 		}
 
-		if (decodeReverseSolidus(tempIndex, tempString))
+		if (match('"'))
 		{
-			if (decodeQuotationMark(tempIndex, tempString) || decodeReverseSolidus(tempIndex, tempString) || decodeSolidus(tempIndex, tempString) || decodeBackspace(tempIndex, tempString) || decodeSolidus(tempIndex, tempString) || decodeFormFeed(tempIndex, tempString) || decodeLineFeed(tempIndex, tempString) || decodeCarriageReturn(tempIndex, tempString) || decodeCharacterTabulation(tempIndex, tempString) || decodeHexadecimalNumber(tempIndex, tempString))
-			{
-				loop = VK_TRUE;
-			}
-			else
-			{
-				return VK_FALSE;
-			}
+			return VK_TRUE;
 		}
-		else
-		{
-			tempString += jsonText.substr(tempIndex, 1);
 
-			if (tempIndex + 1 < jsonText.length())
-			{
-				tempIndex++;
+		// Reverse solidus.
+		current++;
 
-				loop = VK_TRUE;
-			}
-			else
-			{
+		if (current >= end)
+		{
+			return VK_FALSE;
+		}
+
+		switch (*current++)
+		{
+			case '"':
+				value += '"';
+				break;
+			case '\\':
+				value += '\\';
+				break;
+			case '/':
+				value += '/';
+				break;
+			case 'b':
+				value += '\b';
+				break;
+			case 'f':
+				value += '\f';
+				break;
+			case 'n':
+				value += '\n';
+				break;
+			case 'r':
+				value += '\r';
+				break;
+			case 't':
+				value += '\t';
+				break;
+			case 'u':
+				if (!decodeUnicode(value))
+				{
+					return VK_FALSE;
+				}
+				break;
+			default:
 				return VK_FALSE;
-			}
 		}
 	}
 
-	while (decodeWhitespace(tempIndex));
-
-	jsonString = JSONstringSP(new JSONstring(tempString));
-
-	index = tempIndex;
-
-	return VK_TRUE;
+	return VK_FALSE;
 }
 
+//
 
-VkBool32 JsonDecoder::decodeTrue(uint32_t& index, JSONtrueSP& jsonTrue)
+VkBool32 JsonDecoder::skipString()
 {
-	VkBool32 result;
-
-	while (decodeWhitespace(index));
-
-	result = match(JSON_true, index);
-
-	while (decodeWhitespace(index));
-
-	if (result)
+	if (!match('"'))
 	{
-		jsonTrue = JSONtrueSP(new JSONtrue());
+		return VK_FALSE;
 	}
 
-	return result;
-}
-
-VkBool32 JsonDecoder::decodeFalse(uint32_t& index, JSONfalseSP& jsonFalse)
-{
-	VkBool32 result;
-
-	while (decodeWhitespace(index));
+	while (VK_TRUE)
+	{
+		current = jsonFindStringEnd(current, end);
 
-	result = match(JSON_false, index);
+		if (current >= end)
+		{
+			return VK_FALSE;
+		}
 
-	while (decodeWhitespace(index));
+		if (match('"'))
+		{
+			return VK_TRUE;
+		}
 
-	if (result)
-	{
-		jsonFalse = JSONfalseSP(new JSONfalse());
+		// Reverse solidus and the escaped character.
+		current += 2;
 	}
 
-	return result;
+	return VK_FALSE;
 }
 
-VkBool32 JsonDecoder::decodeNull(uint32_t& index, JSONnullSP& jsonNull)
+VkBool32 JsonDecoder::skipValue()
 {
-	VkBool32 result;
+	// Only strings and brackets are tracked, so the skipped value is not validated.
 
-	while (decodeWhitespace(index));
+	uint32_t depth = 0;
 
-	result =  match(JSON_null, index);
+	do
+	{
+		decodeWhitespace();
 
-	while (decodeWhitespace(index));
+		if (current >= end)
+		{
+			return VK_FALSE;
+		}
 
-	if (result)
-	{
-		jsonNull = JSONnullSP(new JSONnull());
+		switch (*current)
+		{
+			case '"':
+				if (!skipString())
+				{
+					return VK_FALSE;
+				}
+				break;
+			case '{':
+			case '[':
+				depth++;
+				current++;
+				break;
+			case '}':
+			case ']':
+				if (depth == 0)
+				{
+					return VK_FALSE;
+				}
+				depth--;
+				current++;
+				break;
+			default:
+				current++;
+
+				if (depth == 0)
+				{
+					while (current < end && *current != ',' && *current != '}' && *current != ']' && !jsonIsWhitespace(*current))
+					{
+						current++;
+					}
+				}
+				break;
+		}
 	}
+	while (depth > 0);
 
-	return result;
+	return VK_TRUE;
 }
 
 //
 
-VkBool32 JsonDecoder::decodeValue(uint32_t& index, JSONvalueSP& jsonValue)
+VkBool32 JsonDecoder::decodeValue()
 {
-	JSONobjectSP jsonObject;
-	JSONarraySP jsonArray;
-	JSONnumberSP jsonNumber;
-	JSONstringSP jsonString;
-	JSONtrueSP jsonTrue;
-	JSONfalseSP jsonFalse;
-	JSONnullSP jsonNull;
-
-	jsonValue = JSONvalueSP();
-
-	while (decodeWhitespace(index));
+	decodeWhitespace();
 
-	if (decodeObject(index, jsonObject))
+	if (current >= end)
 	{
-		jsonValue = jsonObject;
-	}
-	else if (decodeArray(index, jsonArray))
-	{
-		jsonValue = jsonArray;
-	}
-	else if (decodeNumber(index, jsonNumber))
-	{
-		jsonValue = jsonNumber;
-	}
-	else if (decodeString(index, jsonString))
-	{
-		jsonValue = jsonString;
-	}
-	else if (decodeTrue(index, jsonTrue))
-	{
-		jsonValue = jsonTrue;
+		return VK_FALSE;
 	}
-	else if (decodeFalse(index, jsonFalse))
+
+	if (jsonHandler->skipValue())
 	{
-		jsonValue = jsonFalse;
+		const char* begin = current;
+
+		if (!skipValue())
+		{
+			return VK_FALSE;
+		}
+
+		return jsonHandler->skippedValue(begin, (uint64_t)(current - begin));
 	}
-	else if (decodeNull(index, jsonNull))
+
+	switch (*current)
 	{
-		jsonValue = jsonNull;
-	}
+		case '{':
+			return decodeObject();
+		case '[':
+			return decodeArray();
+		case '"':
+			if (!decodeString(characters))
+			{
+				return VK_FALSE;
+			}
+
+			return jsonHandler->stringValue(characters);
+		case 't':
+			if (!match("true", 4))
+			{
+				return VK_FALSE;
+			}
 
-	while (decodeWhitespace(index));
+			return jsonHandler->trueValue();
+		case 'f':
+			if (!match("false", 5))
+			{
+				return VK_FALSE;
+			}
 
-	return jsonValue.get() != nullptr;
+			return jsonHandler->falseValue();
+		case 'n':
+			if (!match("null", 4))
+			{
+				return VK_FALSE;
+			}
+
+			return jsonHandler->nullValue();
+	}
+
+	return decodeNumber();
 }
 
 //
 
-JSONvalueSP JsonDecoder::decode(const std::string& jsonText)
+VkBool32 JsonDecoder::decode(const char* jsonText, const uint64_t length, JsonHandler& jsonHandler)
 {
-	this->jsonText = jsonText;
-
-	uint32_t index = 0;
-	JSONvalueSP jsonValue;
-
-	if (!decodeValue(index, jsonValue))
+	if (!jsonText)
 	{
-		return JSONvalueSP();
+		return VK_FALSE;
 	}
 
-	return jsonValue;
+	current = jsonText;
+	end = jsonText + length;
+
+	this->jsonHandler = &jsonHandler;
+
+	VkBool32 result = decodeValue();
+
+	current = nullptr;
+	end = nullptr;
+
+	this->jsonHandler = nullptr;
+
+	return result;
 }
 
 }
@@ -39,69 +39,51 @@ class JsonDecoder
 
 private:
 
-	std::string jsonText;
+	const char* current;
+	const char* end;
 
-	//
+	JsonHandler* jsonHandler;
 
-	VkBool32 match(const std::string& token, uint32_t& index);
+	// Reused for all keys and string values, so characters are not appended to a new string every time.
+	std::string characters;
 
 	//
 
-	VkBool32 decodeWhitespace(uint32_t& index);
-
-	//
+	void decodeWhitespace();
 
-	VkBool32 decodeLeftSquareBracket(uint32_t& index);
-	VkBool32 decodeLeftCurlyBracket(uint32_t& index);
-	VkBool32 decodeRightSquareBracket(uint32_t& index);
-	VkBool32 decodeRightCurlyBracket(uint32_t& index);
-	VkBool32 decodeColon(uint32_t& index);
-	VkBool32 decodeComma(uint32_t& index);
+	VkBool32 match(const char token);
+	VkBool32 match(const char* token, const size_t length);
 
 	//
 
-	VkBool32 decodePlus(uint32_t& index, std::string& characters);
-	VkBool32 decodeMinus(uint32_t& index, std::string& characters);
-	VkBool32 decodePoint(uint32_t& index, std::string& characters);
+	VkBool32 decodeHexadecimalNumber(uint32_t& value);
+	VkBool32 decodeUnicode(std::string& value);
 
-	VkBool32 decodeHexadecimalDigit(uint32_t& index, std::string& characters, int32_t& value);
-
-	VkBool32 decodeDigit_0(uint32_t& index, std::string& characters, int32_t& value);
-	VkBool32 decodeDigit_1_9(uint32_t& index, std::string& characters, int32_t& value);
-	VkBool32 decodeDigit(uint32_t& index, std::string& characters, int32_t& value);
-
-	VkBool32 decodeExponent(uint32_t& index, std::string& characters);
+	//
 
-	VkBool32 decodeQuotationMark(uint32_t& index, std::string& characters);
-	VkBool32 decodeReverseSolidus(uint32_t& index, std::string& characters);
-	VkBool32 decodeSolidus(uint32_t& index, std::string& characters);
-	VkBool32 decodeBackspace(uint32_t& index, std::string& characters);
-	VkBool32 decodeFormFeed(uint32_t& index, std::string& characters);
-	VkBool32 decodeLineFeed(uint32_t& index, std::string& characters);
-	VkBool32 decodeCarriageReturn(uint32_t& index, std::string& characters);
-	VkBool32 decodeCharacterTabulation(uint32_t& index, std::string& characters);
-	VkBool32 decodeHexadecimalNumber(uint32_t& index, std::string& characters);
+	VkBool32 decodeObject();
+	VkBool32 decodeArray();
+	VkBool32 decodeNumber();
+	VkBool32 decodeString(std::string& value);
 
 	//
 
-	VkBool32 decodeObject(uint32_t& index, JSONobjectSP& jsonObject);
-	VkBool32 decodeArray(uint32_t& index, JSONarraySP& jsonArray);
-	VkBool32 decodeNumber(uint32_t& index, JSONnumberSP& jsonNumber);
-	VkBool32 decodeString(uint32_t& index, JSONstringSP& jsonString);
-	VkBool32 decodeTrue(uint32_t& index, JSONtrueSP& jsonTrue);
-	VkBool32 decodeFalse(uint32_t& index, JSONfalseSP& jsonFalse);
-	VkBool32 decodeNull(uint32_t& index, JSONnullSP& jsonNull);
+	VkBool32 skipString();
+	VkBool32 skipValue();
 
 	//
 
-	VkBool32 decodeValue(uint32_t& index, JSONvalueSP& jsonValue);
+	VkBool32 decodeValue();
 
 public:
 
 	JsonDecoder();
 	~JsonDecoder();
 
-	JSONvalueSP decode(const std::string& jsonText);
+	/**
+	 * Decodes one value and passes it as events to the handler.
+	 */
+	VkBool32 decode(const char* jsonText, const uint64_t length, JsonHandler& jsonHandler);
 
 };
 
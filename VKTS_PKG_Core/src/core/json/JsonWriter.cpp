@@ -0,0 +1,561 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "fn_json_internal.hpp"
+
+#define VKTS_JSON_WRITER_BUFFER_SIZE 65536
+
+namespace vkts
+{
+
+static const char g_hexDigits[] = "0123456789abcdef";
+
+// Exactly representable as double.
+static const double g_powerOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static double jsonScaleDecimal(const double mantissa, const int32_t exponent)
+{
+	double value = mantissa;
+
+	int32_t remaining = exponent;
+
+	// Larger exponents are applied in steps of exact powers, which is precise enough to find the digit candidates.
+
+	while (remaining > 22 && value != 0.0 && !std::isinf(value))
+	{
+		value *= g_powerOfTen[22];
+
+		remaining -= 22;
+	}
+
+	while (remaining < -22 && value != 0.0)
+	{
+		value /= g_powerOfTen[22];
+
+		remaining += 22;
+	}
+
+	if (remaining > 22 || remaining < -22)
+	{
+		return value;
+	}
+
+	return remaining < 0 ? value / g_powerOfTen[-remaining] : value * g_powerOfTen[remaining];
+}
+
+static char* jsonFormatDigits(char* buffer, uint64_t digits)
+{
+	char reverse[20];
+	uint32_t length = 0;
+
+	do
+	{
+		reverse[length++] = (char)('0' + digits % 10);
+
+		digits /= 10;
+	} while (digits > 0);
+
+	while (length > 0)
+	{
+		*buffer++ = reverse[--length];
+	}
+
+	return buffer;
+}
+
+char* VKTS_APIENTRY _jsonFormatInteger(char* buffer, const int32_t value)
+{
+	uint64_t digits = (uint64_t)(value < 0 ? -(int64_t)value : (int64_t)value);
+
+	if (value < 0)
+	{
+		*buffer++ = '-';
+	}
+
+	return jsonFormatDigits(buffer, digits);
+}
+
+char* VKTS_APIENTRY _jsonFormatFloat(char* buffer, const float value)
+{
+	if (!std::isfinite(value))
+	{
+		// Not representable in JSON.
+
+		memcpy(buffer, "null", 4);
+
+		return buffer + 4;
+	}
+
+	if (std::signbit(value))
+	{
+		*buffer++ = '-';
+	}
+
+	const float absValue = fabsf(value);
+
+	if (absValue == 0.0f)
+	{
+		memcpy(buffer, "0.0", 3);
+
+		return buffer + 3;
+	}
+
+	const double doubleValue = (double)absValue;
+
+	const int32_t exponent = (int32_t)floor(log10(doubleValue));
+
+	// Search the least digits, which are converted back to the same float.
+	// The check uses the same conversion as the decoder, so written floats are read back the same.
+
+	uint64_t digits = 0;
+	int32_t scale = 0;
+
+	for (int32_t count = 1; count <= 9; count++)
+	{
+		scale = count - 1 - exponent;
+
+		digits = (uint64_t)(jsonScaleDecimal(doubleValue, scale) + 0.5);
+
+		// The decoder does see the digits without trailing zeros.
+
+		while (digits % 10 == 0 && digits > 0)
+		{
+			digits /= 10;
+
+			scale--;
+		}
+
+		// The text is only converted, if the exponent is out of the fast range.
+
+		char candidate[VKTS_JSON_NUMBER_BUFFER_SIZE];
+
+		char* candidateEnd = jsonFormatDigits(candidate, digits);
+
+		*candidateEnd++ = 'e';
+
+		candidateEnd = _jsonFormatInteger(candidateEnd, -scale);
+
+		if (parseDecimalFloat(candidate, candidateEnd, digits, -scale, VK_FALSE) == absValue)
+		{
+			break;
+		}
+
+		// Nine digits do identify every float, so the last candidate is kept in any case.
+	}
+
+	char text[20];
+	const int32_t length = (int32_t)(jsonFormatDigits(text, digits) - text);
+
+	// Exponent of the first digit.
+	const int32_t decimalExponent = length - 1 - scale;
+
+	if (decimalExponent >= 0 && decimalExponent < 15)
+	{
+		for (int32_t i = 0; i <= decimalExponent; i++)
+		{
+			*buffer++ = i < length ? text[i] : '0';
+		}
+
+		*buffer++ = '.';
+
+		if (decimalExponent + 1 < length)
+		{
+			for (int32_t i = decimalExponent + 1; i < length; i++)
+			{
+				*buffer++ = text[i];
+			}
+		}
+		else
+		{
+			*buffer++ = '0';
+		}
+	}
+	else if (decimalExponent < 0 && decimalExponent >= -5)
+	{
+		*buffer++ = '0';
+		*buffer++ = '.';
+
+		for (int32_t i = decimalExponent + 1; i < 0; i++)
+		{
+			*buffer++ = '0';
+		}
+
+		memcpy(buffer, text, length);
+
+		buffer += length;
+	}
+	else
+	{
+		*buffer++ = text[0];
+
+		if (length > 1)
+		{
+			*buffer++ = '.';
+
+			memcpy(buffer, text + 1, length - 1);
+
+			buffer += length - 1;
+		}
+
+		*buffer++ = 'e';
+
+		buffer = _jsonFormatInteger(buffer, decimalExponent);
+	}
+
+	return buffer;
+}
+
+JsonWriter::JsonWriter(const VkBool32 compact) :
+	JsonWriter(nullptr, compact)
+{
+}
+
+JsonWriter::JsonWriter(FILE* file, const VkBool32 compact) :
+	JsonHandler(), file(file), compact(compact), text(), allObjects(), allCounts(), hasKey(VK_FALSE)
+{
+	if (file)
+	{
+		text.reserve(VKTS_JSON_WRITER_BUFFER_SIZE + VKTS_JSON_WRITER_BUFFER_SIZE / 4);
+	}
+}
+
+JsonWriter::~JsonWriter()
+{
+	flush();
+}
+
+VkBool32 JsonWriter::startValue()
+{
+	if (allObjects.size() == 0)
+	{
+		return VK_TRUE;
+	}
+
+	if (allObjects.back())
+	{
+		// Values of an object always follow their key.
+
+		if (!hasKey)
+		{
+			return VK_FALSE;
+		}
+
+		hasKey = VK_FALSE;
+
+		return VK_TRUE;
+	}
+
+	startElement();
+
+	return VK_TRUE;
+}
+
+void JsonWriter::startElement()
+{
+	if (allCounts.back() > 0)
+	{
+		text += ',';
+	}
+
+	if (!compact)
+	{
+		text += '\n';
+		text.append(VKTS_JSON_TAB_STEP * allObjects.size(), ' ');
+	}
+
+	allCounts.back()++;
+}
+
+void JsonWriter::writeString(const std::string& value)
+{
+	text += '"';
+
+	const char* start = value.c_str();
+	const char* current = start;
+	const char* end = start + value.length();
+
+	while (current < end)
+	{
+		const unsigned char character = (unsigned char)*current;
+
+		if (character >= 0x20 && character != '"' && character != '\\' && character != '/')
+		{
+			current++;
+
+			continue;
+		}
+
+		text.append(start, current - start);
+
+		text += '\\';
+
+		switch (character)
+		{
+			case '"':
+			case '\\':
+			case '/':
+				text += (char)character;
+				break;
+			case '\b':
+				text += 'b';
+				break;
+			case '\f':
+				text += 'f';
+				break;
+			case '\n':
+				text += 'n';
+				break;
+			case '\r':
+				text += 'r';
+				break;
+			case '\t':
+				text += 't';
+				break;
+			default:
+				text += "u00";
+				text += g_hexDigits[character >> 4];
+				text += g_hexDigits[character & 0x0F];
+				break;
+		}
+
+		current++;
+
+		start = current;
+	}
+
+	text.append(start, current - start);
+
+	text += '"';
+}
+
+VkBool32 JsonWriter::endValue()
+{
+	if (file && text.size() >= VKTS_JSON_WRITER_BUFFER_SIZE)
+	{
+		return flush();
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonWriter::endContainer(const VkBool32 isObject)
+{
+	if (allObjects.size() == 0 || allObjects.back() != isObject || hasKey)
+	{
+		return VK_FALSE;
+	}
+
+	const uint32_t count = allCounts.back();
+
+	allObjects.pop_back();
+	allCounts.pop_back();
+
+	if (!compact && count > 0)
+	{
+		text += '\n';
+		text.append(VKTS_JSON_TAB_STEP * allObjects.size(), ' ');
+	}
+
+	text += isObject ? '}' : ']';
+
+	return endValue();
+}
+
+const std::string& JsonWriter::getText() const
+{
+	return text;
+}
+
+void JsonWriter::reset()
+{
+	text.clear();
+
+	allObjects.clear();
+	allCounts.clear();
+
+	hasKey = VK_FALSE;
+}
+
+VkBool32 JsonWriter::flush()
+{
+	if (!file || text.size() == 0)
+	{
+		return VK_TRUE;
+	}
+
+	const size_t size = text.size();
+
+	const size_t written = fwrite(text.c_str(), 1, size, file);
+
+	text.clear();
+
+	return written == size ? VK_TRUE : VK_FALSE;
+}
+
+VkBool32 JsonWriter::startObject()
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	text += '{';
+
+	allObjects.push_back(VK_TRUE);
+	allCounts.push_back(0);
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonWriter::key(const std::string& key)
+{
+	if (allObjects.size() == 0 || !allObjects.back() || hasKey)
+	{
+		return VK_FALSE;
+	}
+
+	startElement();
+
+	writeString(key);
+
+	if (compact)
+	{
+		text += ':';
+	}
+	else
+	{
+		text += " : ";
+	}
+
+	hasKey = VK_TRUE;
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonWriter::endObject()
+{
+	return endContainer(VK_TRUE);
+}
+
+VkBool32 JsonWriter::startArray()
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	text += '[';
+
+	allObjects.push_back(VK_FALSE);
+	allCounts.push_back(0);
+
+	return VK_TRUE;
+}
+
+VkBool32 JsonWriter::endArray()
+{
+	return endContainer(VK_FALSE);
+}
+
+VkBool32 JsonWriter::stringValue(const std::string& value)
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	writeString(value);
+
+	return endValue();
+}
+
+VkBool32 JsonWriter::integerValue(const int32_t value)
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	char buffer[VKTS_JSON_NUMBER_BUFFER_SIZE];
+
+	text.append(buffer, _jsonFormatInteger(buffer, value) - buffer);
+
+	return endValue();
+}
+
+VkBool32 JsonWriter::floatValue(const float value)
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	char buffer[VKTS_JSON_NUMBER_BUFFER_SIZE];
+
+	text.append(buffer, _jsonFormatFloat(buffer, value) - buffer);
+
+	return endValue();
+}
+
+VkBool32 JsonWriter::trueValue()
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	text += "true";
+
+	return endValue();
+}
+
+VkBool32 JsonWriter::falseValue()
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	text += "false";
+
+	return endValue();
+}
+
+VkBool32 JsonWriter::nullValue()
+{
+	if (!startValue())
+	{
+		return VK_FALSE;
+	}
+
+	text += "null";
+
+	return endValue();
+}
+
+}
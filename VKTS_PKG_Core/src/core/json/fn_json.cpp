@@ -31,29 +31,167 @@
 namespace vkts
 {
 
+class JsonEventVisitor : public JsonVisitor
+{
+
+private:
+
+	JsonHandler& jsonHandler;
+
+	VkBool32 result;
+
+public:
+
+	JsonEventVisitor(JsonHandler& jsonHandler) :
+		JsonVisitor(), jsonHandler(jsonHandler), result(VK_TRUE)
+	{
+	}
+
+	virtual ~JsonEventVisitor()
+	{
+	}
+
+	VkBool32 getResult() const
+	{
+		return result;
+	}
+
+	virtual void visit(JSONnull& jsonNull)
+	{
+		result = jsonHandler.nullValue();
+	}
+
+	virtual void visit(JSONfalse& jsonFalse)
+	{
+		result = jsonHandler.falseValue();
+	}
+
+	virtual void visit(JSONtrue& jsonTrue)
+	{
+		result = jsonHandler.trueValue();
+	}
+
+	virtual void visit(JSONfloat& jsonFloat)
+	{
+		result = jsonHandler.floatValue(jsonFloat.getValue());
+	}
+
+	virtual void visit(JSONinteger& jsonInteger)
+	{
+		result = jsonHandler.integerValue(jsonInteger.getValue());
+	}
+
+	virtual void visit(JSONstring& jsonString)
+	{
+		result = jsonHandler.stringValue(jsonString.getValue());
+	}
+
+	virtual void visit(JSONarray& jsonArray)
+	{
+		if (!jsonHandler.startArray())
+		{
+			result = VK_FALSE;
+
+			return;
+		}
+
+		const auto& allValues = jsonArray.getAllValues();
+
+		for (uint32_t i = 0; i < allValues.size(); i++)
+		{
+			allValues[i]->visit(*this);
+
+			if (!result)
+			{
+				return;
+			}
+		}
+
+		result = jsonHandler.endArray();
+	}
+
+	virtual void visit(JSONobject& jsonObject)
+	{
+		if (!jsonHandler.startObject())
+		{
+			result = VK_FALSE;
+
+			return;
+		}
+
+		const auto& allKeyValues = jsonObject.getAllKeyValues();
+
+		for (uint32_t i = 0; i < allKeyValues.size(); i++)
+		{
+			if (!jsonHandler.key(allKeyValues.keyAt(i)))
+			{
+				result = VK_FALSE;
+
+				return;
+			}
+
+			allKeyValues.valueAt(i)->visit(*this);
+
+			if (!result)
+			{
+				return;
+			}
+		}
+
+		result = jsonHandler.endObject();
+	}
+
+};
+
 JSONvalueSP VKTS_APIENTRY jsonDecode(const std::string& jsonText)
+{
+	return jsonDecode(jsonText.c_str(), jsonText.length());
+}
+
+JSONvalueSP VKTS_APIENTRY jsonDecode(const char* jsonText, const uint64_t length)
 {
 	JsonDecoder decoder;
+	JsonBuilder builder;
 
-	return decoder.decode(jsonText);
+	if (!decoder.decode(jsonText, length, builder))
+	{
+		return JSONvalueSP();
+	}
+
+	return builder.getValue();
 }
 
-std::string VKTS_APIENTRY jsonEncode(const JSONvalueSP& value)
+VkBool32 VKTS_APIENTRY jsonRead(const char* jsonText, const uint64_t length, JsonHandler& jsonHandler)
+{
+	JsonDecoder decoder;
+
+	return decoder.decode(jsonText, length, jsonHandler);
+}
+
+VkBool32 VKTS_APIENTRY jsonWrite(const JSONvalueSP& value, JsonHandler& jsonHandler)
 {
 	if (!value.get())
 	{
-		return "";
+		return VK_FALSE;
 	}
 
-	std::string jsonText = "";
-	int32_t spaces = 0;
+	JsonEventVisitor jsonEventVisitor(jsonHandler);
+
+	value->visit(jsonEventVisitor);
+
+	return jsonEventVisitor.getResult();
+}
+
+std::string VKTS_APIENTRY jsonEncode(const JSONvalueSP& value, const VkBool32 compact)
+{
+	JsonWriter writer(compact);
 
-	if (!value->encode(jsonText, spaces))
+	if (!jsonWrite(value, writer))
 	{
 		return "";
 	}
 
-	return jsonText;
+	return writer.getText();
 }
 
 }
@@ -0,0 +1,49 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_JSON_INTERNAL_HPP_
+#define VKTS_FN_JSON_INTERNAL_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+#define VKTS_JSON_TAB_STEP 3
+
+#define VKTS_JSON_NUMBER_BUFFER_SIZE 32
+
+namespace vkts
+{
+
+/**
+ * Writes the shortest text, which is decoded to the same float. The buffer needs at least VKTS_JSON_NUMBER_BUFFER_SIZE characters.
+ * Returns the end of the written text, which is not zero terminated.
+ */
+VKTS_APICALL char* VKTS_APIENTRY _jsonFormatFloat(char* buffer, const float value);
+
+VKTS_APICALL char* VKTS_APIENTRY _jsonFormatInteger(char* buffer, const int32_t value);
+
+}
+
+#endif /* VKTS_FN_JSON_INTERNAL_HPP_ */
@@ -26,20 +26,474 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#include "fn_log_internal.hpp"
+
 namespace vkts
 {
 
 static const char* VKTS_LOG_STRINGS[] = {"", "ERROR", "WARNING", "INFO", "DEBUG", "SEVERE"};
 
+// Header of a message in the buffer of a thread. Followed by the message or the packed arguments.
+typedef struct LogRecord_
+{
+    // Size including this header, multiple of eight. Zero marks the unused end of the buffer.
+    uint32_t size;
+    int32_t verbosity;
+    int32_t lineNumber;
+    uint32_t deferred;
+    const char* fileName;
+    const char* format;
+    double time;
+} LogRecord;
+
+/**
+ * Single producer, single consumer buffer of one thread.
+ */
+typedef struct LogBuffer_
+{
+    uint32_t threadIndex;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    uint8_t data[VKTS_LOG_BUFFER_SIZE];
+} LogBuffer;
+
+typedef std::shared_ptr<LogBuffer> LogBufferSP;
+
+typedef struct LogMessage_
+{
+    double time;
+    int32_t verbosity;
+    uint32_t threadIndex;
+    const char* fileName;
+    int32_t lineNumber;
+    std::string text;
+} LogMessage;
+
+typedef std::shared_ptr<std::thread> ThreadSP;
+
+// Only taken, if printing synchronous, to keep the lines in one piece.
 static std::mutex g_logMutex;
 
-static int32_t g_verbosity;
+static std::atomic<int32_t> g_verbosity(VKTS_LOG_INFO);
+
+static std::atomic<VkTsLogMode> g_logMode(VKTS_LOG_MODE_SYNC);
+
+static VkTsLogPolicy g_logPolicy = VKTS_LOG_POLICY_DROP;
+
+static FILE* g_logBinaryFile = nullptr;
+
+static const std::chrono::steady_clock::time_point g_logStartTime = std::chrono::steady_clock::now();
+
+static std::atomic<uint32_t> g_logThreadCount(0);
+
+static thread_local int32_t g_logThreadIndex = -1;
+
+// Buffers
+
+static std::mutex g_logBufferMutex;
+
+static std::vector<LogBufferSP> g_logBuffers;
+
+static std::atomic<uint32_t> g_logBufferGeneration(0);
+
+static thread_local LogBufferSP g_logBuffer;
+
+static thread_local uint32_t g_logBufferThreadGeneration = 0;
+
+// Background thread
+
+static ThreadSP g_logDrainThread;
+
+static std::atomic<VkBool32> g_logDrainRun(VK_FALSE);
+
+static std::atomic<VkBool32> g_logDrainParked(VK_FALSE);
+
+static std::mutex g_logDrainMutex;
+
+static std::condition_variable g_logDrainConditionVariable;
+
+static std::condition_variable g_logDrainedConditionVariable;
+
+// Statistics and rate limit
+
+static std::atomic<uint64_t> g_logDroppedCount(0);
+
+static std::atomic<uint64_t> g_logRateLimitedCount(0);
+
+static std::atomic<uint32_t> g_logRateLimit(0);
+
+// Upper 32 bits are the second, lower 32 bits the number of messages in this second.
+static std::atomic<uint64_t> g_logRateLimitSlots[VKTS_LOG_RATE_LIMIT_SLOTS];
 
 static const char* logGetFilename(const char* fileName)
 {
 	return strrchr(fileName, '/') ? strrchr(fileName, '/') + 1 : (strrchr(fileName, '\\') ? strrchr(fileName, '\\') + 1 : fileName);
 }
 
+static double logGetTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - g_logStartTime).count();
+}
+
+static uint32_t logGetThreadIndex()
+{
+    if (g_logThreadIndex < 0)
+    {
+        g_logThreadIndex = (int32_t) g_logThreadCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return (uint32_t) g_logThreadIndex;
+}
+
+static VkBool32 logIsRateLimited(const char* fileName, const int32_t lineNumber, const double time)
+{
+    uint32_t rateLimit = g_logRateLimit.load(std::memory_order_relaxed);
+
+    if (rateLimit == 0)
+    {
+        return VK_FALSE;
+    }
+
+    // Call sites sharing a slot share the limit.
+
+    uint64_t hash = (uint64_t) (uintptr_t) fileName * 31 + (uint64_t) lineNumber;
+    hash ^= hash >> 17;
+
+    auto& slot = g_logRateLimitSlots[hash % VKTS_LOG_RATE_LIMIT_SLOTS];
+
+    uint64_t second = (uint64_t) time;
+
+    uint64_t oldValue = slot.load(std::memory_order_relaxed);
+    uint64_t newValue;
+
+    do
+    {
+        if ((oldValue >> 32) != second)
+        {
+            newValue = (second << 32) | 1;
+        }
+        else if ((oldValue & 0xFFFFFFFF) < rateLimit)
+        {
+            newValue = oldValue + 1;
+        }
+        else
+        {
+            return VK_TRUE;
+        }
+    }
+    while (!slot.compare_exchange_weak(oldValue, newValue, std::memory_order_relaxed));
+
+    return VK_FALSE;
+}
+
+static void logWriteMessage(const LogMessage& message)
+{
+    if (g_logBinaryFile)
+    {
+        const char* fileName = logGetFilename(message.fileName);
+
+        uint32_t fileNameLength = (uint32_t) strlen(fileName);
+        uint32_t textLength = (uint32_t) message.text.size();
+
+        fwrite(&message.time, sizeof(double), 1, g_logBinaryFile);
+        fwrite(&message.verbosity, sizeof(int32_t), 1, g_logBinaryFile);
+        fwrite(&message.threadIndex, sizeof(uint32_t), 1, g_logBinaryFile);
+        fwrite(&message.lineNumber, sizeof(int32_t), 1, g_logBinaryFile);
+        fwrite(&fileNameLength, sizeof(uint32_t), 1, g_logBinaryFile);
+        fwrite(fileName, 1, fileNameLength, g_logBinaryFile);
+        fwrite(&textLength, sizeof(uint32_t), 1, g_logBinaryFile);
+        fwrite(message.text.c_str(), 1, textLength, g_logBinaryFile);
+
+        return;
+    }
+
+    const char* logString = "UNKNOWN";
+
+    if (message.verbosity > VKTS_LOG_NOTHING && message.verbosity <= VKTS_LOG_SEVERE)
+    {
+        logString = VKTS_LOG_STRINGS[message.verbosity];
+    }
+
+    VKTS_PRINTF("VKTS log [%s] in '%s' at %d: %s\n", logString, logGetFilename(message.fileName), message.lineNumber, message.text.c_str());
+}
+
+//
+// Buffers
+//
+
+static LogBuffer* logGetBuffer()
+{
+    uint32_t generation = g_logBufferGeneration.load(std::memory_order_acquire);
+
+    if (!g_logBuffer.get() || g_logBufferThreadGeneration != generation)
+    {
+        // Only once per thread. Buffers stay alive, so messages of finished threads are still printed.
+
+        auto buffer = LogBufferSP(new LogBuffer());
+
+        buffer->threadIndex = logGetThreadIndex();
+        buffer->head = 0;
+        buffer->tail = 0;
+
+        std::lock_guard<std::mutex> logBufferLockGuard(g_logBufferMutex);
+
+        g_logBuffers.push_back(buffer);
+
+        g_logBuffer = buffer;
+        g_logBufferThreadGeneration = generation;
+    }
+
+    return g_logBuffer.get();
+}
+
+static void logWakeDrain()
+{
+    if (g_logDrainParked.load())
+    {
+        std::lock_guard<std::mutex> logDrainLockGuard(g_logDrainMutex);
+
+        g_logDrainConditionVariable.notify_one();
+    }
+}
+
+// Returns the record to be filled or nullptr, if the message has to be dropped.
+static LogRecord* logReserve(LogBuffer& buffer, const uint32_t size)
+{
+    uint64_t head = buffer.head.load(std::memory_order_relaxed);
+
+    // The record has to be contiguous, so the end of the buffer might be skipped.
+
+    uint32_t contiguous = VKTS_LOG_BUFFER_SIZE - (uint32_t) (head % VKTS_LOG_BUFFER_SIZE);
+
+    uint32_t skip = contiguous < size ? contiguous : 0;
+
+    while (head + skip + size - buffer.tail.load(std::memory_order_acquire) > VKTS_LOG_BUFFER_SIZE)
+    {
+        if (g_logPolicy == VKTS_LOG_POLICY_DROP || !g_logDrainRun.load())
+        {
+            g_logDroppedCount.fetch_add(1, std::memory_order_relaxed);
+
+            return nullptr;
+        }
+
+        logWakeDrain();
+
+        std::unique_lock<std::mutex> logDrainUniqueLock(g_logDrainMutex);
+
+        g_logDrainedConditionVariable.wait_for(logDrainUniqueLock, std::chrono::duration<double>(VKTS_LOG_DRAIN_WAIT));
+    }
+
+    if (skip)
+    {
+        // Marks the rest as unused, if there is space for the size field.
+
+        if (skip >= sizeof(uint32_t))
+        {
+            *reinterpret_cast<uint32_t*>(&buffer.data[head % VKTS_LOG_BUFFER_SIZE]) = 0;
+        }
+
+        head += skip;
+
+        buffer.head.store(head, std::memory_order_release);
+    }
+
+    return reinterpret_cast<LogRecord*>(&buffer.data[head % VKTS_LOG_BUFFER_SIZE]);
+}
+
+static void logCommit(LogBuffer& buffer, const LogRecord& record)
+{
+    buffer.head.store(buffer.head.load(std::memory_order_relaxed) + record.size, std::memory_order_release);
+
+    logWakeDrain();
+}
+
+static void logEnqueue(const int32_t verbosity, const char* fileName, const int32_t lineNumber, const double time, const char* format, va_list argList)
+{
+    auto buffer = logGetBuffer();
+
+    const uint32_t maxPayload = VKTS_MAX_LOG_CHARS + 1;
+    const uint32_t maxSize = (uint32_t) ((sizeof(LogRecord) + maxPayload + 7) & ~(size_t) 7);
+
+    // Reserve for the largest message, as the size is only known after writing.
+
+    auto record = logReserve(*buffer, maxSize);
+
+    if (!record)
+    {
+        return;
+    }
+
+    uint8_t* payload = reinterpret_cast<uint8_t*>(record) + sizeof(LogRecord);
+
+    int32_t payloadSize = -1;
+
+    record->deferred = VK_FALSE;
+
+    if (g_logMode.load(std::memory_order_relaxed) == VKTS_LOG_MODE_ASYNC_DEFERRED)
+    {
+        payloadSize = _logPackArguments(payload, maxPayload, format, argList);
+
+        record->deferred = payloadSize >= 0;
+    }
+
+    if (payloadSize < 0)
+    {
+        // Formatting on the calling thread, which is still cheaper than printing.
+
+        char* text = reinterpret_cast<char*>(payload);
+
+        text[VKTS_MAX_LOG_CHARS] = '\0';
+
+        vsnprintf(text, VKTS_MAX_LOG_CHARS, format, argList);
+
+        payloadSize = (int32_t) strlen(text) + 1;
+    }
+
+    record->size = (uint32_t) ((sizeof(LogRecord) + payloadSize + 7) & ~(size_t) 7);
+    record->verbosity = verbosity;
+    record->lineNumber = lineNumber;
+    record->fileName = fileName;
+    record->format = format;
+    record->time = time;
+
+    logCommit(*buffer, *record);
+}
+
+// Returns VK_TRUE, if any message was printed.
+static VkBool32 logDrain()
+{
+    std::vector<LogBufferSP> allBuffers;
+
+    {
+        std::lock_guard<std::mutex> logBufferLockGuard(g_logBufferMutex);
+
+        allBuffers = g_logBuffers;
+    }
+
+    std::vector<LogMessage> allMessages;
+
+    char text[VKTS_MAX_LOG_CHARS + 1];
+
+    for (const auto& buffer : allBuffers)
+    {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+
+        while (tail < head)
+        {
+            uint32_t contiguous = VKTS_LOG_BUFFER_SIZE - (uint32_t) (tail % VKTS_LOG_BUFFER_SIZE);
+
+            const LogRecord* record = reinterpret_cast<const LogRecord*>(&buffer->data[tail % VKTS_LOG_BUFFER_SIZE]);
+
+            // Unused end of the buffer.
+            if (contiguous < sizeof(LogRecord) || record->size == 0)
+            {
+                tail += contiguous;
+
+                continue;
+            }
+
+            const uint8_t* payload = reinterpret_cast<const uint8_t*>(record) + sizeof(LogRecord);
+
+            if (record->deferred)
+            {
+                _logUnpackArguments(text, VKTS_MAX_LOG_CHARS + 1, record->format, payload, record->size - (uint32_t) sizeof(LogRecord));
+            }
+            else
+            {
+                strncpy(text, reinterpret_cast<const char*>(payload), VKTS_MAX_LOG_CHARS);
+                text[VKTS_MAX_LOG_CHARS] = '\0';
+            }
+
+            allMessages.push_back(LogMessage{record->time, record->verbosity, buffer->threadIndex, record->fileName, record->lineNumber, std::string(text)});
+
+            tail += record->size;
+        }
+
+        buffer->tail.store(tail, std::memory_order_release);
+    }
+
+    if (allMessages.size() == 0)
+    {
+        return VK_FALSE;
+    }
+
+    // Messages of all threads in the order they were logged.
+
+    std::stable_sort(allMessages.begin(), allMessages.end(), [](const LogMessage& a, const LogMessage& b) {return a.time < b.time;});
+
+    for (const auto& message : allMessages)
+    {
+        logWriteMessage(message);
+    }
+
+    if (g_logBinaryFile)
+    {
+        fflush(g_logBinaryFile);
+    }
+
+    return VK_TRUE;
+}
+
+static void logDrainRun()
+{
+    while (g_logDrainRun.load())
+    {
+        if (logDrain())
+        {
+            std::lock_guard<std::mutex> logDrainLockGuard(g_logDrainMutex);
+
+            g_logDrainedConditionVariable.notify_all();
+
+            continue;
+        }
+
+        // Nothing to print, so park. A missed wake up is only delayed by the wait time.
+
+        std::unique_lock<std::mutex> logDrainUniqueLock(g_logDrainMutex);
+
+        g_logDrainParked = VK_TRUE;
+
+        g_logDrainedConditionVariable.notify_all();
+
+        g_logDrainConditionVariable.wait_for(logDrainUniqueLock, std::chrono::duration<double>(VKTS_LOG_DRAIN_WAIT));
+
+        g_logDrainParked = VK_FALSE;
+    }
+
+    // Print the remaining messages.
+
+    logDrain();
+
+    std::lock_guard<std::mutex> logDrainLockGuard(g_logDrainMutex);
+
+    g_logDrainedConditionVariable.notify_all();
+}
+
+static void logStopDrain()
+{
+    if (!g_logDrainThread.get())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> logDrainLockGuard(g_logDrainMutex);
+
+        g_logDrainRun = VK_FALSE;
+
+        g_logDrainConditionVariable.notify_one();
+    }
+
+    g_logDrainThread->join();
+
+    g_logDrainThread = ThreadSP();
+}
+
+//
+//
+//
+
 VkBool32 VKTS_APIENTRY logInit()
 {
     return logSetLevel(VKTS_LOG_INFO);
@@ -47,8 +501,6 @@ VkBool32 VKTS_APIENTRY logInit()
 
 VkBool32 VKTS_APIENTRY logSetLevel(const int32_t verbosity)
 {
-    std::lock_guard<std::mutex> logLockGuard(g_logMutex);
-
     if (verbosity < VKTS_LOG_NOTHING || verbosity > VKTS_LOG_SEVERE)
     {
         return VK_FALSE;
@@ -61,46 +513,177 @@ VkBool32 VKTS_APIENTRY logSetLevel(const int32_t verbosity)
 
 int32_t VKTS_APIENTRY logGetLevel()
 {
-    std::lock_guard<std::mutex> logLockGuard(g_logMutex);
-
     return g_verbosity;
 }
 
 void VKTS_APIENTRY logPrint(const int32_t verbosity, const char* fileName, const int32_t lineNumber, const char* format, ...)
 {
-    std::lock_guard<std::mutex> logLockGuard(g_logMutex);
+    int32_t currentVerbosity = g_verbosity.load(std::memory_order_relaxed);
 
-    if (g_verbosity == VKTS_LOG_NOTHING || verbosity == VKTS_LOG_NOTHING)
+    if (currentVerbosity == VKTS_LOG_NOTHING || verbosity == VKTS_LOG_NOTHING || currentVerbosity < verbosity)
     {
         return;
     }
 
-    if (g_verbosity >= verbosity)
+    double time = logGetTime();
+
+    if (logIsRateLimited(fileName, lineNumber, time))
+    {
+        g_logRateLimitedCount.fetch_add(1, std::memory_order_relaxed);
+
+        return;
+    }
+
+    va_list argList;
+
+    va_start(argList, format);
+
+    if (g_logMode.load(std::memory_order_relaxed) != VKTS_LOG_MODE_SYNC)
+    {
+        logEnqueue(verbosity, fileName, lineNumber, time, format, argList);
+    }
+    else
     {
-        const char* logString = "UNKNOWN";
         char buffer[VKTS_MAX_LOG_CHARS + 1];
-        va_list argList;
 
-        if (verbosity > VKTS_LOG_NOTHING && verbosity <= VKTS_LOG_SEVERE)
+        buffer[VKTS_MAX_LOG_CHARS] = '\0';
+
+        vsnprintf(buffer, VKTS_MAX_LOG_CHARS, format, argList);
+
+        std::lock_guard<std::mutex> logLockGuard(g_logMutex);
+
+        logWriteMessage(LogMessage{time, verbosity, logGetThreadIndex(), fileName, lineNumber, std::string(buffer)});
+    }
+
+    va_end(argList);
+}
+
+VkBool32 VKTS_APIENTRY logSetMode(const VkTsLogMode mode, const VkTsLogPolicy policy)
+{
+    if (mode < VKTS_LOG_MODE_SYNC || mode > VKTS_LOG_MODE_ASYNC_DEFERRED)
+    {
+        return VK_FALSE;
+    }
+
+    g_logPolicy = policy;
+
+    if (mode == VKTS_LOG_MODE_SYNC)
+    {
+        // Messages logged until now are printed before.
+
+        g_logMode = mode;
+
+        logStopDrain();
+
+        return VK_TRUE;
+    }
+
+    if (!g_logDrainThread.get())
+    {
+        g_logDrainRun = VK_TRUE;
+
+        g_logDrainThread = ThreadSP(new std::thread(logDrainRun));
+
+        if (!g_logDrainThread.get())
         {
-            logString = VKTS_LOG_STRINGS[verbosity];
+            g_logDrainRun = VK_FALSE;
+
+            return VK_FALSE;
         }
+    }
 
-        buffer[VKTS_MAX_LOG_CHARS] = '\0';
+    g_logMode = mode;
 
-        va_start(argList, format);
+    return VK_TRUE;
+}
 
-        vsnprintf(buffer, VKTS_MAX_LOG_CHARS, format, argList);
+VkTsLogMode VKTS_APIENTRY logGetMode()
+{
+    return g_logMode.load();
+}
+
+void VKTS_APIENTRY logSetRateLimit(const uint32_t messagesPerSecond)
+{
+    g_logRateLimit = messagesPerSecond;
+}
+
+VkBool32 VKTS_APIENTRY logSetBinaryOutput(const char* filename)
+{
+    logFlush();
+
+    std::lock_guard<std::mutex> logLockGuard(g_logMutex);
+
+    if (g_logBinaryFile)
+    {
+        fclose(g_logBinaryFile);
 
-        VKTS_PRINTF("VKTS log [%s] in '%s' at %d: %s\n", logString, logGetFilename(fileName), lineNumber, buffer);
+        g_logBinaryFile = nullptr;
+    }
 
-        va_end(argList);
+    if (!filename)
+    {
+        return VK_TRUE;
     }
+
+    g_logBinaryFile = fopen(filename, "wb");
+
+    return g_logBinaryFile != nullptr;
+}
+
+void VKTS_APIENTRY logFlush()
+{
+    if (!g_logDrainRun.load())
+    {
+        return;
+    }
+
+    // Wait, until the background thread did pass the messages, which are in the buffers now.
+
+    std::vector<std::pair<LogBufferSP, uint64_t>> allHeads;
+
+    {
+        std::lock_guard<std::mutex> logBufferLockGuard(g_logBufferMutex);
+
+        for (const auto& buffer : g_logBuffers)
+        {
+            allHeads.push_back(std::make_pair(buffer, buffer->head.load(std::memory_order_acquire)));
+        }
+    }
+
+    for (const auto& currentHead : allHeads)
+    {
+        while (g_logDrainRun.load() && currentHead.first->tail.load(std::memory_order_acquire) < currentHead.second)
+        {
+            logWakeDrain();
+
+            std::unique_lock<std::mutex> logDrainUniqueLock(g_logDrainMutex);
+
+            g_logDrainedConditionVariable.wait_for(logDrainUniqueLock, std::chrono::duration<double>(VKTS_LOG_DRAIN_WAIT));
+        }
+    }
+}
+
+void VKTS_APIENTRY logGetDropCount(uint64_t& droppedCount, uint64_t& rateLimitedCount)
+{
+    droppedCount = g_logDroppedCount.load(std::memory_order_relaxed);
+    rateLimitedCount = g_logRateLimitedCount.load(std::memory_order_relaxed);
 }
 
 void VKTS_APIENTRY logTerminate()
 {
-    // Nothing for now.
+    g_logMode = VKTS_LOG_MODE_SYNC;
+
+    logStopDrain();
+
+    logSetBinaryOutput(nullptr);
+
+    // Threads allocate a new buffer with the next asynchronous message.
+
+    std::lock_guard<std::mutex> logBufferLockGuard(g_logBufferMutex);
+
+    g_logBuffers.clear();
+
+    g_logBufferGeneration++;
 }
 
 }
@@ -0,0 +1,528 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "fn_log_internal.hpp"
+
+namespace vkts
+{
+
+typedef enum LogArgument_
+{
+    LOG_ARGUMENT_NONE, LOG_ARGUMENT_SIGNED, LOG_ARGUMENT_UNSIGNED, LOG_ARGUMENT_DOUBLE, LOG_ARGUMENT_LONG_DOUBLE, LOG_ARGUMENT_STRING, LOG_ARGUMENT_POINTER, LOG_ARGUMENT_UNSUPPORTED
+} LogArgument;
+
+typedef enum LogLength_
+{
+    LOG_LENGTH_NONE, LOG_LENGTH_HH, LOG_LENGTH_H, LOG_LENGTH_L, LOG_LENGTH_LL, LOG_LENGTH_Z, LOG_LENGTH_J, LOG_LENGTH_T, LOG_LENGTH_BIG_L
+} LogLength;
+
+typedef struct LogSpecification_
+{
+    // Range of flags, width and precision after the '%'.
+    const char* begin;
+    const char* end;
+
+    uint32_t starCount;
+
+    LogLength length;
+
+    char conversion;
+
+    LogArgument argument;
+} LogSpecification;
+
+// Returns the character after the specification. format points to the character after the '%'.
+static const char* logParseSpecification(const char* format, LogSpecification& specification)
+{
+    specification.begin = format;
+    specification.starCount = 0;
+    specification.length = LOG_LENGTH_NONE;
+
+    while (*format && strchr("-+ #0123456789.*", *format))
+    {
+        if (*format == '*')
+        {
+            specification.starCount++;
+        }
+
+        format++;
+    }
+
+    specification.end = format;
+
+    if (format[0] == 'h' && format[1] == 'h')
+    {
+        specification.length = LOG_LENGTH_HH;
+        format += 2;
+    }
+    else if (format[0] == 'l' && format[1] == 'l')
+    {
+        specification.length = LOG_LENGTH_LL;
+        format += 2;
+    }
+    else if (*format && strchr("hlzjtL", *format))
+    {
+        switch (*format)
+        {
+            case 'h':
+                specification.length = LOG_LENGTH_H;
+                break;
+            case 'l':
+                specification.length = LOG_LENGTH_L;
+                break;
+            case 'z':
+                specification.length = LOG_LENGTH_Z;
+                break;
+            case 'j':
+                specification.length = LOG_LENGTH_J;
+                break;
+            case 't':
+                specification.length = LOG_LENGTH_T;
+                break;
+            default:
+                specification.length = LOG_LENGTH_BIG_L;
+                break;
+        }
+
+        format++;
+    }
+
+    specification.conversion = *format;
+
+    switch (specification.conversion)
+    {
+        case 'd':
+        case 'i':
+        case 'c':
+            specification.argument = LOG_ARGUMENT_SIGNED;
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            specification.argument = LOG_ARGUMENT_UNSIGNED;
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            specification.argument = specification.length == LOG_LENGTH_BIG_L ? LOG_ARGUMENT_LONG_DOUBLE : LOG_ARGUMENT_DOUBLE;
+            break;
+        case 's':
+            // Wide strings are not supported.
+            specification.argument = specification.length == LOG_LENGTH_NONE ? LOG_ARGUMENT_STRING : LOG_ARGUMENT_UNSUPPORTED;
+            break;
+        case 'p':
+            specification.argument = LOG_ARGUMENT_POINTER;
+            break;
+        case '%':
+            specification.argument = LOG_ARGUMENT_NONE;
+            break;
+        default:
+            specification.argument = LOG_ARGUMENT_UNSUPPORTED;
+            break;
+    }
+
+    if (specification.conversion == 'c' && specification.length != LOG_LENGTH_NONE)
+    {
+        specification.argument = LOG_ARGUMENT_UNSUPPORTED;
+    }
+
+    return *format ? format + 1 : format;
+}
+
+static int64_t logReadSigned(const LogLength length, va_list& argList)
+{
+    switch (length)
+    {
+        case LOG_LENGTH_L:
+            return (int64_t) va_arg(argList, long);
+        case LOG_LENGTH_LL:
+            return (int64_t) va_arg(argList, long long);
+        case LOG_LENGTH_Z:
+            return (int64_t) va_arg(argList, size_t);
+        case LOG_LENGTH_J:
+            return (int64_t) va_arg(argList, intmax_t);
+        case LOG_LENGTH_T:
+            return (int64_t) va_arg(argList, ptrdiff_t);
+        default:
+            // Smaller types are promoted to int.
+            return (int64_t) va_arg(argList, int);
+    }
+}
+
+static uint64_t logReadUnsigned(const LogLength length, va_list& argList)
+{
+    switch (length)
+    {
+        case LOG_LENGTH_HH:
+            return (uint64_t) (unsigned char) va_arg(argList, unsigned int);
+        case LOG_LENGTH_H:
+            return (uint64_t) (unsigned short) va_arg(argList, unsigned int);
+        case LOG_LENGTH_L:
+            return (uint64_t) va_arg(argList, unsigned long);
+        case LOG_LENGTH_LL:
+            return (uint64_t) va_arg(argList, unsigned long long);
+        case LOG_LENGTH_Z:
+            return (uint64_t) va_arg(argList, size_t);
+        case LOG_LENGTH_J:
+            return (uint64_t) va_arg(argList, uintmax_t);
+        case LOG_LENGTH_T:
+            return (uint64_t) va_arg(argList, ptrdiff_t);
+        default:
+            return (uint64_t) va_arg(argList, unsigned int);
+    }
+}
+
+int32_t VKTS_APIENTRY _logPackArguments(uint8_t* payload, const uint32_t maxSize, const char* format, va_list argList)
+{
+    if (!payload || !format)
+    {
+        return -1;
+    }
+
+    va_list currentArgList;
+
+    va_copy(currentArgList, argList);
+
+    uint32_t size = 0;
+
+    // Every value occupies eight bytes. Strings are stored with their length and padded to eight bytes.
+
+    auto writeValue = [&](const void* value) -> VkBool32
+    {
+        if (size + 8 > maxSize)
+        {
+            return VK_FALSE;
+        }
+
+        memcpy(payload + size, value, 8);
+        size += 8;
+
+        return VK_TRUE;
+    };
+
+    VkBool32 result = VK_TRUE;
+
+    LogSpecification specification;
+
+    while (result && *format)
+    {
+        if (*format != '%')
+        {
+            format++;
+
+            continue;
+        }
+
+        format = logParseSpecification(format + 1, specification);
+
+        if (specification.argument == LOG_ARGUMENT_UNSUPPORTED)
+        {
+            result = VK_FALSE;
+
+            break;
+        }
+
+        for (uint32_t i = 0; i < specification.starCount && result; i++)
+        {
+            int64_t value = (int64_t) va_arg(currentArgList, int);
+
+            result = writeValue(&value);
+        }
+
+        if (!result)
+        {
+            break;
+        }
+
+        switch (specification.argument)
+        {
+            case LOG_ARGUMENT_SIGNED:
+            {
+                int64_t value = logReadSigned(specification.length, currentArgList);
+
+                result = writeValue(&value);
+            }
+            break;
+            case LOG_ARGUMENT_UNSIGNED:
+            {
+                uint64_t value = logReadUnsigned(specification.length, currentArgList);
+
+                result = writeValue(&value);
+            }
+            break;
+            case LOG_ARGUMENT_DOUBLE:
+            {
+                double value = va_arg(currentArgList, double);
+
+                result = writeValue(&value);
+            }
+            break;
+            case LOG_ARGUMENT_LONG_DOUBLE:
+            {
+                double value = (double) va_arg(currentArgList, long double);
+
+                result = writeValue(&value);
+            }
+            break;
+            case LOG_ARGUMENT_STRING:
+            {
+                const char* value = va_arg(currentArgList, const char*);
+
+                if (!value)
+                {
+                    value = "(null)";
+                }
+
+                uint64_t length = (uint64_t) strlen(value);
+
+                uint32_t paddedLength = (uint32_t) ((length + 7) & ~(uint64_t) 7);
+
+                if (length > maxSize || size + 8 + paddedLength > maxSize)
+                {
+                    result = VK_FALSE;
+
+                    break;
+                }
+
+                writeValue(&length);
+
+                memcpy(payload + size, value, (size_t) length);
+                size += paddedLength;
+            }
+            break;
+            case LOG_ARGUMENT_POINTER:
+            {
+                uint64_t value = (uint64_t) (uintptr_t) va_arg(currentArgList, void*);
+
+                result = writeValue(&value);
+            }
+            break;
+            default:
+                break;
+        }
+    }
+
+    va_end(currentArgList);
+
+    return result ? (int32_t) size : -1;
+}
+
+void VKTS_APIENTRY _logUnpackArguments(char* buffer, const uint32_t bufferSize, const char* format, const uint8_t* payload, const uint32_t payloadSize)
+{
+    if (!buffer || bufferSize == 0)
+    {
+        return;
+    }
+
+    buffer[0] = '\0';
+
+    if (!format)
+    {
+        return;
+    }
+
+    uint32_t length = 0;
+    uint32_t offset = 0;
+
+    auto readValue = [&](void* value)
+    {
+        memset(value, 0, 8);
+
+        if (offset + 8 <= payloadSize)
+        {
+            memcpy(value, payload + offset, 8);
+            offset += 8;
+        }
+    };
+
+    auto append = [&](const char* text, const uint32_t textLength)
+    {
+        uint32_t copyLength = glm::min(textLength, bufferSize - 1 - length);
+
+        memcpy(buffer + length, text, copyLength);
+        length += copyLength;
+        buffer[length] = '\0';
+    };
+
+    // Piece is one specification with a normalized length modifier.
+    char piece[VKTS_MAX_TOKEN_CHARS + 1];
+    char formatted[VKTS_MAX_LOG_CHARS + 1];
+
+    LogSpecification specification;
+
+    while (*format && length < bufferSize - 1)
+    {
+        const char* literal = format;
+
+        while (*format && *format != '%')
+        {
+            format++;
+        }
+
+        append(literal, (uint32_t) (format - literal));
+
+        if (!*format)
+        {
+            break;
+        }
+
+        format = logParseSpecification(format + 1, specification);
+
+        if (specification.argument == LOG_ARGUMENT_NONE)
+        {
+            append("%", 1);
+
+            continue;
+        }
+
+        int64_t stars[2] = {0, 0};
+
+        for (uint32_t i = 0; i < specification.starCount; i++)
+        {
+            int64_t value;
+
+            readValue(&value);
+
+            if (i < 2)
+            {
+                stars[i] = value;
+            }
+        }
+
+        uint32_t pieceLength = glm::min((uint32_t) (specification.end - specification.begin), (uint32_t) VKTS_MAX_TOKEN_CHARS - 4);
+
+        piece[0] = '%';
+        memcpy(piece + 1, specification.begin, pieceLength);
+        pieceLength++;
+
+        if (specification.argument == LOG_ARGUMENT_SIGNED || specification.argument == LOG_ARGUMENT_UNSIGNED)
+        {
+            if (specification.conversion != 'c')
+            {
+                piece[pieceLength++] = 'l';
+                piece[pieceLength++] = 'l';
+            }
+        }
+
+        piece[pieceLength++] = specification.conversion;
+        piece[pieceLength] = '\0';
+
+        int32_t star0 = (int32_t) stars[0];
+        int32_t star1 = (int32_t) stars[1];
+
+        int32_t formattedLength = 0;
+
+#define VKTS_LOG_FORMAT_PIECE(value) \
+    (specification.starCount == 0 ? snprintf(formatted, VKTS_MAX_LOG_CHARS, piece, value) : \
+     specification.starCount == 1 ? snprintf(formatted, VKTS_MAX_LOG_CHARS, piece, star0, value) : \
+     snprintf(formatted, VKTS_MAX_LOG_CHARS, piece, star0, star1, value))
+
+        switch (specification.argument)
+        {
+            case LOG_ARGUMENT_SIGNED:
+            {
+                int64_t value;
+
+                readValue(&value);
+
+                if (specification.conversion == 'c')
+                {
+                    formattedLength = VKTS_LOG_FORMAT_PIECE((int) value);
+                }
+                else
+                {
+                    formattedLength = VKTS_LOG_FORMAT_PIECE((long long) value);
+                }
+            }
+            break;
+            case LOG_ARGUMENT_UNSIGNED:
+            {
+                uint64_t value;
+
+                readValue(&value);
+
+                formattedLength = VKTS_LOG_FORMAT_PIECE((unsigned long long) value);
+            }
+            break;
+            case LOG_ARGUMENT_DOUBLE:
+            case LOG_ARGUMENT_LONG_DOUBLE:
+            {
+                double value;
+
+                readValue(&value);
+
+                formattedLength = VKTS_LOG_FORMAT_PIECE(value);
+            }
+            break;
+            case LOG_ARGUMENT_STRING:
+            {
+                uint64_t stringLength;
+
+                readValue(&stringLength);
+
+                std::string value;
+
+                if (offset + stringLength <= payloadSize)
+                {
+                    value.assign((const char*) payload + offset, (size_t) stringLength);
+
+                    offset += (uint32_t) ((stringLength + 7) & ~(uint64_t) 7);
+                }
+
+                formattedLength = VKTS_LOG_FORMAT_PIECE(value.c_str());
+            }
+            break;
+            case LOG_ARGUMENT_POINTER:
+            {
+                uint64_t value;
+
+                readValue(&value);
+
+                formattedLength = VKTS_LOG_FORMAT_PIECE((void*) (uintptr_t) value);
+            }
+            break;
+            default:
+                break;
+        }
+
+#undef VKTS_LOG_FORMAT_PIECE
+
+        if (formattedLength > 0)
+        {
+            append(formatted, glm::min((uint32_t) formattedLength, (uint32_t) VKTS_MAX_LOG_CHARS - 1));
+        }
+    }
+}
+
+}
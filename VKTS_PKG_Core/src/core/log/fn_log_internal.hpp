@@ -0,0 +1,56 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_LOG_INTERNAL_HPP_
+#define VKTS_FN_LOG_INTERNAL_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+// Bytes of the message buffer of one thread. Has to be a power of two.
+#define VKTS_LOG_BUFFER_SIZE 65536
+
+// Seconds, the background thread sleeps, if there is nothing to print.
+#define VKTS_LOG_DRAIN_WAIT 0.01
+
+#define VKTS_LOG_RATE_LIMIT_SLOTS 1024
+
+namespace vkts
+{
+
+/**
+ * Copies the arguments described by the format into the payload. Returns the used bytes or -1,
+ * if the format contains an unsupported conversion or the payload is too small.
+ */
+VKTS_APICALL int32_t VKTS_APIENTRY _logPackArguments(uint8_t* payload, const uint32_t maxSize, const char* format, va_list argList);
+
+/**
+ * Formats the message out of the format and the packed arguments.
+ */
+VKTS_APICALL void VKTS_APIENTRY _logUnpackArguments(char* buffer, const uint32_t bufferSize, const char* format, const uint8_t* payload, const uint32_t payloadSize);
+
+}
+
+#endif /* VKTS_FN_LOG_INTERNAL_HPP_ */
@@ -0,0 +1,80 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ParallelJob.hpp"
+
+namespace vkts
+{
+
+ParallelJob::ParallelJob(const uint32_t begin, const uint32_t end, const uint32_t grain, const ParallelForFunction& function) :
+    function(function), begin(begin), end(end), grain(grain), chunkCount((uint32_t)(((uint64_t)end - (uint64_t)begin + (uint64_t)grain - 1) / (uint64_t)grain)), nextChunk(0), doneChunks(0), doneMutex(), doneConditionVariable()
+{
+}
+
+ParallelJob::~ParallelJob()
+{
+}
+
+uint32_t ParallelJob::getChunkCount() const
+{
+    return chunkCount;
+}
+
+VkBool32 ParallelJob::isExhausted() const
+{
+    return nextChunk.load() >= chunkCount;
+}
+
+void ParallelJob::execute()
+{
+    uint64_t currentChunk;
+
+    while ((currentChunk = nextChunk.fetch_add(1)) < chunkCount)
+    {
+        // In 64 bit, as the last chunk can end beyond UINT32_MAX.
+
+        const uint64_t chunkBegin = (uint64_t)begin + currentChunk * (uint64_t)grain;
+        const uint64_t chunkEnd = glm::min(chunkBegin + (uint64_t)grain, (uint64_t)end);
+
+        function((uint32_t)chunkBegin, (uint32_t)chunkEnd);
+
+        if (doneChunks.fetch_add(1) + 1 == chunkCount)
+        {
+            std::lock_guard<std::mutex> doneLockGuard(doneMutex);
+
+            doneConditionVariable.notify_all();
+        }
+    }
+}
+
+void ParallelJob::wait()
+{
+    std::unique_lock<std::mutex> doneUniqueLock(doneMutex);
+
+    doneConditionVariable.wait(doneUniqueLock, [this] {return doneChunks.load() == chunkCount;});
+}
+
+} /* namespace vkts */
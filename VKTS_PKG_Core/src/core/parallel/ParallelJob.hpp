@@ -0,0 +1,91 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_PARALLELJOB_HPP_
+#define VKTS_PARALLELJOB_HPP_
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+/**
+ * One parallel for call. Threads grab the chunks by incrementing an atomic counter, so no lock is taken per chunk.
+ */
+class ParallelJob
+{
+
+private:
+
+    const ParallelForFunction& function;
+
+    const uint32_t begin;
+    const uint32_t end;
+    const uint32_t grain;
+
+    const uint32_t chunkCount;
+
+    // Wider than the chunk count, so the increments after the last chunk do not wrap around.
+    std::atomic<uint64_t> nextChunk;
+
+    std::atomic<uint32_t> doneChunks;
+
+    std::mutex doneMutex;
+
+    std::condition_variable doneConditionVariable;
+
+public:
+
+    ParallelJob() = delete;
+    ParallelJob(const ParallelJob& other) = delete;
+    ParallelJob(ParallelJob&& other) = delete;
+    ParallelJob(const uint32_t begin, const uint32_t end, const uint32_t grain, const ParallelForFunction& function);
+    ~ParallelJob();
+
+    ParallelJob& operator =(const ParallelJob& other) = delete;
+    ParallelJob& operator =(ParallelJob && other) = delete;
+
+    uint32_t getChunkCount() const;
+
+    VkBool32 isExhausted() const;
+
+    /**
+     * Executes chunks until no chunk is left.
+     */
+    void execute();
+
+    /**
+     * Blocks until all chunks, also the ones executed by other threads, are done.
+     */
+    void wait();
+
+};
+
+typedef std::shared_ptr<ParallelJob> ParallelJobSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_PARALLELJOB_HPP_ */
@@ -0,0 +1,227 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "ParallelJob.hpp"
+
+namespace vkts
+{
+
+typedef std::shared_ptr<std::thread> ThreadSP;
+
+static std::mutex g_parallelMutex;
+
+static std::condition_variable g_parallelConditionVariable;
+
+static SmartPointerVector<ThreadSP> g_parallelThreads;
+
+static std::list<ParallelJobSP> g_parallelJobs;
+
+static VkBool32 g_parallelRun = VK_FALSE;
+
+static uint32_t g_parallelThreadCount = 0;
+
+static void parallelRemoveJob(const ParallelJobSP& job)
+{
+    std::lock_guard<std::mutex> parallelLockGuard(g_parallelMutex);
+
+    g_parallelJobs.remove(job);
+}
+
+static void parallelWorker()
+{
+    std::unique_lock<std::mutex> parallelUniqueLock(g_parallelMutex);
+
+    while (true)
+    {
+        g_parallelConditionVariable.wait(parallelUniqueLock, [] {return !g_parallelRun || g_parallelJobs.size() > 0;});
+
+        if (!g_parallelRun)
+        {
+            return;
+        }
+
+        // Oldest job first. Exhausted jobs are removed, so the others are reached.
+
+        auto job = g_parallelJobs.front();
+
+        parallelUniqueLock.unlock();
+
+        job->execute();
+
+        parallelUniqueLock.lock();
+
+        g_parallelJobs.remove(job);
+    }
+}
+
+static VkBool32 parallelStart()
+{
+    std::lock_guard<std::mutex> parallelLockGuard(g_parallelMutex);
+
+    if (g_parallelRun)
+    {
+        return VK_TRUE;
+    }
+
+    uint32_t threadCount = g_parallelThreadCount;
+
+    if (threadCount == 0)
+    {
+        threadCount = processorGetNumber() > 1 ? processorGetNumber() - 1 : 0;
+    }
+
+    if (threadCount == 0)
+    {
+        return VK_FALSE;
+    }
+
+    g_parallelRun = VK_TRUE;
+
+    for (uint32_t i = 0; i < threadCount; i++)
+    {
+        auto currentThread = ThreadSP(new std::thread(parallelWorker));
+
+        if (!currentThread.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create parallel thread.");
+
+            break;
+        }
+
+        g_parallelThreads.append(currentThread);
+    }
+
+    return g_parallelThreads.size() > 0;
+}
+
+static void parallelStop()
+{
+    {
+        std::lock_guard<std::mutex> parallelLockGuard(g_parallelMutex);
+
+        g_parallelRun = VK_FALSE;
+
+        g_parallelConditionVariable.notify_all();
+    }
+
+    for (uint32_t i = 0; i < g_parallelThreads.size(); i++)
+    {
+        g_parallelThreads[i]->join();
+    }
+
+    g_parallelThreads.clear();
+}
+
+VkBool32 VKTS_APIENTRY parallelSetThreadCount(const uint32_t count)
+{
+    parallelStop();
+
+    g_parallelThreadCount = count;
+
+    return VK_TRUE;
+}
+
+uint32_t VKTS_APIENTRY parallelGetThreadCount()
+{
+    if (g_parallelThreadCount == 0)
+    {
+        return processorGetNumber() > 1 ? processorGetNumber() - 1 : 0;
+    }
+
+    return g_parallelThreadCount;
+}
+
+uint32_t VKTS_APIENTRY parallelGetGrain(const uint32_t begin, const uint32_t end, const uint32_t grain)
+{
+    if (grain > 0)
+    {
+        return grain;
+    }
+
+    if (end <= begin)
+    {
+        return 1;
+    }
+
+    // Rounding up in 64 bit, as the range can reach UINT32_MAX.
+
+    return glm::max((uint32_t)(((uint64_t)end - (uint64_t)begin + VKTS_PARALLEL_DEFAULT_CHUNKS - 1) / VKTS_PARALLEL_DEFAULT_CHUNKS), 1u);
+}
+
+void VKTS_APIENTRY parallelFor(const uint32_t begin, const uint32_t end, const uint32_t grain, const ParallelForFunction& function)
+{
+    if (end <= begin || !function)
+    {
+        return;
+    }
+
+    uint32_t currentGrain = parallelGetGrain(begin, end, grain);
+
+    ParallelJobSP job = ParallelJobSP(new ParallelJob(begin, end, currentGrain, function));
+
+    if (!job.get())
+    {
+        return;
+    }
+
+    // Only one chunk or no helper threads, so execute everything on this thread.
+
+    if (job->getChunkCount() == 1 || !parallelStart())
+    {
+        job->execute();
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> parallelLockGuard(g_parallelMutex);
+
+        g_parallelJobs.push_back(job);
+
+        g_parallelConditionVariable.notify_all();
+    }
+
+    // Calling thread helps, so nested calls never dead lock.
+
+    job->execute();
+
+    parallelRemoveJob(job);
+
+    job->wait();
+}
+
+void VKTS_APIENTRY parallelTerminate()
+{
+    parallelStop();
+
+    std::lock_guard<std::mutex> parallelLockGuard(g_parallelMutex);
+
+    g_parallelJobs.clear();
+}
+
+}
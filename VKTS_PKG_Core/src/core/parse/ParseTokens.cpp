@@ -0,0 +1,128 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+namespace vkts
+{
+
+uint32_t ParseTokens::hash(const char* token, const uint32_t length, const uint32_t currentSeed) const
+{
+	uint32_t result = 2166136261u ^ currentSeed;
+
+	for (uint32_t i = 0; i < length; i++)
+	{
+		result = (result ^ (uint8_t)token[i]) * 16777619u;
+	}
+
+	return result ^ (result >> 15);
+}
+
+VkBool32 ParseTokens::build(const uint32_t slotCount, const uint32_t currentSeed)
+{
+	allSlots.assign(slotCount, VKTS_PARSE_TOKEN_UNKNOWN);
+
+	for (size_t i = 0; i < allTokens.size(); i++)
+	{
+		const uint32_t slot = hash(allTokens[i].c_str(), (uint32_t)allTokens[i].size(), currentSeed) & (slotCount - 1);
+
+		if (allSlots[slot] != VKTS_PARSE_TOKEN_UNKNOWN)
+		{
+			// Duplicates keep their first index.
+			if (allTokens[allSlots[slot]] == allTokens[i])
+			{
+				continue;
+			}
+
+			return VK_FALSE;
+		}
+
+		allSlots[slot] = (int32_t)i;
+	}
+
+	return VK_TRUE;
+}
+
+ParseTokens::ParseTokens(std::initializer_list<const char*> allTokens) :
+	allTokens(allTokens.begin(), allTokens.end()), allSlots(), seed(0)
+{
+	uint32_t slotCount = 1;
+
+	while (slotCount < 2 * (uint32_t)this->allTokens.size())
+	{
+		slotCount <<= 1;
+	}
+
+	// Search a seed without any collision. If there is none, double the table.
+	while (VK_TRUE)
+	{
+		for (seed = 0; seed < 64; seed++)
+		{
+			if (build(slotCount, seed))
+			{
+				return;
+			}
+		}
+
+		slotCount <<= 1;
+	}
+}
+
+ParseTokens::~ParseTokens()
+{
+}
+
+int32_t ParseTokens::find(const char* token, const uint32_t length) const
+{
+	if (!token)
+	{
+		return VKTS_PARSE_TOKEN_UNKNOWN;
+	}
+
+	const int32_t index = allSlots[hash(token, length, seed) & ((uint32_t)allSlots.size() - 1)];
+
+	if (index == VKTS_PARSE_TOKEN_UNKNOWN || allTokens[index].size() != length || memcmp(allTokens[index].c_str(), token, length) != 0)
+	{
+		return VKTS_PARSE_TOKEN_UNKNOWN;
+	}
+
+	return index;
+}
+
+int32_t ParseTokens::find(const char** cursor) const
+{
+	const char* token;
+	uint32_t length;
+
+	if (!parseNextToken(cursor, &token, &length))
+	{
+		return VKTS_PARSE_TOKEN_UNKNOWN;
+	}
+
+	return find(token, length);
+}
+
+} /* namespace vkts */
@@ -26,102 +26,155 @@
 
 #include <vkts/core/vkts_core.hpp>
 
+#define VKTS_PARSE_MAX_MANTISSA_DIGITS 19
+#define VKTS_PARSE_MAX_FAST_EXPONENT 22
+
 namespace vkts
 {
 
-VkBool32 VKTS_APIENTRY parseSkipBuffer(const char* buffer)
+static const double g_parsePowerOfTen[VKTS_PARSE_MAX_FAST_EXPONENT + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline VkBool32 parseIsSpace(const char character)
 {
-    if (!buffer)
+    return character == ' ' || character == '\t' || character == '\r' || character == '\n' || character == '\v' || character == '\f';
+}
+
+static inline VkBool32 parseIsDigit(const char character)
+{
+    return character >= '0' && character <= '9';
+}
+
+static inline void parseSkipSpace(const char** cursor)
+{
+    while (parseIsSpace(**cursor))
     {
-        return VK_TRUE;
+        (*cursor)++;
     }
+}
+
+static VkBool32 parseIsWord(const char* current, const char* word, const char** end)
+{
+    // Case insensitive, as accepted by scanf.
 
-    if (strlen(buffer) == 0)
+    while (*word)
     {
-    	// No content, just skip.
+        if ((*current | 0x20) != *word)
+        {
+            return VK_FALSE;
+        }
 
-    	return VK_TRUE;
+        current++;
+        word++;
     }
 
-    if (strncmp(buffer, "#", 1) == 0)
-    {
-        // Comment, just skip.
+    *end = current;
 
-        return VK_TRUE;
-    }
-    else if (strncmp(buffer, " ", 1) == 0 || strncmp(buffer, "\t", 1) == 0 || strncmp(buffer, "\r", 1) == 0 || strncmp(buffer, "\n", 1) == 0)
+    return VK_TRUE;
+}
+
+static float parseSlowFloat(const char* start, const char* end, const int32_t exponent)
+{
+    // Locale independent and correctly rounded, but slow. Only used in rare cases.
+
+    std::istringstream stream(std::string(start, end - start));
+
+    stream.imbue(std::locale::classic());
+
+    float value = 0.0f;
+
+    stream >> value;
+
+    if (stream.fail())
     {
-        // Empty line, just skip.
+        // Syntax is already checked, so only an overflow or underflow is left.
 
-        return VK_TRUE;
+        value = exponent > 0 ? std::numeric_limits<float>::infinity() : 0.0f;
     }
 
-    return VK_FALSE;
+    return value;
 }
 
-void VKTS_APIENTRY parseUnknownBuffer(const char* buffer)
+VkBool32 VKTS_APIENTRY parseNextToken(const char** cursor, const char** token, uint32_t* length)
 {
-    if (!buffer)
+    if (!cursor || !*cursor || !token || !length)
     {
-        return;
+        return VK_FALSE;
     }
 
-    std::string unknown(buffer);
+    parseSkipSpace(cursor);
 
-    if (unknown.length() >= 2 && unknown[unknown.length() - 2] == '\r')
-    {
-        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not parse line '%s'", unknown.substr(0, unknown.length() - 2).c_str());
-    }
-    else if (unknown.length() >= 1 && unknown[unknown.length() - 1] == '\n')
+    const char* start = *cursor;
+
+    while (**cursor && !parseIsSpace(**cursor))
     {
-        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not parse line '%s'", unknown.substr(0, unknown.length() - 1).c_str());
+        (*cursor)++;
     }
-    else
+
+    if (*cursor == start)
     {
-        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not parse line '%s'", unknown.c_str());
+        return VK_FALSE;
     }
+
+    *token = start;
+    *length = (uint32_t)(*cursor - start);
+
+    return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY parseIsToken(const char* buffer, const char* token)
+VkBool32 VKTS_APIENTRY parseNextString(const char** cursor, char* string, const uint32_t stringSize)
 {
-    if (!buffer || !token)
+    if (!string)
     {
         return VK_FALSE;
     }
 
-    if (strlen(buffer) <= strlen(token))
-    {
-    	return VK_FALSE;
-    }
+    const char* token;
+    uint32_t length;
 
-    if (!(buffer[strlen(token)] == ' ' || buffer[strlen(token)] == '\t' || buffer[strlen(token)] == '\r' || buffer[strlen(token)] == '\n' || buffer[strlen(token)] == '\0'))
+    if (!parseNextToken(cursor, &token, &length))
     {
         return VK_FALSE;
     }
 
-    if (strncmp(buffer, token, strlen(token)) == 0)
+    if (length > stringSize)
     {
-        return VK_TRUE;
+        return VK_FALSE;
     }
 
-    return VK_FALSE;
+    memcpy(string, token, length);
+
+    string[length] = '\0';
+
+    return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY parseString(const char* buffer, char* string, const uint32_t stringSize)
+VkBool32 VKTS_APIENTRY parseNextBool(const char** cursor, VkBool32* scalar)
 {
-    if (!buffer || !string)
+    if (!scalar)
     {
         return VK_FALSE;
     }
 
-    if (stringSize > VKTS_MAX_TOKEN_CHARS)
+    const char* token;
+    uint32_t length;
+
+    if (!parseNextToken(cursor, &token, &length))
     {
-    	return VK_FALSE;
+        return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
-
-    if (sscanf(buffer, "%256s %256s", token, string) != 2)
+    if (length == 4 && strncmp(token, "true", 4) == 0)
+    {
+        *scalar = VK_TRUE;
+    }
+    else if (length == 5 && strncmp(token, "false", 5) == 0)
+    {
+        *scalar = VK_FALSE;
+    }
+    else
     {
         return VK_FALSE;
     }
@@ -129,206 +182,453 @@ VkBool32 VKTS_APIENTRY parseString(const char* buffer, char* string, const uint3
     return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY parseStringTuple(const char* buffer, char* string0, const uint32_t string0Size, char* string1, const uint32_t string1Size)
+VkBool32 VKTS_APIENTRY parseNextFloat(const char** cursor, float* scalar)
 {
-    if (!buffer || !string0 || !string1)
+    if (!cursor || !*cursor || !scalar)
     {
         return VK_FALSE;
     }
 
-    if (string0Size > VKTS_MAX_TOKEN_CHARS || string1Size > VKTS_MAX_TOKEN_CHARS)
+    parseSkipSpace(cursor);
+
+    const char* current = *cursor;
+
+    VkBool32 negative = VK_FALSE;
+
+    if (*current == '-' || *current == '+')
     {
-    	return VK_FALSE;
+        negative = (*current == '-');
+
+        current++;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    const char* start = current;
+
+    const char* end;
 
-    if (sscanf(buffer, "%256s %256s %256s", token, string0, string1) != 3)
+    if (parseIsWord(current, "inf", &end))
     {
-        return VK_FALSE;
-    }
+        const char* longEnd;
 
-    return VK_TRUE;
-}
+        if (parseIsWord(end, "inity", &longEnd))
+        {
+            end = longEnd;
+        }
 
-VkBool32 VKTS_APIENTRY parseStringFloat(const char* buffer, char* string, const uint32_t stringSize, float* scalar)
-{
-    if (!buffer || !string || !scalar)
+        *scalar = negative ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+        *cursor = end;
+
+        return VK_TRUE;
+    }
+
+    if (parseIsWord(current, "nan", &end))
     {
-        return VK_FALSE;
+        *scalar = std::numeric_limits<float>::quiet_NaN();
+        *cursor = end;
+
+        return VK_TRUE;
     }
 
-    if (stringSize > VKTS_MAX_TOKEN_CHARS)
+    // Gather up to 19 significant digits, which always fit into 64 bit.
+
+    uint64_t mantissa = 0;
+    int32_t exponent = 0;
+
+    uint32_t digits = 0;
+    uint32_t significantDigits = 0;
+
+    while (parseIsDigit(*current))
     {
-    	return VK_FALSE;
+        if (mantissa != 0 || *current != '0')
+        {
+            if (significantDigits < VKTS_PARSE_MAX_MANTISSA_DIGITS)
+            {
+                mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+            }
+            else
+            {
+                exponent++;
+            }
+
+            significantDigits++;
+        }
+
+        digits++;
+        current++;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    if (*current == '.')
+    {
+        current++;
+
+        while (parseIsDigit(*current))
+        {
+            if (mantissa != 0 || *current != '0')
+            {
+                if (significantDigits < VKTS_PARSE_MAX_MANTISSA_DIGITS)
+                {
+                    mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+
+                    exponent--;
+                }
 
-    if (sscanf(buffer, "%256s %256s %f", token, string, scalar) != 3)
+                significantDigits++;
+            }
+            else
+            {
+                exponent--;
+            }
+
+            digits++;
+            current++;
+        }
+    }
+
+    if (digits == 0)
     {
         return VK_FALSE;
     }
 
+    if (*current == 'e' || *current == 'E')
+    {
+        const char* exponentCurrent = current + 1;
+
+        VkBool32 negativeExponent = VK_FALSE;
+
+        if (*exponentCurrent == '-' || *exponentCurrent == '+')
+        {
+            negativeExponent = (*exponentCurrent == '-');
+
+            exponentCurrent++;
+        }
+
+        // Without digits, the exponent is not part of the number.
+
+        if (parseIsDigit(*exponentCurrent))
+        {
+            int32_t exponentValue = 0;
+
+            while (parseIsDigit(*exponentCurrent))
+            {
+                if (exponentValue < 100000)
+                {
+                    exponentValue = exponentValue * 10 + (int32_t)(*exponentCurrent - '0');
+                }
+
+                exponentCurrent++;
+            }
+
+            exponent += negativeExponent ? -exponentValue : exponentValue;
+
+            current = exponentCurrent;
+        }
+    }
+
+    *cursor = current;
+
+    const float value = parseDecimalFloat(start, current, mantissa, exponent, significantDigits > VKTS_PARSE_MAX_MANTISSA_DIGITS);
+
+    *scalar = negative ? -value : value;
+
     return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY parseStringBool(const char* buffer, char* string, const uint32_t stringSize, VkBool32* scalar)
+VkBool32 VKTS_APIENTRY parseNextInt(const char** cursor, int32_t* scalar)
 {
-    if (!buffer || !string || !scalar)
+    if (!cursor || !*cursor || !scalar)
     {
         return VK_FALSE;
     }
 
-    if (stringSize > VKTS_MAX_TOKEN_CHARS)
-    {
-    	return VK_FALSE;
-    }
+    parseSkipSpace(cursor);
+
+    const char* current = *cursor;
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    VkBool32 negative = VK_FALSE;
 
-    char value[VKTS_MAX_TOKEN_CHARS + 1];
+    if (*current == '-' || *current == '+')
+    {
+        negative = (*current == '-');
+
+        current++;
+    }
 
-    if (sscanf(buffer, "%256s %256s %256s", token, string, value) != 3)
+    if (!parseIsDigit(*current))
     {
         return VK_FALSE;
     }
 
-    if (strcmp(value, "true") == 0)
+    int64_t value = 0;
+
+    while (parseIsDigit(*current))
     {
-    	*scalar = VK_TRUE;
+        value = value * 10 + (int64_t)(*current - '0');
+
+        if (value > (int64_t)INT32_MAX + 1)
+        {
+            return VK_FALSE;
+        }
+
+        current++;
     }
-    else if (strcmp(value, "false") == 0)
+
+    if (negative)
     {
-    	*scalar = VK_FALSE;
+        value = -value;
     }
-    else
+    else if (value > (int64_t)INT32_MAX)
     {
-    	return VK_FALSE;
+        return VK_FALSE;
     }
 
+    *scalar = (int32_t)value;
+    *cursor = current;
+
     return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY parseBool(const char* buffer, VkBool32* scalar)
+VkBool32 VKTS_APIENTRY parseNextUIntHex(const char** cursor, uint32_t* scalar)
 {
-    if (!buffer || !scalar)
+    if (!cursor || !*cursor || !scalar)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    parseSkipSpace(cursor);
 
-    char value[VKTS_MAX_TOKEN_CHARS + 1];
+    const char* current = *cursor;
 
-    if (sscanf(buffer, "%256s %256s", token, value) != 2)
+    if (current[0] == '0' && (current[1] == 'x' || current[1] == 'X'))
     {
-        return VK_FALSE;
+        current += 2;
     }
 
-    if (strcmp(value, "true") == 0)
-    {
-    	*scalar = VK_TRUE;
-    }
-    else if (strcmp(value, "false") == 0)
+    const char* start = current;
+
+    uint64_t value = 0;
+
+    while (VK_TRUE)
     {
-    	*scalar = VK_FALSE;
+        uint32_t digit;
+
+        if (parseIsDigit(*current))
+        {
+            digit = (uint32_t)(*current - '0');
+        }
+        else if ((*current | 0x20) >= 'a' && (*current | 0x20) <= 'f')
+        {
+            digit = (uint32_t)((*current | 0x20) - 'a' + 10);
+        }
+        else
+        {
+            break;
+        }
+
+        value = (value << 4) | digit;
+
+        if (value > (uint64_t)UINT32_MAX)
+        {
+            return VK_FALSE;
+        }
+
+        current++;
     }
-    else
+
+    if (current == start)
     {
-    	return VK_FALSE;
+        return VK_FALSE;
     }
 
+    *scalar = (uint32_t)value;
+    *cursor = current;
+
     return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY parseBoolTriple(const char* buffer, VkBool32* scalar0, VkBool32* scalar1, VkBool32* scalar2)
+VkBool32 VKTS_APIENTRY parseNextFloats(const char** cursor, float* vec, const uint32_t count)
 {
-    if (!buffer || !scalar0 || !scalar1 || !scalar2)
+    if (!vec)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!parseNextFloat(cursor, &vec[i]))
+        {
+            return VK_FALSE;
+        }
+    }
 
-    char value0[VKTS_MAX_TOKEN_CHARS + 1];
-    char value1[VKTS_MAX_TOKEN_CHARS + 1];
-    char value2[VKTS_MAX_TOKEN_CHARS + 1];
+    return VK_TRUE;
+}
 
-    if (sscanf(buffer, "%256s %256s %256s %256s", token, value0, value1, value2) != 4)
+VkBool32 VKTS_APIENTRY parseNextInts(const char** cursor, int32_t* ivec, const uint32_t count)
+{
+    if (!ivec)
     {
         return VK_FALSE;
     }
 
-    if (strcmp(value0, "true") == 0)
+    for (uint32_t i = 0; i < count; i++)
     {
-    	*scalar0 = VK_TRUE;
+        if (!parseNextInt(cursor, &ivec[i]))
+        {
+            return VK_FALSE;
+        }
     }
-    else if (strcmp(value0, "false") == 0)
+
+    return VK_TRUE;
+}
+
+float VKTS_APIENTRY parseDecimalFloat(const char* start, const char* end, const uint64_t mantissa, const int32_t exponent, const VkBool32 truncated)
+{
+    if (mantissa == 0)
     {
-    	*scalar0 = VK_FALSE;
+        return 0.0f;
     }
-    else
+
+    // Fast path: mantissa and power of ten are exact in double, so the single operation is correctly rounded.
+
+    if (!truncated && mantissa <= (1ull << 53) && exponent >= -VKTS_PARSE_MAX_FAST_EXPONENT && exponent <= VKTS_PARSE_MAX_FAST_EXPONENT)
     {
-    	return VK_FALSE;
+        const double value = exponent >= 0 ? (double)mantissa * g_parsePowerOfTen[exponent] : (double)mantissa / g_parsePowerOfTen[-exponent];
+
+        const float result = (float)value;
+
+        // Rounding double to float is only wrong, if the double lies exactly between two floats.
+
+        VkBool32 isHalfway = VK_FALSE;
+
+        if ((double)result != value)
+        {
+            const float other = std::nextafter(result, value > (double)result ? std::numeric_limits<float>::infinity() : -std::numeric_limits<float>::infinity());
+
+            isHalfway = (fabs(value - (double)result) == fabs((double)other - value));
+        }
+
+        if (!isHalfway)
+        {
+            return result;
+        }
     }
 
-    if (strcmp(value1, "true") == 0)
+    return parseSlowFloat(start, end, exponent);
+}
+
+//
+
+VkBool32 VKTS_APIENTRY parseSkipBuffer(const char* buffer)
+{
+    if (!buffer)
     {
-    	*scalar1 = VK_TRUE;
+        return VK_TRUE;
     }
-    else if (strcmp(value1, "false") == 0)
+
+    if (buffer[0] == '\0')
     {
-    	*scalar1 = VK_FALSE;
+    	// No content, just skip.
+
+    	return VK_TRUE;
     }
-    else
+
+    if (buffer[0] == '#')
     {
-    	return VK_FALSE;
-    }
+        // Comment, just skip.
 
-    if (strcmp(value2, "true") == 0)
+        return VK_TRUE;
+    }
+    else if (buffer[0] == ' ' || buffer[0] == '\t' || buffer[0] == '\r' || buffer[0] == '\n')
     {
-    	*scalar2 = VK_TRUE;
+        // Empty line, just skip.
+
+        return VK_TRUE;
     }
-    else if (strcmp(value2, "false") == 0)
+
+    return VK_FALSE;
+}
+
+static VkBool32 parseFloats(const char* buffer, float* vec, const uint32_t count)
+{
+    if (!buffer || !vec)
     {
-    	*scalar2 = VK_FALSE;
+        return VK_FALSE;
     }
-    else
+
+    const char* token;
+    uint32_t length;
+
+    if (!parseNextToken(&buffer, &token, &length))
     {
-    	return VK_FALSE;
+        return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextFloats(&buffer, vec, count);
 }
 
-VkBool32 VKTS_APIENTRY parseFloat(const char* buffer, float* scalar)
+static VkBool32 parseInts(const char* buffer, int32_t* ivec, const uint32_t count)
 {
-    if (!buffer || !scalar)
+    if (!buffer || !ivec)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    const char* token;
+    uint32_t length;
 
-    if (sscanf(buffer, "%256s %f", token, scalar) != 2)
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextInts(&buffer, ivec, count);
 }
 
-VkBool32 VKTS_APIENTRY parseVec2(const char* buffer, float vec2[2])
+void VKTS_APIENTRY parseUnknownBuffer(const char* buffer)
+{
+    if (!buffer)
+    {
+        return;
+    }
+
+    std::string unknown(buffer);
+
+    if (unknown.length() >= 2 && unknown[unknown.length() - 2] == '\r')
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not parse line '%s'", unknown.substr(0, unknown.length() - 2).c_str());
+    }
+    else if (unknown.length() >= 1 && unknown[unknown.length() - 1] == '\n')
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not parse line '%s'", unknown.substr(0, unknown.length() - 1).c_str());
+    }
+    else
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not parse line '%s'", unknown.c_str());
+    }
+}
+
+VkBool32 VKTS_APIENTRY parseIsToken(const char* buffer, const char* token)
 {
-    if (!buffer || !vec2)
+    if (!buffer || !token)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    // Compare first, so the buffer is never scanned beyond the token.
 
-    if (sscanf(buffer, "%256s %f %f", token, &vec2[0], &vec2[1]) != 3)
+    size_t length = 0;
+
+    while (token[length])
+    {
+        if (buffer[length] != token[length])
+        {
+            return VK_FALSE;
+        }
+
+        length++;
+    }
+
+    if (!(buffer[length] == ' ' || buffer[length] == '\t' || buffer[length] == '\r' || buffer[length] == '\n'))
     {
         return VK_FALSE;
     }
@@ -336,106 +636,172 @@ VkBool32 VKTS_APIENTRY parseVec2(const char* buffer, float vec2[2])
     return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY parseVec3(const char* buffer, float vec3[3])
+VkBool32 VKTS_APIENTRY parseString(const char* buffer, char* string, const uint32_t stringSize)
 {
-    if (!buffer || !vec3)
+    if (!buffer || !string)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    if (stringSize > VKTS_MAX_TOKEN_CHARS)
+    {
+    	return VK_FALSE;
+    }
+
+    const char* token;
+    uint32_t length;
 
-    if (sscanf(buffer, "%256s %f %f %f", token, &vec3[0], &vec3[1], &vec3[2]) != 4)
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextString(&buffer, string, stringSize);
 }
 
-VkBool32 VKTS_APIENTRY parseVec4(const char* buffer, float vec4[4])
+VkBool32 VKTS_APIENTRY parseStringTuple(const char* buffer, char* string0, const uint32_t string0Size, char* string1, const uint32_t string1Size)
 {
-    if (!buffer || !vec4)
+    if (!buffer || !string0 || !string1)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    if (string0Size > VKTS_MAX_TOKEN_CHARS || string1Size > VKTS_MAX_TOKEN_CHARS)
+    {
+    	return VK_FALSE;
+    }
 
-    if (sscanf(buffer, "%256s %f %f %f %f", token, &vec4[0], &vec4[1], &vec4[2], &vec4[3]) != 5)
+    const char* token;
+    uint32_t length;
+
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextString(&buffer, string0, string0Size) && parseNextString(&buffer, string1, string1Size);
 }
 
-VkBool32 VKTS_APIENTRY parseVec6(const char* buffer, float vec6[6])
+VkBool32 VKTS_APIENTRY parseStringFloat(const char* buffer, char* string, const uint32_t stringSize, float* scalar)
 {
-    if (!buffer || !vec6)
+    if (!buffer || !string || !scalar)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    if (stringSize > VKTS_MAX_TOKEN_CHARS)
+    {
+    	return VK_FALSE;
+    }
+
+    const char* token;
+    uint32_t length;
 
-    if (sscanf(buffer, "%256s %f %f %f %f %f %f", token, &vec6[0], &vec6[1], &vec6[2], &vec6[3], &vec6[4], &vec6[5]) != 7)
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextString(&buffer, string, stringSize) && parseNextFloat(&buffer, scalar);
 }
 
-VkBool32 VKTS_APIENTRY parseVec8(const char* buffer, float vec8[8])
+VkBool32 VKTS_APIENTRY parseStringBool(const char* buffer, char* string, const uint32_t stringSize, VkBool32* scalar)
 {
-    if (!buffer || !vec8)
+    if (!buffer || !string || !scalar)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    if (stringSize > VKTS_MAX_TOKEN_CHARS)
+    {
+    	return VK_FALSE;
+    }
+
+    const char* token;
+    uint32_t length;
 
-    if (sscanf(buffer, "%256s %f %f %f %f %f %f %f %f", token, &vec8[0], &vec8[1], &vec8[2], &vec8[3], &vec8[4], &vec8[5], &vec8[6], &vec8[7]) != 9)
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextString(&buffer, string, stringSize) && parseNextBool(&buffer, scalar);
 }
 
-VkBool32 VKTS_APIENTRY parseInt(const char* buffer, int32_t* scalar)
+VkBool32 VKTS_APIENTRY parseBool(const char* buffer, VkBool32* scalar)
 {
     if (!buffer || !scalar)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    const char* token;
+    uint32_t length;
 
-    if (sscanf(buffer, "%256s %d", token, scalar) != 2)
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextBool(&buffer, scalar);
 }
 
-VkBool32 VKTS_APIENTRY parseIVec3(const char* buffer, int32_t ivec3[3])
+VkBool32 VKTS_APIENTRY parseBoolTriple(const char* buffer, VkBool32* scalar0, VkBool32* scalar1, VkBool32* scalar2)
 {
-    if (!buffer || !ivec3)
+    if (!buffer || !scalar0 || !scalar1 || !scalar2)
     {
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    const char* token;
+    uint32_t length;
 
-    if (sscanf(buffer, "%256s %d %d %d", token, &ivec3[0], &ivec3[1], &ivec3[2]) != 4)
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextBool(&buffer, scalar0) && parseNextBool(&buffer, scalar1) && parseNextBool(&buffer, scalar2);
+}
+
+VkBool32 VKTS_APIENTRY parseFloat(const char* buffer, float* scalar)
+{
+    return parseFloats(buffer, scalar, 1);
+}
+
+VkBool32 VKTS_APIENTRY parseVec2(const char* buffer, float vec2[2])
+{
+    return parseFloats(buffer, vec2, 2);
+}
+
+VkBool32 VKTS_APIENTRY parseVec3(const char* buffer, float vec3[3])
+{
+    return parseFloats(buffer, vec3, 3);
+}
+
+VkBool32 VKTS_APIENTRY parseVec4(const char* buffer, float vec4[4])
+{
+    return parseFloats(buffer, vec4, 4);
+}
+
+VkBool32 VKTS_APIENTRY parseVec6(const char* buffer, float vec6[6])
+{
+    return parseFloats(buffer, vec6, 6);
+}
+
+VkBool32 VKTS_APIENTRY parseVec8(const char* buffer, float vec8[8])
+{
+    return parseFloats(buffer, vec8, 8);
+}
+
+VkBool32 VKTS_APIENTRY parseInt(const char* buffer, int32_t* scalar)
+{
+    return parseInts(buffer, scalar, 1);
+}
+
+VkBool32 VKTS_APIENTRY parseIVec3(const char* buffer, int32_t ivec3[3])
+{
+    return parseInts(buffer, ivec3, 3);
 }
 
 VkBool32 VKTS_APIENTRY parseUIntHex(const char* buffer, uint32_t* scalar)
@@ -445,14 +811,15 @@ VkBool32 VKTS_APIENTRY parseUIntHex(const char* buffer, uint32_t* scalar)
         return VK_FALSE;
     }
 
-    char token[VKTS_MAX_TOKEN_CHARS + 1];
+    const char* token;
+    uint32_t length;
 
-    if (sscanf(buffer, "%256s %x", token, scalar) != 2)
+    if (!parseNextToken(&buffer, &token, &length))
     {
         return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return parseNextUIntHex(&buffer, scalar);
 }
 
 }
@@ -35,6 +35,8 @@
 
 #define VKTS_MAX_RAM_STRING	128
 
+#define VKTS_PROFILE_ZONE_BUFFER_SIZE 65536
+
 namespace vkts
 {
 
@@ -0,0 +1,294 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/core/vkts_core.hpp>
+
+#include "fn_profile_internal.hpp"
+
+namespace vkts
+{
+
+typedef struct ProfileZoneEntry_
+{
+    const char* name;
+    uint64_t beginTime;
+    uint64_t endTime;
+} ProfileZoneEntry;
+
+/**
+ * Slot of the ring buffer. Relaxed atomics, as a reader can copy a slot while the owning thread overwrites it.
+ */
+typedef struct ProfileZoneSlot_
+{
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> beginTime;
+    std::atomic<uint64_t> endTime;
+} ProfileZoneSlot;
+
+/**
+ * Ring buffer, only written by its own thread. Readers copy and afterwards drop entries, which could have been overwritten meanwhile.
+ */
+typedef struct ProfileZoneBuffer_
+{
+    uint32_t threadIndex;
+    std::atomic<uint64_t> head;
+    ProfileZoneSlot slots[VKTS_PROFILE_ZONE_BUFFER_SIZE];
+} ProfileZoneBuffer;
+
+typedef std::shared_ptr<ProfileZoneBuffer> ProfileZoneBufferSP;
+
+static std::atomic<VkBool32> g_profileZoneEnabled(VK_FALSE);
+
+static const std::chrono::steady_clock::time_point g_profileZoneStartTime = std::chrono::steady_clock::now();
+
+static std::mutex g_profileZoneMutex;
+
+static std::vector<ProfileZoneBufferSP> g_profileZoneBuffers;
+
+static thread_local ProfileZoneBuffer* g_profileZoneBuffer = nullptr;
+
+static ProfileZoneBuffer* profileZoneGetBuffer()
+{
+    if (!g_profileZoneBuffer)
+    {
+        // Only once per thread. Buffers stay alive, so zones of finished threads can still be saved.
+
+        auto buffer = ProfileZoneBufferSP(new ProfileZoneBuffer());
+
+        std::lock_guard<std::mutex> profileZoneLockGuard(g_profileZoneMutex);
+
+        buffer->threadIndex = static_cast<uint32_t>(g_profileZoneBuffers.size());
+        buffer->head = 0;
+
+        g_profileZoneBuffers.push_back(buffer);
+
+        g_profileZoneBuffer = buffer.get();
+    }
+
+    return g_profileZoneBuffer;
+}
+
+static void profileZoneGather(std::vector<ProfileZoneEntry>& allEntries, std::vector<uint32_t>& allThreadIndices)
+{
+    std::lock_guard<std::mutex> profileZoneLockGuard(g_profileZoneMutex);
+
+    for (const auto& buffer : g_profileZoneBuffers)
+    {
+        uint64_t headBefore = buffer->head.load(std::memory_order_acquire);
+
+        uint64_t first = headBefore > VKTS_PROFILE_ZONE_BUFFER_SIZE ? headBefore - VKTS_PROFILE_ZONE_BUFFER_SIZE : 0;
+
+        size_t offset = allEntries.size();
+
+        for (uint64_t i = first; i < headBefore; i++)
+        {
+            const auto& slot = buffer->slots[i % VKTS_PROFILE_ZONE_BUFFER_SIZE];
+
+            ProfileZoneEntry entry;
+
+            entry.name = slot.name.load(std::memory_order_relaxed);
+            entry.beginTime = slot.beginTime.load(std::memory_order_relaxed);
+            entry.endTime = slot.endTime.load(std::memory_order_relaxed);
+
+            allEntries.push_back(entry);
+            allThreadIndices.push_back(buffer->threadIndex);
+        }
+
+        // Entries, which the owning thread did overwrite while copying, are dropped.
+        // The slot of head is written before head + 1 is published, so the entry head - size can already be torn.
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        uint64_t headAfter = buffer->head.load(std::memory_order_relaxed);
+
+        uint64_t overwritten = headAfter + 1 > VKTS_PROFILE_ZONE_BUFFER_SIZE ? headAfter + 1 - VKTS_PROFILE_ZONE_BUFFER_SIZE : 0;
+
+        if (overwritten > first)
+        {
+            size_t dropCount = static_cast<size_t>(glm::min(overwritten - first, headBefore - first));
+
+            allEntries.erase(allEntries.begin() + offset, allEntries.begin() + offset + dropCount);
+            allThreadIndices.erase(allThreadIndices.begin() + offset, allThreadIndices.begin() + offset + dropCount);
+        }
+    }
+}
+
+void VKTS_APIENTRY profileZoneSetEnabled(const VkBool32 enabled)
+{
+    g_profileZoneEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+VkBool32 VKTS_APIENTRY profileZoneIsEnabled()
+{
+    return g_profileZoneEnabled.load(std::memory_order_relaxed);
+}
+
+uint64_t VKTS_APIENTRY profileZoneGetTime()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_profileZoneStartTime).count());
+}
+
+void VKTS_APIENTRY profileZoneRecord(const char* name, const uint64_t beginTime, const uint64_t endTime)
+{
+    if (!name)
+    {
+        return;
+    }
+
+    auto buffer = profileZoneGetBuffer();
+
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+
+    auto& slot = buffer->slots[head % VKTS_PROFILE_ZONE_BUFFER_SIZE];
+
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.beginTime.store(beginTime, std::memory_order_relaxed);
+    slot.endTime.store(endTime, std::memory_order_relaxed);
+
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+VkBool32 VKTS_APIENTRY profileZoneReset()
+{
+    // The head is owned by the recording thread.
+
+    if (profileZoneIsEnabled())
+    {
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Zones can only be reset, while recording is disabled");
+
+        return VK_FALSE;
+    }
+
+    std::lock_guard<std::mutex> profileZoneLockGuard(g_profileZoneMutex);
+
+    for (const auto& buffer : g_profileZoneBuffers)
+    {
+        buffer->head.store(0, std::memory_order_relaxed);
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY profileZoneSaveChromeTrace(const char* filename)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<ProfileZoneEntry> allEntries;
+    std::vector<uint32_t> allThreadIndices;
+
+    profileZoneGather(allEntries, allThreadIndices);
+
+    std::string trace = "{\"traceEvents\":[\n";
+
+    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+
+    for (size_t i = 0; i < allEntries.size(); i++)
+    {
+        const auto& entry = allEntries[i];
+
+        // Chrome expects microseconds.
+
+        snprintf(buffer, VKTS_MAX_BUFFER_CHARS, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", i > 0 ? ",\n" : "", entry.name, allThreadIndices[i], (double) entry.beginTime / 1000.0, (double) (entry.endTime - entry.beginTime) / 1000.0);
+
+        trace += buffer;
+    }
+
+    trace += "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    return fileSaveBinaryData(filename, trace.c_str(), static_cast<uint32_t>(trace.size()));
+}
+
+VkBool32 VKTS_APIENTRY profileZoneSaveBinary(const char* filename)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<ProfileZoneEntry> allEntries;
+    std::vector<uint32_t> allThreadIndices;
+
+    profileZoneGather(allEntries, allThreadIndices);
+
+    // Name table, as the same name is used by many zones.
+
+    std::map<const char*, uint32_t> allNameIndices;
+    std::vector<const char*> allNames;
+
+    for (const auto& entry : allEntries)
+    {
+        if (allNameIndices.find(entry.name) == allNameIndices.end())
+        {
+            allNameIndices[entry.name] = static_cast<uint32_t>(allNames.size());
+
+            allNames.push_back(entry.name);
+        }
+    }
+
+    std::vector<uint8_t> data;
+
+    auto append = [&data](const void* value, const size_t size)
+    {
+        data.insert(data.end(), static_cast<const uint8_t*>(value), static_cast<const uint8_t*>(value) + size);
+    };
+
+    const uint32_t version = 1;
+    const uint32_t nameCount = static_cast<uint32_t>(allNames.size());
+    const uint32_t zoneCount = static_cast<uint32_t>(allEntries.size());
+
+    append("VKTSZONE", 8);
+    append(&version, sizeof(uint32_t));
+    append(&nameCount, sizeof(uint32_t));
+    append(&zoneCount, sizeof(uint32_t));
+
+    for (const char* name : allNames)
+    {
+        uint32_t length = static_cast<uint32_t>(strlen(name));
+
+        append(&length, sizeof(uint32_t));
+        append(name, length);
+    }
+
+    for (size_t i = 0; i < allEntries.size(); i++)
+    {
+        const auto& entry = allEntries[i];
+
+        uint32_t nameIndex = allNameIndices[entry.name];
+        uint64_t duration = entry.endTime - entry.beginTime;
+
+        append(&nameIndex, sizeof(uint32_t));
+        append(&allThreadIndices[i], sizeof(uint32_t));
+        append(&entry.beginTime, sizeof(uint64_t));
+        append(&duration, sizeof(uint64_t));
+    }
+
+    return fileSaveBinaryData(filename, data.data(), static_cast<uint32_t>(data.size()));
+}
+
+}
@@ -57,9 +57,9 @@ const char* TextBuffer::getString() const
     return static_cast<const char*>(text.c_str());
 }
 
-uint32_t TextBuffer::getLength() const
+uint64_t TextBuffer::getLength() const
 {
-    return (uint32_t)text.length();
+    return (uint64_t)text.length();
 }
 
 VkBool32 TextBuffer::seek(const int64_t offset, const VkTsSearch search)
@@ -73,7 +73,7 @@ VkBool32 TextBuffer::seek(const int64_t offset, const VkTsSearch search)
                 return VK_FALSE;
             }
 
-            pos = static_cast<uint32_t>(offset);
+            pos = static_cast<uint64_t>(offset);
 
             return VK_TRUE;
         }
@@ -87,7 +87,7 @@ VkBool32 TextBuffer::seek(const int64_t offset, const VkTsSearch search)
                     return VK_FALSE;
                 }
 
-                pos -= static_cast<uint32_t>(-offset);
+                pos -= static_cast<uint64_t>(-offset);
             }
             else if (offset > 0)
             {
@@ -96,7 +96,7 @@ VkBool32 TextBuffer::seek(const int64_t offset, const VkTsSearch search)
                     return VK_FALSE;
                 }
 
-                pos += static_cast<uint32_t>(offset);
+                pos += static_cast<uint64_t>(offset);
             }
 
             return VK_TRUE;
@@ -114,7 +114,7 @@ const char* TextBuffer::gets(char* str, const uint32_t num)
         return nullptr;
     }
 
-    if (pos >= (uint32_t)text.length())
+    if (pos >= (uint64_t)text.length())
     {
         return nullptr;
     }
@@ -132,7 +132,7 @@ const char* TextBuffer::gets(char* str, const uint32_t num)
         {
             str[strIndex] = '\0';
 
-            if (pos < (uint32_t)text.length() && text.c_str()[pos] == '\n')
+            if (pos < (uint64_t)text.length() && text.c_str()[pos] == '\n')
             {
             	pos++;
             }
@@ -157,7 +157,7 @@ const char* TextBuffer::gets(char* str, const uint32_t num)
         }
 
         // End of buffer.
-        if (pos == (uint32_t)text.length())
+        if (pos == (uint64_t)text.length())
         {
 			str[strIndex] = '\0';
 
@@ -175,11 +175,11 @@ VkBool32 TextBuffer::puts(const char* str)
         return VK_FALSE;
     }
 
-    if (pos >= (uint32_t)text.length())
+    if (pos >= (uint64_t)text.length())
     {
         text.append(str);
 
-        pos = (uint32_t)text.length();
+        pos = (uint64_t)text.length();
 
         return VK_TRUE;
     }
@@ -188,7 +188,7 @@ VkBool32 TextBuffer::puts(const char* str)
 
     uint32_t strIndex = 0;
 
-    while (strIndex < strLen && pos < (uint32_t)text.length())
+    while (strIndex < strLen && pos < (uint64_t)text.length())
     {
         text[pos] = str[strIndex];
 
@@ -208,11 +208,16 @@ VkBool32 TextBuffer::puts(const char* str)
         strIndex++;
     }
 
-    pos = (uint32_t)text.length();
+    pos = (uint64_t)text.length();
 
     return VK_TRUE;
 }
 
+VkBool32 TextBuffer::isReadOnly() const
+{
+    return VK_FALSE;
+}
+
 //
 // ICloneable
 //
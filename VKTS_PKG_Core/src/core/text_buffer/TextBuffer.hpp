@@ -39,7 +39,7 @@ private:
 
     std::string text;
 
-    uint32_t pos;
+    uint64_t pos;
 
 public:
 
@@ -59,7 +59,7 @@ public:
 
     virtual const char* getString() const override;
 
-    virtual uint32_t getLength() const override;
+    virtual uint64_t getLength() const override;
 
     virtual VkBool32 seek(const int64_t offset, const VkTsSearch search) override;
 
@@ -67,6 +67,8 @@ public:
 
     virtual VkBool32 puts(const char* str) override;
 
+    virtual VkBool32 isReadOnly() const override;
+
     //
     // ICloneable
     //
@@ -26,12 +26,77 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+#include "../data/ImageData.hpp"
+
 #define VKTS_CACHE_DIRECTORY "cache"
 
+#define VKTS_CACHE_INDEX_FILENAME VKTS_CACHE_DIRECTORY "/index.bin"
+
+// Increment, if the layout of an entry or the result of any cached processing changes.
+#define VKTS_CACHE_VERSION 1
+
+#define VKTS_CACHE_DEFAULT_MAX_SIZE (1024ull * 1024ull * 1024ull)
+
+#define VKTS_CACHE_INDEX_MAGIC "VKTSIDX"
+#define VKTS_CACHE_IMAGE_MAGIC "VKTSIMG"
+
+#define VKTS_CACHE_HASH_OFFSET 0xcbf29ce484222325ull
+#define VKTS_CACHE_HASH_PRIME 0x100000001b3ull
+
 namespace vkts
 {
 
-static VkBool32 g_cacheEnabled = VK_TRUE;
+typedef struct _CacheIndexHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t entryCount;
+	uint64_t tick;
+} CacheIndexHeader;
+
+static_assert(sizeof(CacheIndexHeader) == 24, "Cache index header has to be packed");
+
+typedef struct _CacheEntry {
+	uint64_t key;
+	uint64_t size;
+	uint64_t lastUse;
+} CacheEntry;
+
+static_assert(sizeof(CacheEntry) == 24, "Cache entry has to be packed");
+
+typedef struct _CacheImageHeader {
+	uint32_t nameLength;
+	uint32_t imageType;
+	uint32_t format;
+	uint32_t width;
+	uint32_t height;
+	uint32_t depth;
+	uint32_t mipLevels;
+	uint32_t arrayLayers;
+	uint32_t offsetCount;
+	uint32_t size;
+	float maxLuminance;
+	uint32_t reserved;
+} CacheImageHeader;
+
+static_assert(sizeof(CacheImageHeader) == 48, "Cache image header has to be packed");
+
+static std::atomic<VkBool32> g_cacheEnabled(VK_TRUE);
+
+// Guards the index. The entries itself are written under a unique name and renamed, when complete.
+static std::mutex g_cacheMutex;
+
+static VkBool32 g_cacheIndexLoaded = VK_FALSE;
+
+// Set, if only the usage of entries changed. The index is then written with the next entry or by cacheFlush.
+static VkBool32 g_cacheIndexDirty = VK_FALSE;
+
+static Map<uint64_t, CacheEntry> g_allCacheEntries;
+
+static uint64_t g_cacheTick = 0;
+
+static uint64_t g_cacheMaxSize = VKTS_CACHE_DEFAULT_MAX_SIZE;
+
+static std::atomic<uint32_t> g_cacheTemporaryCounter(0);
 
 
 static std::string VKTS_APIENTRY cacheGetDirectory(const char* filename)
@@ -68,6 +133,516 @@ static std::string cacheGetFilename(const char* filename)
 	return std::string(VKTS_CACHE_DIRECTORY) + "/" + std::string(filename);
 }
 
+static uint64_t cacheHash(uint64_t hash, const void* data, const size_t size)
+{
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	size_t i = 0;
+
+	// Word wise, as the sources are whole images and meshes.
+
+	for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+	{
+		uint64_t word;
+
+		memcpy(&word, &bytes[i], sizeof(uint64_t));
+
+		hash = (hash ^ word) * VKTS_CACHE_HASH_PRIME;
+		hash ^= hash >> 32;
+	}
+
+	for (; i < size; i++)
+	{
+		hash = (hash ^ (uint64_t)bytes[i]) * VKTS_CACHE_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+static std::string cacheGetEntryFilename(const uint64_t key)
+{
+	char filename[VKTS_MAX_BUFFER_CHARS + 1];
+
+	snprintf(filename, VKTS_MAX_BUFFER_CHARS, "%s/%016" PRIx64 ".bin", VKTS_CACHE_DIRECTORY, key);
+
+	return std::string(filename);
+}
+
+static VkBool32 cacheSaveAtomic(const std::string& filename, const void* data, const uint32_t size)
+{
+	std::string temporaryFilename = filename + "." + std::to_string(g_cacheTemporaryCounter++) + ".tmp";
+
+	if (!fileSaveBinaryData(temporaryFilename.c_str(), data, size))
+	{
+		fileRemove(temporaryFilename.c_str());
+
+		return VK_FALSE;
+	}
+
+	if (!fileRename(temporaryFilename.c_str(), filename.c_str()))
+	{
+		fileRemove(temporaryFilename.c_str());
+
+		return VK_FALSE;
+	}
+
+	return VK_TRUE;
+}
+
+//
+// The following functions have to be called with g_cacheMutex being locked.
+//
+
+static void cacheLoadIndex()
+{
+	if (g_cacheIndexLoaded)
+	{
+		return;
+	}
+
+	g_cacheIndexLoaded = VK_TRUE;
+
+	g_allCacheEntries.clear();
+
+	g_cacheTick = 0;
+
+	auto buffer = fileLoadBinary(VKTS_CACHE_INDEX_FILENAME);
+
+	if (!buffer.get() || buffer->getSize() < sizeof(CacheIndexHeader))
+	{
+		return;
+	}
+
+	CacheIndexHeader header;
+
+	memcpy(&header, buffer->getByteData(), sizeof(CacheIndexHeader));
+
+	// An index of another version is dropped. Its entries can not be hit anymore, as the version is part of every key.
+
+	if (memcmp(header.magic, VKTS_CACHE_INDEX_MAGIC, sizeof(header.magic)) != 0 || header.version != VKTS_CACHE_VERSION || buffer->getSize() != sizeof(CacheIndexHeader) + (uint64_t)header.entryCount * sizeof(CacheEntry))
+	{
+		logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Cache index outdated or corrupt");
+
+		return;
+	}
+
+	const uint8_t* data = buffer->getByteData() + sizeof(CacheIndexHeader);
+
+	for (uint32_t i = 0; i < header.entryCount; i++)
+	{
+		CacheEntry entry;
+
+		memcpy(&entry, &data[i * sizeof(CacheEntry)], sizeof(CacheEntry));
+
+		g_allCacheEntries.set(entry.key, entry);
+	}
+
+	g_cacheTick = header.tick;
+}
+
+static VkBool32 cacheSaveIndex()
+{
+	std::vector<uint8_t> data(sizeof(CacheIndexHeader) + g_allCacheEntries.size() * sizeof(CacheEntry));
+
+	CacheIndexHeader header;
+
+	memcpy(header.magic, VKTS_CACHE_INDEX_MAGIC, sizeof(header.magic));
+	header.version = VKTS_CACHE_VERSION;
+	header.entryCount = g_allCacheEntries.size();
+	header.tick = g_cacheTick;
+
+	memcpy(&data[0], &header, sizeof(CacheIndexHeader));
+
+	for (uint32_t i = 0; i < g_allCacheEntries.size(); i++)
+	{
+		memcpy(&data[sizeof(CacheIndexHeader) + i * sizeof(CacheEntry)], &g_allCacheEntries.valueAt(i), sizeof(CacheEntry));
+	}
+
+	if (!cacheSaveAtomic(VKTS_CACHE_INDEX_FILENAME, &data[0], (uint32_t)data.size()))
+	{
+		return VK_FALSE;
+	}
+
+	g_cacheIndexDirty = VK_FALSE;
+
+	return VK_TRUE;
+}
+
+static void cacheEvict(const uint64_t keepKey)
+{
+	uint64_t totalSize = 0;
+
+	for (uint32_t i = 0; i < g_allCacheEntries.size(); i++)
+	{
+		totalSize += g_allCacheEntries.valueAt(i).size;
+	}
+
+	if (totalSize <= g_cacheMaxSize)
+	{
+		return;
+	}
+
+	// Sorted once from the least to the most recently used entry.
+
+	std::vector<CacheEntry> allEntries;
+
+	allEntries.reserve(g_allCacheEntries.size());
+
+	for (uint32_t i = 0; i < g_allCacheEntries.size(); i++)
+	{
+		if (g_allCacheEntries.valueAt(i).key != keepKey)
+		{
+			allEntries.push_back(g_allCacheEntries.valueAt(i));
+		}
+	}
+
+	std::sort(allEntries.begin(), allEntries.end(), [](const CacheEntry& a, const CacheEntry& b) { return a.lastUse < b.lastUse; });
+
+	for (uint32_t i = 0; i < (uint32_t)allEntries.size() && totalSize > g_cacheMaxSize; i++)
+	{
+		fileRemove(cacheGetEntryFilename(allEntries[i].key).c_str());
+
+		totalSize -= allEntries[i].size;
+
+		g_allCacheEntries.remove(allEntries[i].key);
+
+		g_cacheIndexDirty = VK_TRUE;
+	}
+}
+
+//
+
+static VkBool32 cacheSaveData(const uint64_t key, const void* data, const uint32_t size)
+{
+	if (!g_cacheEnabled || key == 0 || !data || size == 0)
+	{
+		return VK_FALSE;
+	}
+
+	if (!fileCreateDirectory(VKTS_CACHE_DIRECTORY))
+	{
+		return VK_FALSE;
+	}
+
+	// Written outside of the lock, as only the rename has to be atomic.
+
+	if (!cacheSaveAtomic(cacheGetEntryFilename(key), data, size))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not save cache entry %016" PRIx64, key);
+
+		return VK_FALSE;
+	}
+
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	cacheLoadIndex();
+
+	CacheEntry entry;
+
+	entry.key = key;
+	entry.size = size;
+	entry.lastUse = ++g_cacheTick;
+
+	g_allCacheEntries.set(key, entry);
+
+	cacheEvict(key);
+
+	return cacheSaveIndex();
+}
+
+static void cacheAppend(std::vector<uint8_t>& data, const void* source, const size_t size)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	size_t offset = data.size();
+
+	data.resize(offset + size);
+
+	memcpy(&data[offset], source, size);
+}
+
+static VkBool32 cacheRead(void* destination, const IBinaryBufferSP& buffer, uint64_t& offset, const uint64_t size)
+{
+	if (offset + size > buffer->getSize())
+	{
+		return VK_FALSE;
+	}
+
+	if (size > 0)
+	{
+		memcpy(destination, buffer->getByteData() + offset, (size_t)size);
+	}
+
+	offset += size;
+
+	return VK_TRUE;
+}
+
+uint64_t VKTS_APIENTRY cacheCreateKey(const void* data, const size_t size, const std::string& parameters)
+{
+	uint64_t hash = VKTS_CACHE_HASH_OFFSET;
+
+	uint32_t version = VKTS_CACHE_VERSION;
+
+	hash = cacheHash(hash, &version, sizeof(version));
+
+	uint64_t dataSize = (uint64_t)size;
+
+	hash = cacheHash(hash, &dataSize, sizeof(dataSize));
+
+	if (data)
+	{
+		hash = cacheHash(hash, data, size);
+	}
+
+	hash = cacheHash(hash, parameters.c_str(), parameters.length());
+
+	// Zero is reserved for no key.
+
+	return hash != 0 ? hash : 1;
+}
+
+uint64_t VKTS_APIENTRY cacheCreateKey(const IImageDataSP& imageData, const std::string& parameters)
+{
+	if (!imageData.get() || !imageData->getData())
+	{
+		return 0;
+	}
+
+	uint64_t description[7];
+
+	description[0] = cacheCreateKey(imageData->getData(), imageData->getSize(), parameters);
+	description[1] = (uint64_t)imageData->getFormat();
+	description[2] = (uint64_t)imageData->getWidth();
+	description[3] = (uint64_t)imageData->getHeight();
+	description[4] = (uint64_t)imageData->getDepth();
+	description[5] = (uint64_t)imageData->getMipLevels();
+	description[6] = (uint64_t)imageData->getArrayLayers();
+
+	return cacheCreateKey(description, sizeof(description), "");
+}
+
+uint64_t VKTS_APIENTRY cacheCreateKey(const uint64_t key, const std::string& parameters)
+{
+	if (key == 0)
+	{
+		return 0;
+	}
+
+	return cacheCreateKey(&key, sizeof(key), parameters);
+}
+
+uint64_t VKTS_APIENTRY cacheGetMaxSize()
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	return g_cacheMaxSize;
+}
+
+void VKTS_APIENTRY cacheSetMaxSize(const uint64_t maxSize)
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	g_cacheMaxSize = maxSize;
+
+	if (g_cacheIndexLoaded)
+	{
+		cacheEvict(0);
+
+		cacheSaveIndex();
+	}
+}
+
+IBinaryBufferSP VKTS_APIENTRY cacheLoadBinary(const uint64_t key)
+{
+	if (!g_cacheEnabled || key == 0)
+	{
+		return IBinaryBufferSP();
+	}
+
+	std::string filename = cacheGetEntryFilename(key);
+
+	{
+		std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+		cacheLoadIndex();
+
+		if (g_allCacheEntries.find(key) == g_allCacheEntries.size())
+		{
+			return IBinaryBufferSP();
+		}
+	}
+
+	auto buffer = fileMapBinary(filename.c_str(), VKTS_FILE_ACCESS_SEQUENTIAL);
+
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	auto index = g_allCacheEntries.find(key);
+
+	if (index == g_allCacheEntries.size())
+	{
+		// Evicted in the meantime.
+
+		return IBinaryBufferSP();
+	}
+
+	auto& entry = g_allCacheEntries.valueAt(index);
+
+	if (!buffer.get() || buffer->getSize() != entry.size)
+	{
+		logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Dropping cache entry %016" PRIx64, key);
+
+		g_allCacheEntries.removeAt(index);
+
+		g_cacheIndexDirty = VK_TRUE;
+
+		return IBinaryBufferSP();
+	}
+
+	// Only updated in memory, so a hit never writes the index.
+
+	entry.lastUse = ++g_cacheTick;
+
+	g_cacheIndexDirty = VK_TRUE;
+
+	return buffer;
+}
+
+VkBool32 VKTS_APIENTRY cacheSaveBinary(const uint64_t key, const void* data, const uint32_t size)
+{
+	return cacheSaveData(key, data, size);
+}
+
+VkBool32 VKTS_APIENTRY cacheSaveBinary(const uint64_t key, const IBinaryBufferSP& buffer)
+{
+	if (!buffer.get() || buffer->getSize() > UINT32_MAX)
+	{
+		return VK_FALSE;
+	}
+
+	return cacheSaveData(key, buffer->getData(), (uint32_t)buffer->getSize());
+}
+
+SmartPointerVector<IImageDataSP> VKTS_APIENTRY cacheLoadImageDatas(const uint64_t key)
+{
+	SmartPointerVector<IImageDataSP> allImageData;
+
+	auto buffer = cacheLoadBinary(key);
+
+	if (!buffer.get())
+	{
+		return allImageData;
+	}
+
+	uint64_t offset = 0;
+
+	char magic[8];
+	uint32_t count;
+	uint32_t reserved;
+
+	if (!cacheRead(magic, buffer, offset, sizeof(magic)) || memcmp(magic, VKTS_CACHE_IMAGE_MAGIC, sizeof(magic)) != 0 || !cacheRead(&count, buffer, offset, sizeof(count)) || !cacheRead(&reserved, buffer, offset, sizeof(reserved)))
+	{
+		return allImageData;
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		CacheImageHeader header;
+
+		if (!cacheRead(&header, buffer, offset, sizeof(CacheImageHeader)))
+		{
+			allImageData.clear();
+
+			return allImageData;
+		}
+
+		std::string name(header.nameLength, '\0');
+
+		std::vector<uint32_t> allOffsets(header.offsetCount);
+
+		if (!cacheRead(&name[0], buffer, offset, header.nameLength) || !cacheRead(allOffsets.data(), buffer, offset, header.offsetCount * sizeof(uint32_t)) || offset + header.size > buffer->getSize())
+		{
+			allImageData.clear();
+
+			return allImageData;
+		}
+
+		VkExtent3D extent = {header.width, header.height, header.depth};
+
+		auto imageData = IImageDataSP(new ImageData(name, (VkImageType)header.imageType, (VkFormat)header.format, extent, header.mipLevels, header.arrayLayers, allOffsets, buffer->getByteData() + offset, header.size, header.maxLuminance));
+
+		if (!imageData.get() || !imageData->getData())
+		{
+			allImageData.clear();
+
+			return allImageData;
+		}
+
+		offset += header.size;
+
+		allImageData.append(imageData);
+	}
+
+	if (offset != buffer->getSize())
+	{
+		allImageData.clear();
+	}
+
+	return allImageData;
+}
+
+VkBool32 VKTS_APIENTRY cacheSaveImageDatas(const uint64_t key, const SmartPointerVector<IImageDataSP>& allImageData)
+{
+	if (!g_cacheEnabled || key == 0 || allImageData.size() == 0)
+	{
+		return VK_FALSE;
+	}
+
+	std::vector<uint8_t> data;
+
+	uint32_t count = allImageData.size();
+	uint32_t reserved = 0;
+
+	cacheAppend(data, VKTS_CACHE_IMAGE_MAGIC, 8);
+	cacheAppend(data, &count, sizeof(count));
+	cacheAppend(data, &reserved, sizeof(reserved));
+
+	for (uint32_t i = 0; i < allImageData.size(); i++)
+	{
+		const auto& imageData = allImageData[i];
+
+		if (!imageData.get() || !imageData->getData())
+		{
+			return VK_FALSE;
+		}
+
+		CacheImageHeader header;
+
+		header.nameLength = (uint32_t)imageData->getName().length();
+		header.imageType = (uint32_t)imageData->getImageType();
+		header.format = (uint32_t)imageData->getFormat();
+		header.width = imageData->getWidth();
+		header.height = imageData->getHeight();
+		header.depth = imageData->getDepth();
+		header.mipLevels = imageData->getMipLevels();
+		header.arrayLayers = imageData->getArrayLayers();
+		header.offsetCount = (uint32_t)imageData->getAllOffsets().size();
+		header.size = imageData->getSize();
+		header.maxLuminance = imageData->getMaxLuminance();
+		header.reserved = 0;
+
+		cacheAppend(data, &header, sizeof(CacheImageHeader));
+		cacheAppend(data, imageData->getName().c_str(), header.nameLength);
+		cacheAppend(data, imageData->getAllOffsets().data(), header.offsetCount * sizeof(uint32_t));
+		cacheAppend(data, imageData->getData(), header.size);
+	}
+
+	return cacheSaveData(key, &data[0], (uint32_t)data.size());
+}
+
 VkBool32 VKTS_APIENTRY cacheGetEnabled()
 {
 	return g_cacheEnabled;
@@ -78,6 +653,18 @@ void VKTS_APIENTRY cacheSetEnabled(const VkBool32 enabled)
 	g_cacheEnabled = enabled;
 }
 
+VkBool32 VKTS_APIENTRY cacheFlush()
+{
+	std::lock_guard<std::mutex> cacheLockGuard(g_cacheMutex);
+
+	if (!g_cacheIndexLoaded || !g_cacheIndexDirty)
+	{
+		return VK_TRUE;
+	}
+
+	return cacheSaveIndex();
+}
+
 VkBool32 VKTS_APIENTRY cacheSaveImageData(const IImageDataSP& imageData, const std::string& filename)
 {
 	if (!imageData.get())
@@ -57,6 +57,52 @@ void ImageData::reset()
     allOffsets.clear();
 
     maxLuminance = 1.0f;
+
+    updateTexelAccess();
+}
+
+void ImageData::updateTexelAccess()
+{
+    texels = buffer.get() ? buffer->getByteData() : nullptr;
+
+    // Only a buffer, which is not read only, owns its memory.
+    writableTexels = (texels && !buffer->isReadOnly()) ? const_cast<uint8_t*>(texels) : nullptr;
+
+    bytesPerTexel = numberChannels * bytesPerChannel;
+
+    readTexels = imageDataGetReadTexelsFunction(format);
+    writeTexels = imageDataGetWriteTexelsFunction(format);
+}
+
+VkBool32 ImageData::getRowOffset(uint32_t& rowOffset, uint32_t& width, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const
+{
+	VkExtent3D currentExtent;
+	uint32_t offset;
+
+	if (BLOCK || !texels || !getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer) || y >= currentExtent.height || z >= currentExtent.depth)
+	{
+		return VK_FALSE;
+	}
+
+	width = currentExtent.width;
+
+	rowOffset = offset + (z * currentExtent.height + y) * currentExtent.width * bytesPerTexel;
+
+	return VK_TRUE;
+}
+
+glm::vec4 ImageData::fetchTexel(const uint8_t* levelTexels, const VkExtent3D& levelExtent, const int32_t x, const int32_t y, const int32_t z) const
+{
+	if (x < 0 || y < 0 || z < 0 || x >= (int32_t)levelExtent.width || y >= (int32_t)levelExtent.height || z >= (int32_t)levelExtent.depth)
+	{
+		return glm::vec4(NAN, NAN, NAN, NAN);
+	}
+
+	glm::vec4 result;
+
+	readTexels(&result, &levelTexels[(((size_t)z * (size_t)levelExtent.height + (size_t)y) * (size_t)levelExtent.width + (size_t)x) * (size_t)bytesPerTexel], 1);
+
+	return result;
 }
 
 int32_t ImageData::getTexelLocation(float& fraction, const float a, const int32_t size, const VkSamplerAddressMode addressMode) const
@@ -219,6 +265,8 @@ ImageData::ImageData(const std::string& name, const VkImageType imageType, const
     SRGB = imageDataIsSRGB(format);
     bytesPerChannel = imageDataGetBytesPerChannel(format);
     numberChannels = imageDataGetNumberChannels(format);
+
+    updateTexelAccess();
 }
 
 ImageData::ImageData(const std::string& name, const VkImageType imageType, const VkFormat& format, const VkExtent3D& extent, const uint32_t mipLevels, const uint32_t arrayLayers, const std::vector<uint32_t>& allOffsets, const IBinaryBufferSP& buffer, const float maxLuminance) :
@@ -237,6 +285,8 @@ ImageData::ImageData(const std::string& name, const VkImageType imageType, const
     SRGB = imageDataIsSRGB(format);
     bytesPerChannel = imageDataGetBytesPerChannel(format);
     numberChannels = imageDataGetNumberChannels(format);
+
+    updateTexelAccess();
 }
 
 ImageData::~ImageData()
@@ -312,7 +362,7 @@ uint32_t ImageData::getSize() const
 {
     if (buffer.get())
     {
-        return buffer->getSize();
+        return static_cast<uint32_t>(buffer->getSize());
     }
 
     return 0;
@@ -346,13 +396,13 @@ VkBool32 ImageData::copy(void* data, const uint32_t mipLevel, const uint32_t arr
 
     	if (!getExtentAndOffset(currentExtent, nextOffset, mipLevel + 1, arrayLayer))
     	{
-        	if (!getExtentAndOffset(currentExtent, nextOffset, mipLevel, arrayLayer + 1))
+        	if (!getExtentAndOffset(currentExtent, nextOffset, 0, arrayLayer + 1))
         	{
         		nextOffset = getSize();
         	}
     	}
 
-    	memcpy(&currentTargetBuffer[subresourceLayout.offset], &currentSourceBuffer[offset], nextOffset - offset);
+    	memcpy(&currentTargetBuffer[subresourceLayout.offset], currentSourceBuffer, nextOffset - offset);
 
     	return VK_TRUE;
     }
@@ -386,7 +436,7 @@ VkBool32 ImageData::copy(void* data, const uint32_t mipLevel, const uint32_t arr
 
 VkBool32 ImageData::upload(const void* data, const uint32_t mipLevel, const uint32_t arrayLayer, const VkSubresourceLayout& subresourceLayout) const
 {
-    if (!data || mipLevel >= mipLevels || arrayLayer >= arrayLayers || !getData())
+    if (!data || mipLevel >= mipLevels || arrayLayer >= arrayLayers || !writableTexels)
     {
         return VK_FALSE;
     }
@@ -405,11 +455,6 @@ VkBool32 ImageData::upload(const void* data, const uint32_t mipLevel, const uint
 
     const uint8_t* currentSourceBuffer = static_cast<const uint8_t*>(data);
 
-    if (!buffer->seek(offset, VKTS_SEARCH_ABSOLUTE))
-    {
-        return VK_FALSE;
-    }
-
     //
 
     if (BLOCK)
@@ -418,33 +463,37 @@ VkBool32 ImageData::upload(const void* data, const uint32_t mipLevel, const uint
 
     	if (!getExtentAndOffset(currentExtent, nextOffset, mipLevel + 1, arrayLayer))
     	{
-        	if (!getExtentAndOffset(currentExtent, nextOffset, mipLevel, arrayLayer + 1))
+        	if (!getExtentAndOffset(currentExtent, nextOffset, 0, arrayLayer + 1))
         	{
         		nextOffset = getSize();
         	}
     	}
 
-    	buffer->write(&currentSourceBuffer[subresourceLayout.offset], 1, nextOffset - offset);
+    	memcpy(&writableTexels[offset], &currentSourceBuffer[subresourceLayout.offset], nextOffset - offset);
 
 		return VK_TRUE;
     }
 
     //
 
-    if (bytesPerChannel == 0 || numberChannels == 0)
+    if (bytesPerTexel == 0)
     {
         return VK_FALSE;
     }
 
     const uint8_t* currentSourceChannel = nullptr;
 
+    uint8_t* currentTargetChannel = &writableTexels[offset];
+
     for (uint32_t z = 0; z < currentExtent.depth; z++)
     {
         for (uint32_t y = 0; y < currentExtent.height; y++)
         {
             currentSourceChannel = &currentSourceBuffer[y * subresourceLayout.rowPitch + z * subresourceLayout.depthPitch + subresourceLayout.offset];
 
-            buffer->write(currentSourceChannel, 1, numberChannels * bytesPerChannel * currentExtent.width);
+            memcpy(currentTargetChannel, currentSourceChannel, bytesPerTexel * currentExtent.width);
+
+            currentTargetChannel += bytesPerTexel * currentExtent.width;
         }
     }
 
@@ -493,132 +542,89 @@ const std::vector<uint32_t>& ImageData::getAllOffsets() const
 
 void ImageData::setTexel(const glm::vec4& rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer)
 {
-    if (x >= extent.width || y >= extent.height || z >= extent.depth || mipLevel >= mipLevels || arrayLayer >= arrayLayers || BLOCK || !getData())
-    {
-        return;
-    }
+    writeRow(&rgba, x, y, z, 1, mipLevel, arrayLayer);
+}
 
-	VkExtent3D currentExtent;
-	uint32_t offset;
+glm::vec4 ImageData::getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const
+{
+    glm::vec4 result;
 
-    if (!getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer))
+    if (!readRow(&result, x, y, z, 1, mipLevel, arrayLayer))
     {
-    	return;
+        return glm::vec4(NAN, NAN, NAN, NAN);
     }
 
-    //
+    return result;
+}
 
-    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)extent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)extent.width * (int64_t)extent.height, VKTS_SEARCH_ABSOLUTE))
-    {
-    	return;
-    }
+const void* ImageData::getRowData(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const
+{
+    uint32_t rowOffset;
+    uint32_t width;
 
-    if (UNORM)
+    if (!getRowOffset(rowOffset, width, y, z, mipLevel, arrayLayer))
     {
-        uint8_t texelStart[4];
-
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
-        {
-        	uint32_t currentTargetChannelIndex = currentChannelIndex;
-
-            if (format == VK_FORMAT_B8G8R8_UNORM || format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8_SRGB || format == VK_FORMAT_B8G8R8A8_SRGB)
-            {
-                if (currentChannelIndex == 0)
-                {
-                    currentTargetChannelIndex = 2;
-                }
-                else if (currentChannelIndex == 2)
-                {
-                    currentTargetChannelIndex = 0;
-                }
-            }
-
-            texelStart[currentTargetChannelIndex] = (uint8_t)(rgba[currentChannelIndex] * 255.0f);
-        }
-
-        buffer->write(texelStart, 1, numberChannels);
+        return nullptr;
     }
-    else if (SFLOAT)
-    {
-        float texelStart[4];
 
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
-        {
-            texelStart[currentChannelIndex] = rgba[currentChannelIndex];
-        }
-
-        buffer->write(texelStart, sizeof(float), numberChannels);
-    }
+    return &texels[rowOffset];
 }
 
-glm::vec4 ImageData::getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const
+void* ImageData::getWritableRowData(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer)
 {
-    if (x >= extent.width || y >= extent.height || z >= extent.depth || mipLevel >= mipLevels || arrayLayer >= arrayLayers || BLOCK || !getData())
+    uint32_t rowOffset;
+    uint32_t width;
+
+    if (!writableTexels || !getRowOffset(rowOffset, width, y, z, mipLevel, arrayLayer))
     {
-        return glm::vec4(NAN, NAN, NAN, NAN);
+        return nullptr;
     }
 
-	VkExtent3D currentExtent{0, 0, 0};
-	uint32_t offset = 0;
-
-    getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer);
+    return &writableTexels[rowOffset];
+}
 
-    //
+VkBool32 ImageData::readRow(glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count, const uint32_t mipLevel, const uint32_t arrayLayer) const
+{
+    uint32_t rowOffset;
+    uint32_t width;
 
-    if (!buffer->seek((int64_t)offset + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)x + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)y * (int64_t)extent.width + (int64_t)numberChannels * (int64_t)bytesPerChannel * (int64_t)z * (int64_t)extent.width * (int64_t)extent.height, VKTS_SEARCH_ABSOLUTE))
+    if (!rgba || !getRowOffset(rowOffset, width, y, z, mipLevel, arrayLayer) || x > width || count > width - x)
     {
-    	 return glm::vec4(NAN, NAN, NAN, NAN);
+        return VK_FALSE;
     }
 
-    glm::vec4 result(0.0f, 0.0f, 0.0f, 1.0f);
+    readTexels(rgba, &texels[rowOffset + x * bytesPerTexel], count);
 
-    if (UNORM)
-    {
-        uint8_t texelStart[4];
+    return VK_TRUE;
+}
 
-        buffer->read(texelStart, 1, numberChannels);
+VkBool32 ImageData::writeRow(const glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count, const uint32_t mipLevel, const uint32_t arrayLayer)
+{
+    uint32_t rowOffset;
+    uint32_t width;
 
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
-        {
-        	uint32_t currentTargetChannelIndex = currentChannelIndex;
-
-            if (format == VK_FORMAT_B8G8R8_UNORM || format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8_SRGB || format == VK_FORMAT_B8G8R8A8_SRGB)
-            {
-                if (currentChannelIndex == 0)
-                {
-                    currentTargetChannelIndex = 2;
-                }
-                else if (currentChannelIndex == 2)
-                {
-                    currentTargetChannelIndex = 0;
-                }
-            }
-
-            result[currentTargetChannelIndex] = (float)(texelStart[currentChannelIndex]) / 255.0f;
-        }
-    }
-    else if (SFLOAT)
+    if (!rgba || !writableTexels || !getRowOffset(rowOffset, width, y, z, mipLevel, arrayLayer) || x > width || count > width - x)
     {
-        float texelStart[4];
-
-        buffer->read(texelStart, sizeof(float), numberChannels);
-
-        for (uint32_t currentChannelIndex = 0; currentChannelIndex < numberChannels; currentChannelIndex++)
-        {
-            result[currentChannelIndex] = texelStart[currentChannelIndex];
-        }
+        return VK_FALSE;
     }
 
-    return result;
+    writeTexels(&writableTexels[rowOffset + x * bytesPerTexel], rgba, count);
+
+    return VK_TRUE;
 }
 
 glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSamplerAddressMode addressModeX, const float y, const VkFilter filterY, const VkSamplerAddressMode addressModeY, const float z, const VkFilter filterZ, const VkSamplerAddressMode addressModeZ, const uint32_t mipLevel, const uint32_t arrayLayer) const
 {
-	if (BLOCK)
+	VkExtent3D currentExtent;
+	uint32_t offset;
+
+	if (BLOCK || !texels || !getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer))
 	{
 		return glm::vec4(NAN, NAN, NAN, NAN);
 	}
 
+	const uint8_t* levelTexels = &texels[offset];
+
 	glm::vec4 result(0.0f, 0.0f, 0.0f, 0.0f);
 
 	//
@@ -629,15 +635,15 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 	float fractionY;
 	float fractionZ;
 
-	int32_t texelX = getTexelLocation(fractionX, x, (int32_t)extent.width, addressModeX);
-	int32_t texelY = getTexelLocation(fractionY, y, (int32_t)extent.height, addressModeY);
-	int32_t texelZ = getTexelLocation(fractionZ, z, (int32_t)extent.depth, addressModeZ);
+	int32_t texelX = getTexelLocation(fractionX, x, (int32_t)currentExtent.width, addressModeX);
+	int32_t texelY = getTexelLocation(fractionY, y, (int32_t)currentExtent.height, addressModeY);
+	int32_t texelZ = getTexelLocation(fractionZ, z, (int32_t)currentExtent.depth, addressModeZ);
 
 	//
 
-	float stepX = 1.0f / (float)extent.width;
-	float stepY = 1.0f / (float)extent.height;
-	float stepZ = 1.0f / (float)extent.depth;
+	float stepX = 1.0f / (float)currentExtent.width;
+	float stepY = 1.0f / (float)currentExtent.height;
+	float stepZ = 1.0f / (float)currentExtent.depth;
 
 	//
 
@@ -659,7 +665,7 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 			{
 				currentWeightZ = weightZ;
 
-				texelZ = getTexelLocation(dummy, z, (int32_t)extent.depth, addressModeZ);
+				texelZ = getTexelLocation(dummy, z, (int32_t)currentExtent.depth, addressModeZ);
 			}
 			else
 			{
@@ -667,11 +673,11 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 
 				if (fractionZ >= 0.5f)
 				{
-					texelZ = getTexelLocation(dummy, z + stepZ, (int32_t)extent.depth, addressModeZ);
+					texelZ = getTexelLocation(dummy, z + stepZ, (int32_t)currentExtent.depth, addressModeZ);
 				}
 				else
 				{
-					texelZ = getTexelLocation(dummy, z - stepZ, (int32_t)extent.depth, addressModeZ);
+					texelZ = getTexelLocation(dummy, z - stepZ, (int32_t)currentExtent.depth, addressModeZ);
 				}
 			}
 		}
@@ -690,7 +696,7 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 				{
 					currentWeightY = weightY;
 
-					texelY = getTexelLocation(dummy, y, (int32_t)extent.height, addressModeY);
+					texelY = getTexelLocation(dummy, y, (int32_t)currentExtent.height, addressModeY);
 				}
 				else
 				{
@@ -698,11 +704,11 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 
 					if (fractionY >= 0.5f)
 					{
-						texelY = getTexelLocation(dummy, y + stepY, (int32_t)extent.height, addressModeY);
+						texelY = getTexelLocation(dummy, y + stepY, (int32_t)currentExtent.height, addressModeY);
 					}
 					else
 					{
-						texelY = getTexelLocation(dummy, y - stepY, (int32_t)extent.height, addressModeY);
+						texelY = getTexelLocation(dummy, y - stepY, (int32_t)currentExtent.height, addressModeY);
 					}
 				}
 			}
@@ -721,7 +727,7 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 					{
 						currentWeightX = weightX;
 
-						texelX = getTexelLocation(dummy, x, (int32_t)extent.width, addressModeX);
+						texelX = getTexelLocation(dummy, x, (int32_t)currentExtent.width, addressModeX);
 					}
 					else
 					{
@@ -729,18 +735,18 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 
 						if (fractionX >= 0.5f)
 						{
-							texelX = getTexelLocation(dummy, x + stepX, (int32_t)extent.width, addressModeX);
+							texelX = getTexelLocation(dummy, x + stepX, (int32_t)currentExtent.width, addressModeX);
 						}
 						else
 						{
-							texelX = getTexelLocation(dummy, x - stepX, (int32_t)extent.width, addressModeX);
+							texelX = getTexelLocation(dummy, x - stepX, (int32_t)currentExtent.width, addressModeX);
 						}
 					}
 				}
 
 				//
 
-				result += getTexel((uint32_t)texelX, (uint32_t)texelY, (uint32_t)texelZ, mipLevel, arrayLayer) * currentWeightX * currentWeightY * currentWeightZ;
+				result += fetchTexel(levelTexels, currentExtent, texelX, texelY, texelZ) * currentWeightX * currentWeightY * currentWeightZ;
 			}
 		}
 	}
@@ -750,7 +756,10 @@ glm::vec4 ImageData::getSample(const float x, const VkFilter filterX, const VkSa
 
 glm::vec4 ImageData::getSampleCubeMap(const float x, const float y, const float z, const VkFilter filter, const uint32_t mipLevel) const
 {
-	if (arrayLayers != 6 || extent.depth != 1 || std::isnan(x) || std::isnan(y) || std::isnan(z) || BLOCK)
+	VkExtent3D currentExtent;
+	uint32_t offset;
+
+	if (arrayLayers != 6 || extent.depth != 1 || std::isnan(x) || std::isnan(y) || std::isnan(z) || BLOCK || !getExtentAndOffset(currentExtent, offset, mipLevel, 0))
 	{
 		return glm::vec4(NAN, NAN, NAN, NAN);
 	}
@@ -782,14 +791,14 @@ glm::vec4 ImageData::getSampleCubeMap(const float x, const float y, const float
 
 	// Get three more samples. Not seamless.
 
-	float stepS = 1.0f / (float)extent.width;
-	float stepT = 1.0f / (float)extent.height;
+	float stepS = 1.0f / (float)currentExtent.width;
+	float stepT = 1.0f / (float)currentExtent.height;
 
 	float fractionS;
 	float fractionT;
 
-	getTexelLocation(fractionS, s, (int32_t)extent.width, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
-	getTexelLocation(fractionT, t, (int32_t)extent.height, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
+	getTexelLocation(fractionS, s, (int32_t)currentExtent.width, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
+	getTexelLocation(fractionT, t, (int32_t)currentExtent.height, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE);
 
 	if (fractionS < 0.5f)
 	{
@@ -851,6 +860,8 @@ void ImageData::freeHostMemory()
 	}
 
 	buffer = IBinaryBufferSP();
+
+	updateTexelAccess();
 }
 
 VkBool32 ImageData::updateMaxLuminance()
@@ -862,17 +873,34 @@ VkBool32 ImageData::updateMaxLuminance()
 
 	maxLuminance = 0.0;
 
+	std::vector<glm::vec4> row;
+
 	for (uint32_t arrayLayer = 0; arrayLayer < getArrayLayers(); arrayLayer++)
 	{
 		for (uint32_t mipLevel = 0; mipLevel < getMipLevels(); mipLevel++)
 		{
-			for (uint32_t z = 0; z < getDepth(); z++)
+			VkExtent3D currentExtent;
+			uint32_t offset;
+
+			if (!getExtentAndOffset(currentExtent, offset, mipLevel, arrayLayer))
 			{
-				for (uint32_t y = 0; y < getHeight(); y++)
+				continue;
+			}
+
+			row.resize(currentExtent.width);
+
+			for (uint32_t z = 0; z < currentExtent.depth; z++)
+			{
+				for (uint32_t y = 0; y < currentExtent.height; y++)
 				{
-					for (uint32_t x = 0; x < getWidth(); x++)
+					if (!readRow(&row[0], 0, y, z, currentExtent.width, mipLevel, arrayLayer))
+					{
+						continue;
+					}
+
+					for (uint32_t x = 0; x < currentExtent.width; x++)
 					{
-						maxLuminance = glm::max(maxLuminance, glm::dot(glm::vec3(getTexel(x, y, z, mipLevel, arrayLayer)), glm::vec3(0.2126f, 0.7152f, 0.0722f)));
+						maxLuminance = glm::max(maxLuminance, glm::dot(glm::vec3(row[x]), glm::vec3(0.2126f, 0.7152f, 0.0722f)));
 					}
 				}
 			}
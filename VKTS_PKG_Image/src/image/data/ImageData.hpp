@@ -29,6 +29,8 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+#include "fn_image_data_internal.hpp"
+
 namespace vkts
 {
 
@@ -58,8 +60,21 @@ private:
 
     float maxLuminance;
 
+    // Resolved once, so texel access does not need the buffer cursor.
+    const uint8_t* texels;
+    uint8_t* writableTexels;
+    uint32_t bytesPerTexel;
+    ImageDataReadTexelsFunction readTexels;
+    ImageDataWriteTexelsFunction writeTexels;
+
     void reset();
 
+    void updateTexelAccess();
+
+    VkBool32 getRowOffset(uint32_t& rowOffset, uint32_t& width, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const;
+
+    glm::vec4 fetchTexel(const uint8_t* levelTexels, const VkExtent3D& levelExtent, const int32_t x, const int32_t y, const int32_t z) const;
+
     int32_t getTexelLocation(float& fraction, const float a, const int32_t size, const VkSamplerAddressMode addressMode) const;
 
     int32_t getCubeMapFace(float& s, float& t, const float x, const float y, const float z) const;
@@ -129,6 +144,14 @@ public:
 
     virtual glm::vec4 getTexel(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const override;
 
+    virtual const void* getRowData(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) const override;
+
+    virtual void* getWritableRowData(const uint32_t y, const uint32_t z, const uint32_t mipLevel, const uint32_t arrayLayer) override;
+
+    virtual VkBool32 readRow(glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count, const uint32_t mipLevel, const uint32_t arrayLayer) const override;
+
+    virtual VkBool32 writeRow(const glm::vec4* rgba, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t count, const uint32_t mipLevel, const uint32_t arrayLayer) override;
+
     virtual glm::vec4 getSample(const float x, const VkFilter filterX, const VkSamplerAddressMode addressModeX, const float y, const VkFilter filterY, const VkSamplerAddressMode addressModeY, const float z, const VkFilter filterZ, const VkSamplerAddressMode addressModeZ, const uint32_t mipLevel, const uint32_t arrayLayer) const override;
 
     virtual glm::vec4 getSampleCubeMap(const float x, const float y, const float z, const VkFilter filter, const uint32_t mipLevel) const override;
@@ -595,6 +595,8 @@ void VKTS_APIENTRY imageDataSetSaveFunction(const PFN_imageDataSaveFunction save
 
 IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename)
 {
+	VKTS_PROFILE_ZONE("imageDataLoad");
+
 	if (g_loadFunction)
 	{
 		auto externalImageData = g_loadFunction(filename);
@@ -617,7 +619,7 @@ IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename)
         return IImageDataSP();
     }
 
-    auto buffer = fileLoadBinary(filename);
+    auto buffer = fileMapBinary(filename, VKTS_FILE_ACCESS_SEQUENTIAL);
 
     if (!buffer.get())
     {
@@ -657,6 +659,8 @@ IImageDataSP VKTS_APIENTRY imageDataLoad(const char* filename)
 
 IImageDataSP VKTS_APIENTRY imageDataLoadRaw(const char* filename, const uint32_t width, const uint32_t height, const VkFormat format)
 {
+    VKTS_PROFILE_ZONE("imageDataLoadRaw");
+
     if (!filename || width == 0 || height == 0)
     {
         return IImageDataSP();
@@ -667,7 +671,7 @@ IImageDataSP VKTS_APIENTRY imageDataLoadRaw(const char* filename, const uint32_t
     	return IImageDataSP();
     }
 
-    auto buffer = fileLoadBinary(filename);
+    auto buffer = fileMapBinary(filename, VKTS_FILE_ACCESS_SEQUENTIAL);
 
     if (!buffer.get())
     {
@@ -676,7 +680,7 @@ IImageDataSP VKTS_APIENTRY imageDataLoadRaw(const char* filename, const uint32_t
 
     uint32_t expectedSize = width * height * imageDataGetBytesPerChannel(format) * imageDataGetNumberChannels(format);
 
-    if (buffer->getSize() != expectedSize)
+    if (buffer->getSize() != (uint64_t)expectedSize)
     {
         return IImageDataSP();
     }
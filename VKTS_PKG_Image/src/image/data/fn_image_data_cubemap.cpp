@@ -28,12 +28,202 @@
 
 #include "fn_image_data_internal.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VKTS_IMAGE_DATA_SSE2
+#endif
+
 namespace vkts
 {
 
+/**
+ * Scan vector of the first texel of a cube map side and its change per texel, before normalization.
+ */
+typedef struct _CubemapSide {
+
+	glm::vec3 origin;
+
+	glm::vec3 stepX;
+
+	glm::vec3 stepY;
+
+} CubemapSide;
+
+/**
+ * Same orientation as imageDataGetScanVector: Side normal, direction of increasing x and direction of increasing y.
+ */
+static const float g_cubemapAxes[6][3][3] = {
+	{{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, -1.0f, 0.0f}},
+	{{-1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}},
+	{{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+	{{0.0f, -1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}},
+	{{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}},
+	{{0.0f, 0.0f, -1.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}}
+};
+
+static void imageDataCubemapGetSides(CubemapSide* allSides, const uint32_t length)
+{
+    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
+	float step = 2.0f / (float)length;
+	float offset = step * 0.5f;
+
+	for (uint32_t side = 0; side < 6; side++)
+	{
+		glm::vec3 normal = glm::vec3(g_cubemapAxes[side][0][0], g_cubemapAxes[side][0][1], g_cubemapAxes[side][0][2]);
+		glm::vec3 axisX = glm::vec3(g_cubemapAxes[side][1][0], g_cubemapAxes[side][1][1], g_cubemapAxes[side][1][2]);
+		glm::vec3 axisY = glm::vec3(g_cubemapAxes[side][2][0], g_cubemapAxes[side][2][1], g_cubemapAxes[side][2][2]);
+
+		allSides[side].origin = normal + (axisX + axisY) * (offset - 1.0f);
+		allSides[side].stepX = axisX * step;
+		allSides[side].stepY = axisY * step;
+	}
+}
+
+/**
+ * Reads the texel at x0 and its right neighbor x1 of one source row.
+ */
+static void imageDataCubemapReadPair(glm::vec4* rgba, const uint8_t* row, const uint32_t x0, const uint32_t x1, const uint32_t bytesPerTexel, const ImageDataReadTexelsFunction readTexels)
+{
+	if (x1 == x0 + 1)
+	{
+		readTexels(rgba, &row[x0 * bytesPerTexel], 2);
+	}
+	else
+	{
+		readTexels(&rgba[0], &row[x0 * bytesPerTexel], 1);
+		readTexels(&rgba[1], &row[x1 * bytesPerTexel], 1);
+	}
+}
+
+/**
+ * Samples one row of a cube map side from an equirectangular image. Filtering is bilinear, longitude repeats and latitude is clamped at the poles.
+ */
+static VkBool32 imageDataCubemapSampleRow(glm::vec4* rgba, const CubemapSide& side, const uint32_t y, const uint32_t length, const IImageDataSP& sourceImage, const ImageDataReadTexelsFunction readTexels)
+{
+	int32_t width = (int32_t)sourceImage->getWidth();
+	int32_t height = (int32_t)sourceImage->getHeight();
+
+	uint32_t bytesPerTexel = imageDataGetBytesPerTexel(sourceImage->getFormat());
+
+	glm::vec3 rowOrigin = side.origin + side.stepY * (float)y;
+
+	glm::vec4 quad[4];
+
+	for (uint32_t x = 0; x < length; x++)
+	{
+		glm::vec3 scanVector = glm::normalize(rowOrigin + side.stepX * (float)x);
+
+		//
+
+		float s = 0.5f + 0.5f * atan2f(scanVector.z, scanVector.x) / VKTS_MATH_PI;
+		float t = 1.0f - acosf(glm::clamp(scanVector.y, -1.0f, 1.0f)) / VKTS_MATH_PI;
+
+		// Texel centers are at half texels.
+
+		float u = s * (float)width - 0.5f;
+		float v = t * (float)height - 0.5f;
+
+		float floorU = floorf(u);
+		float floorV = floorf(v);
+
+		float fractionU = u - floorU;
+		float fractionV = v - floorV;
+
+		int32_t x0 = (int32_t)floorU % width;
+
+		if (x0 < 0)
+		{
+			x0 += width;
+		}
+
+		int32_t x1 = (x0 + 1) % width;
+
+		int32_t y0 = glm::clamp((int32_t)floorV, 0, height - 1);
+		int32_t y1 = glm::clamp((int32_t)floorV + 1, 0, height - 1);
+
+		const uint8_t* row0 = static_cast<const uint8_t*>(sourceImage->getRowData((uint32_t)y0, 0, 0, 0));
+		const uint8_t* row1 = static_cast<const uint8_t*>(sourceImage->getRowData((uint32_t)y1, 0, 0, 0));
+
+		if (!row0 || !row1)
+		{
+			return VK_FALSE;
+		}
+
+		imageDataCubemapReadPair(&quad[0], row0, (uint32_t)x0, (uint32_t)x1, bytesPerTexel, readTexels);
+		imageDataCubemapReadPair(&quad[2], row1, (uint32_t)x0, (uint32_t)x1, bytesPerTexel, readTexels);
+
+		//
+
+#ifdef VKTS_IMAGE_DATA_SSE2
+		__m128 texel00 = _mm_loadu_ps(&quad[0][0]);
+		__m128 texel10 = _mm_loadu_ps(&quad[1][0]);
+		__m128 texel01 = _mm_loadu_ps(&quad[2][0]);
+		__m128 texel11 = _mm_loadu_ps(&quad[3][0]);
+
+		__m128 weightU = _mm_set1_ps(fractionU);
+
+		__m128 top = _mm_add_ps(texel00, _mm_mul_ps(_mm_sub_ps(texel10, texel00), weightU));
+		__m128 bottom = _mm_add_ps(texel01, _mm_mul_ps(_mm_sub_ps(texel11, texel01), weightU));
+
+		_mm_storeu_ps(&rgba[x][0], _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_set1_ps(fractionV))));
+#else
+		rgba[x] = glm::mix(glm::mix(quad[0], quad[1], fractionU), glm::mix(quad[2], quad[3], fractionU), fractionV);
+#endif
+	}
+
+	return VK_TRUE;
+}
+
+/**
+ * Samples the first mip level of all six sides. Sides and rows are independent, so all rows are built in parallel.
+ */
+static VkBool32 imageDataCubemapSides(const SmartPointerVector<IImageDataSP>& allTargetImages, const uint32_t length, const IImageDataSP& sourceImage)
+{
+	VKTS_PROFILE_ZONE("imageDataCubemapSides");
+
+	CubemapSide allSides[6];
+
+	imageDataCubemapGetSides(allSides, length);
+
+	ImageDataReadTexelsFunction readTexels = imageDataGetReadTexelsFunction(sourceImage->getFormat());
+
+	std::atomic<VkBool32> result(VK_TRUE);
+
+	parallelFor(0, 6 * length, 0, [&](const uint32_t begin, const uint32_t end)
+	{
+		std::vector<glm::vec4> rgba(length);
+
+		for (uint32_t sideRow = begin; sideRow < end; sideRow++)
+		{
+			uint32_t side = sideRow / length;
+			uint32_t y = sideRow % length;
+
+			// One image data for each side or one image data with six layers.
+
+			const IImageDataSP& targetImage = allTargetImages.size() == 6 ? allTargetImages[side] : allTargetImages[0];
+
+			uint32_t arrayLayer = allTargetImages.size() == 6 ? 0 : side;
+
+			if (!imageDataCubemapSampleRow(&rgba[0], allSides[side], y, length, sourceImage, readTexels) || !targetImage->writeRow(&rgba[0], 0, y, 0, length, 0, arrayLayer))
+			{
+				result = VK_FALSE;
+
+				return;
+			}
+		}
+	});
+
+	return result;
+}
+
+static VkBool32 imageDataCubemapIsSupported(const IImageDataSP& sourceImage)
+{
+	return (sourceImage->isUNORM() || sourceImage->isSFLOAT() || sourceImage->isSRGB()) && sourceImage->getWidth() > 0 && sourceImage->getHeight() > 0;
+}
+
 SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataCubemap(const IImageDataSP& sourceImage, const uint32_t length, const std::string& name)
 {
-    if (name.size() == 0 || !sourceImage.get() || length == 0)
+    if (name.size() == 0 || !sourceImage.get() || length == 0 || !imageDataCubemapIsSupported(sourceImage))
     {
         return SmartPointerVector<IImageDataSP>();
     }
@@ -66,41 +256,56 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataCubemap(const IImageData
 
 	//
 
-    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-	float step = 2.0f / (float)length;
-	float offset = step * 0.5f;
+    if (!imageDataCubemapSides(result, length, sourceImage))
+    {
+    	return SmartPointerVector<IImageDataSP>();
+    }
 
-	//
+    return result;
+}
 
-	glm::vec3 scanVector;
+IImageDataSP VKTS_APIENTRY imageDataCubemapChain(const IImageDataSP& sourceImage, const uint32_t length, const std::string& name, const VkFormat targetFormat, const enum VkTsMipmapFilter filter, const enum VkTsImageDataType imageDataType)
+{
+    if (name.size() == 0 || !sourceImage.get() || length == 0 || !imageDataCubemapIsSupported(sourceImage))
+    {
+        return IImageDataSP();
+    }
 
-	glm::vec2 sampleLocation;
+    VkFormat format = targetFormat == VK_FORMAT_UNDEFINED ? sourceImage->getFormat() : targetFormat;
 
-	glm::vec4 texel;
+    if (!(imageDataIsUNORM(format) || imageDataIsSFLOAT(format) || imageDataIsSRGB(format)))
+    {
+        return IImageDataSP();
+    }
 
-	for (uint32_t y = 0; y < length; y++)
-	{
-		for (uint32_t x = 0; x < length; x++)
-		{
-			for (uint32_t side = 0; side < 6; side++)
-			{
-				scanVector = imageDataGetScanVector(x, y, side, step, offset);
+    VkExtent3D extent = {length, length, 1};
 
-				//
+    auto targetImage = imageDataCreateChain(name, sourceImage->getImageType(), format, extent, 6, sourceImage->getMaxLuminance());
 
-				sampleLocation.s = 0.5f + 0.5f * atan2f(scanVector.z, scanVector.x) / VKTS_MATH_PI;
-				sampleLocation.t = 1.0f - acosf(scanVector.y) / VKTS_MATH_PI;
+    if (!targetImage.get())
+    {
+    	return IImageDataSP();
+    }
 
-				//
+    //
 
-				texel = sourceImage->getSample(sampleLocation.s, VK_FILTER_LINEAR, VK_SAMPLER_ADDRESS_MODE_REPEAT, sampleLocation.t, VK_FILTER_LINEAR, VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT, 0.5f, VK_FILTER_LINEAR, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE, 0, 0);
+    SmartPointerVector<IImageDataSP> allTargetImages;
 
-				result[side]->setTexel(texel, x, y, 0, 0, 0);
-			}
-		}
-	}
+    allTargetImages.append(targetImage);
 
-    return result;
+    if (!imageDataCubemapSides(allTargetImages, length, sourceImage))
+    {
+    	return IImageDataSP();
+    }
+
+    // Smaller levels are filtered from the sides in memory, so the source is read only once.
+
+    if (!imageDataMipmapChainLevels(targetImage, filter, targetImage->isSRGB() || imageDataType == VKTS_LDR_COLOR_DATA))
+    {
+    	return IImageDataSP();
+    }
+
+    return targetImage;
 }
 
 }
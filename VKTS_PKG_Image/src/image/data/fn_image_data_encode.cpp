@@ -0,0 +1,1067 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/image/vkts_image.hpp>
+
+#include "ImageData.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VKTS_IMAGE_DATA_SSE2
+#endif
+
+#define VKTS_ENCODE_BLOCK_LENGTH 4
+#define VKTS_ENCODE_BLOCK_TEXELS 16
+
+// Largest finite half float as integer.
+#define VKTS_ENCODE_HALF_MAX 0x7BFF
+
+namespace vkts
+{
+
+// Interpolation weights of BC6H and BC7 with four bit indices.
+static const uint32_t g_encodeWeights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Palette entry, which must never be selected.
+static const glm::vec4 g_encodeUnreachable = glm::vec4(1.0e6f, 1.0e6f, 1.0e6f, 1.0e6f);
+
+/**
+ * Selects the nearest palette entry for every texel and returns the summed squared error.
+ */
+static float imageDataEncodeSelect(uint8_t* indices, const glm::vec4* texels, const uint32_t count, const glm::vec4* palette, const uint32_t paletteSize)
+{
+	float error = 0.0f;
+
+#ifdef VKTS_IMAGE_DATA_SSE2
+	// Palette in structure of arrays layout, so four distances are calculated at once.
+
+	__m128 allChannels[4][4];
+
+	for (uint32_t group = 0; group < paletteSize / 4; group++)
+	{
+		for (uint32_t channel = 0; channel < 4; channel++)
+		{
+			allChannels[group][channel] = _mm_setr_ps(palette[group * 4 + 0][channel], palette[group * 4 + 1][channel], palette[group * 4 + 2][channel], palette[group * 4 + 3][channel]);
+		}
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		float distances[VKTS_ENCODE_BLOCK_TEXELS];
+
+		for (uint32_t group = 0; group < paletteSize / 4; group++)
+		{
+			__m128 distance = _mm_setzero_ps();
+
+			for (uint32_t channel = 0; channel < 4; channel++)
+			{
+				__m128 difference = _mm_sub_ps(_mm_set1_ps(texels[i][channel]), allChannels[group][channel]);
+
+				distance = _mm_add_ps(distance, _mm_mul_ps(difference, difference));
+			}
+
+			_mm_storeu_ps(&distances[group * 4], distance);
+		}
+
+		uint32_t bestIndex = 0;
+
+		for (uint32_t k = 1; k < paletteSize; k++)
+		{
+			if (distances[k] < distances[bestIndex])
+			{
+				bestIndex = k;
+			}
+		}
+
+		indices[i] = (uint8_t)bestIndex;
+
+		error += distances[bestIndex];
+	}
+#else
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint32_t bestIndex = 0;
+		float bestDistance = 0.0f;
+
+		for (uint32_t k = 0; k < paletteSize; k++)
+		{
+			glm::vec4 difference = texels[i] - palette[k];
+
+			float distance = glm::dot(difference, difference);
+
+			if (k == 0 || distance < bestDistance)
+			{
+				bestIndex = k;
+				bestDistance = distance;
+			}
+		}
+
+		indices[i] = (uint8_t)bestIndex;
+
+		error += bestDistance;
+	}
+#endif
+
+	return error;
+}
+
+/**
+ * Initial endpoints, either from the bounding box or from the principal axis of the texels.
+ */
+static void imageDataEncodeGetEndpoints(glm::vec4& low, glm::vec4& high, const glm::vec4* texels, const uint32_t count, const VkBool32 principalAxis)
+{
+	glm::vec4 minimum = texels[0];
+	glm::vec4 maximum = texels[0];
+	glm::vec4 mean = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		minimum = glm::min(minimum, texels[i]);
+		maximum = glm::max(maximum, texels[i]);
+
+		mean += texels[i];
+	}
+
+	mean /= (float)count;
+
+	if (!principalAxis)
+	{
+		low = minimum;
+		high = maximum;
+
+		return;
+	}
+
+	glm::mat4 covariance = glm::mat4(0.0f);
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		glm::vec4 difference = texels[i] - mean;
+
+		covariance += glm::outerProduct(difference, difference);
+	}
+
+	// Power iteration, starting with the diagonal of the bounding box.
+
+	glm::vec4 axis = maximum - minimum;
+
+	for (uint32_t iteration = 0; iteration < 8; iteration++)
+	{
+		axis = covariance * axis;
+
+		float length = glm::length(axis);
+
+		if (length < 1.0e-12f)
+		{
+			break;
+		}
+
+		axis /= length;
+	}
+
+	if (glm::length(axis) < 1.0e-6f)
+	{
+		low = mean;
+		high = mean;
+
+		return;
+	}
+
+	axis = glm::normalize(axis);
+
+	float minimumT = 0.0f;
+	float maximumT = 0.0f;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		float t = glm::dot(texels[i] - mean, axis);
+
+		minimumT = glm::min(minimumT, t);
+		maximumT = glm::max(maximumT, t);
+	}
+
+	low = mean + axis * minimumT;
+	high = mean + axis * maximumT;
+}
+
+/**
+ * Least squares endpoints for the given indices. A negative fraction marks an entry, which is not on the line.
+ */
+static VkBool32 imageDataEncodeRefine(glm::vec4& low, glm::vec4& high, const glm::vec4* texels, const uint32_t count, const uint8_t* indices, const float* fractions)
+{
+	float a = 0.0f;
+	float b = 0.0f;
+	float c = 0.0f;
+
+	glm::vec4 lowSum = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+	glm::vec4 highSum = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		float t = fractions[indices[i]];
+
+		if (t < 0.0f)
+		{
+			continue;
+		}
+
+		a += (1.0f - t) * (1.0f - t);
+		b += t * (1.0f - t);
+		c += t * t;
+
+		lowSum += texels[i] * (1.0f - t);
+		highSum += texels[i] * t;
+	}
+
+	float determinant = a * c - b * b;
+
+	if (fabsf(determinant) < 1.0e-8f)
+	{
+		return VK_FALSE;
+	}
+
+	low = (lowSum * c - highSum * b) / determinant;
+	high = (highSum * a - lowSum * b) / determinant;
+
+	return VK_TRUE;
+}
+
+/**
+ * Searches endpoints and indices. The quality selects the start endpoints and the number of refinements.
+ * ENDPOINTS quantizes the endpoints to the block format and returns the palette, the decoder would create.
+ */
+template<class ENDPOINTS>
+static void imageDataEncodeFit(ENDPOINTS& endpoints, uint8_t* indices, const glm::vec4* texels, const uint32_t count, const enum VkTsEncodeQuality quality)
+{
+	glm::vec4 palette[VKTS_ENCODE_BLOCK_TEXELS];
+	float fractions[VKTS_ENCODE_BLOCK_TEXELS];
+
+	uint8_t currentIndices[VKTS_ENCODE_BLOCK_TEXELS];
+
+	float bestError = FLT_MAX;
+
+	uint32_t iterations = (quality == VKTS_ENCODE_QUALITY_FAST) ? 0 : ((quality == VKTS_ENCODE_QUALITY_NORMAL) ? 2 : 4);
+
+	uint32_t starts = (quality == VKTS_ENCODE_QUALITY_BEST) ? 2 : 1;
+
+	for (uint32_t start = 0; start < starts; start++)
+	{
+		glm::vec4 low;
+		glm::vec4 high;
+
+		imageDataEncodeGetEndpoints(low, high, texels, count, start == 0);
+
+		for (uint32_t iteration = 0; iteration <= iterations; iteration++)
+		{
+			endpoints.quantize(palette, fractions, low, high);
+
+			float error = imageDataEncodeSelect(currentIndices, texels, count, palette, ENDPOINTS::PALETTE_SIZE);
+
+			if (error < bestError || (start == 0 && iteration == 0))
+			{
+				bestError = error;
+
+				endpoints.keep();
+
+				memcpy(indices, currentIndices, count);
+			}
+
+			if (error == 0.0f || iteration == iterations || !imageDataEncodeRefine(low, high, texels, count, currentIndices, fractions))
+			{
+				break;
+			}
+		}
+	}
+}
+
+//
+// Endpoint quantization.
+//
+
+static uint16_t imageDataEncodePack565(const glm::vec4& color)
+{
+	glm::vec4 saturated = glm::clamp(color, 0.0f, 1.0f);
+
+	return (uint16_t)(((uint32_t)roundf(saturated.r * 31.0f) << 11) | ((uint32_t)roundf(saturated.g * 63.0f) << 5) | (uint32_t)roundf(saturated.b * 31.0f));
+}
+
+static glm::vec4 imageDataEncodeUnpack565(const uint16_t color)
+{
+	uint32_t r = (color >> 11) & 0x1F;
+	uint32_t g = (color >> 5) & 0x3F;
+	uint32_t b = color & 0x1F;
+
+	return glm::vec4((float)((r << 3) | (r >> 2)), (float)((g << 2) | (g >> 4)), (float)((b << 3) | (b >> 2)), 0.0f) / 255.0f;
+}
+
+class EncodeEndpointsBC1
+{
+
+public:
+
+	static const uint32_t PALETTE_SIZE = 4;
+
+	// BC2 and BC3 always use four colors.
+	VkBool32 fourColors;
+
+	// Three colors and transparent black.
+	VkBool32 threeColors;
+
+	uint16_t color[2];
+	uint16_t bestColor[2];
+
+	void quantize(glm::vec4* palette, float* fractions, const glm::vec4& low, const glm::vec4& high)
+	{
+		color[0] = imageDataEncodePack565(high);
+		color[1] = imageDataEncodePack565(low);
+
+		float t[2] = {1.0f, 0.0f};
+
+		// The order of the colors selects the mode.
+
+		if ((threeColors && color[0] > color[1]) || (!threeColors && color[0] < color[1]))
+		{
+			std::swap(color[0], color[1]);
+			std::swap(t[0], t[1]);
+		}
+
+		glm::vec4 c0 = imageDataEncodeUnpack565(color[0]);
+		glm::vec4 c1 = imageDataEncodeUnpack565(color[1]);
+
+		palette[0] = c0;
+		palette[1] = c1;
+
+		fractions[0] = t[0];
+		fractions[1] = t[1];
+
+		if (fourColors || color[0] > color[1])
+		{
+			palette[2] = (c0 * 2.0f + c1) / 3.0f;
+			palette[3] = (c0 + c1 * 2.0f) / 3.0f;
+
+			fractions[2] = (t[0] * 2.0f + t[1]) / 3.0f;
+			fractions[3] = (t[0] + t[1] * 2.0f) / 3.0f;
+		}
+		else
+		{
+			palette[2] = (c0 + c1) * 0.5f;
+
+			fractions[2] = 0.5f;
+
+			// Black, or transparent black, which is only used for transparent texels.
+
+			palette[3] = threeColors ? g_encodeUnreachable : glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+			fractions[3] = -1.0f;
+		}
+	}
+
+	void keep()
+	{
+		bestColor[0] = color[0];
+		bestColor[1] = color[1];
+	}
+
+};
+
+class EncodeEndpointsBC4
+{
+
+public:
+
+	static const uint32_t PALETTE_SIZE = 8;
+
+	uint8_t value[2];
+	uint8_t bestValue[2];
+
+	void quantize(glm::vec4* palette, float* fractions, const glm::vec4& low, const glm::vec4& high)
+	{
+		int32_t e0 = (int32_t)roundf(glm::clamp(high.x, 0.0f, 1.0f) * 255.0f);
+		int32_t e1 = (int32_t)roundf(glm::clamp(low.x, 0.0f, 1.0f) * 255.0f);
+
+		float t[2] = {1.0f, 0.0f};
+
+		if (e0 < e1)
+		{
+			std::swap(e0, e1);
+			std::swap(t[0], t[1]);
+		}
+
+		// Only the first value being larger selects eight interpolated values.
+
+		if (e0 == e1)
+		{
+			if (e0 < 255)
+			{
+				e0++;
+			}
+			else
+			{
+				e1--;
+			}
+		}
+
+		value[0] = (uint8_t)e0;
+		value[1] = (uint8_t)e1;
+
+		palette[0] = glm::vec4((float)e0 / 255.0f, 0.0f, 0.0f, 0.0f);
+		palette[1] = glm::vec4((float)e1 / 255.0f, 0.0f, 0.0f, 0.0f);
+
+		fractions[0] = t[0];
+		fractions[1] = t[1];
+
+		for (uint32_t k = 2; k < 8; k++)
+		{
+			palette[k] = glm::vec4((float)((8 - k) * e0 + (k - 1) * e1) / (7.0f * 255.0f), 0.0f, 0.0f, 0.0f);
+
+			fractions[k] = ((float)(8 - k) * t[0] + (float)(k - 1) * t[1]) / 7.0f;
+		}
+	}
+
+	void keep()
+	{
+		bestValue[0] = value[0];
+		bestValue[1] = value[1];
+	}
+
+};
+
+/**
+ * BC6H mode 11: One region, ten bit unsigned endpoints without deltas. Values are half floats as integers.
+ */
+class EncodeEndpointsBC6H
+{
+
+public:
+
+	static const uint32_t PALETTE_SIZE = 16;
+
+	uint32_t endpoint[2][3];
+	uint32_t bestEndpoint[2][3];
+
+	static uint32_t quantizeChannel(const float half)
+	{
+		float unquantized = glm::clamp(half, 0.0f, (float)VKTS_ENCODE_HALF_MAX) * 64.0f / 31.0f;
+
+		return (uint32_t)glm::clamp(roundf((unquantized - 32.0f) / 64.0f), 0.0f, 1023.0f);
+	}
+
+	static uint32_t unquantizeChannel(const uint32_t quantized)
+	{
+		if (quantized == 0)
+		{
+			return 0;
+		}
+		else if (quantized == 1023)
+		{
+			return 0xFFFF;
+		}
+
+		return ((quantized << 16) + 0x8000) >> 10;
+	}
+
+	void quantize(glm::vec4* palette, float* fractions, const glm::vec4& low, const glm::vec4& high)
+	{
+		uint32_t unquantized[2][3];
+
+		for (uint32_t channel = 0; channel < 3; channel++)
+		{
+			endpoint[0][channel] = quantizeChannel(high[channel]);
+			endpoint[1][channel] = quantizeChannel(low[channel]);
+
+			unquantized[0][channel] = unquantizeChannel(endpoint[0][channel]);
+			unquantized[1][channel] = unquantizeChannel(endpoint[1][channel]);
+		}
+
+		for (uint32_t k = 0; k < 16; k++)
+		{
+			uint32_t weight = g_encodeWeights4[k];
+
+			palette[k] = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+			for (uint32_t channel = 0; channel < 3; channel++)
+			{
+				uint32_t interpolated = ((64 - weight) * unquantized[0][channel] + weight * unquantized[1][channel] + 32) >> 6;
+
+				palette[k][channel] = (float)((interpolated * 31) >> 6);
+			}
+
+			fractions[k] = 1.0f - (float)weight / 64.0f;
+		}
+	}
+
+	void keep()
+	{
+		memcpy(bestEndpoint, endpoint, sizeof(endpoint));
+	}
+
+};
+
+/**
+ * BC7 mode 6: One subset, seven bit RGBA endpoints with one parity bit each.
+ */
+class EncodeEndpointsBC7
+{
+
+public:
+
+	static const uint32_t PALETTE_SIZE = 16;
+
+	uint32_t endpoint[2][4];
+	uint32_t parity[2];
+
+	uint32_t bestEndpoint[2][4];
+	uint32_t bestParity[2];
+
+	static void quantizeEndpoint(uint32_t* quantized, uint32_t& p, const glm::vec4& color)
+	{
+		float bestError = FLT_MAX;
+
+		for (uint32_t currentP = 0; currentP < 2; currentP++)
+		{
+			uint32_t currentQuantized[4];
+
+			float error = 0.0f;
+
+			for (uint32_t channel = 0; channel < 4; channel++)
+			{
+				float value = glm::clamp(color[channel], 0.0f, 1.0f) * 255.0f;
+
+				currentQuantized[channel] = (uint32_t)glm::clamp(roundf((value - (float)currentP) * 0.5f), 0.0f, 127.0f);
+
+				float difference = (float)((currentQuantized[channel] << 1) | currentP) - value;
+
+				error += difference * difference;
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+
+				memcpy(quantized, currentQuantized, sizeof(currentQuantized));
+
+				p = currentP;
+			}
+		}
+	}
+
+	void quantize(glm::vec4* palette, float* fractions, const glm::vec4& low, const glm::vec4& high)
+	{
+		quantizeEndpoint(endpoint[0], parity[0], high);
+		quantizeEndpoint(endpoint[1], parity[1], low);
+
+		for (uint32_t k = 0; k < 16; k++)
+		{
+			uint32_t weight = g_encodeWeights4[k];
+
+			for (uint32_t channel = 0; channel < 4; channel++)
+			{
+				uint32_t e0 = (endpoint[0][channel] << 1) | parity[0];
+				uint32_t e1 = (endpoint[1][channel] << 1) | parity[1];
+
+				palette[k][channel] = (float)(((64 - weight) * e0 + weight * e1 + 32) >> 6) / 255.0f;
+			}
+
+			fractions[k] = 1.0f - (float)weight / 64.0f;
+		}
+	}
+
+	void keep()
+	{
+		memcpy(bestEndpoint, endpoint, sizeof(endpoint));
+		memcpy(bestParity, parity, sizeof(parity));
+	}
+
+};
+
+//
+// Block encoding.
+//
+
+static void imageDataEncodeWriteBits(uint8_t* block, uint32_t& position, const uint32_t value, const uint32_t bits)
+{
+	for (uint32_t i = 0; i < bits; i++)
+	{
+		if ((value >> i) & 1)
+		{
+			block[position >> 3] |= (uint8_t)(1 << (position & 7));
+		}
+
+		position++;
+	}
+}
+
+static void imageDataEncodeBlockBC1(uint8_t* block, const glm::vec4* rgba, const VkBool32 fourColors, const VkBool32 alpha, const enum VkTsEncodeQuality quality)
+{
+	// Transparent texels are not fitted and get the transparent index.
+
+	glm::vec4 texels[VKTS_ENCODE_BLOCK_TEXELS];
+	uint32_t texelIndices[VKTS_ENCODE_BLOCK_TEXELS];
+
+	uint32_t count = 0;
+
+	for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+	{
+		if (alpha && rgba[i].a < 0.5f)
+		{
+			continue;
+		}
+
+		texels[count] = glm::vec4(rgba[i].r, rgba[i].g, rgba[i].b, 0.0f);
+		texelIndices[count] = i;
+
+		count++;
+	}
+
+	EncodeEndpointsBC1 endpoints{};
+
+	endpoints.fourColors = fourColors;
+	endpoints.threeColors = (count < VKTS_ENCODE_BLOCK_TEXELS);
+
+	uint8_t fittedIndices[VKTS_ENCODE_BLOCK_TEXELS];
+
+	uint8_t indices[VKTS_ENCODE_BLOCK_TEXELS];
+
+	if (count > 0)
+	{
+		imageDataEncodeFit(endpoints, fittedIndices, texels, count, quality);
+	}
+	else
+	{
+		endpoints.bestColor[0] = 0;
+		endpoints.bestColor[1] = 0;
+	}
+
+	memset(indices, 3, sizeof(indices));
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		indices[texelIndices[i]] = fittedIndices[i];
+	}
+
+	//
+
+	memset(block, 0, 8);
+
+	uint32_t position = 0;
+
+	imageDataEncodeWriteBits(block, position, endpoints.bestColor[0], 16);
+	imageDataEncodeWriteBits(block, position, endpoints.bestColor[1], 16);
+
+	for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+	{
+		imageDataEncodeWriteBits(block, position, indices[i], 2);
+	}
+}
+
+static void imageDataEncodeBlockBC4(uint8_t* block, const glm::vec4* rgba, const uint32_t channel, const enum VkTsEncodeQuality quality)
+{
+	glm::vec4 texels[VKTS_ENCODE_BLOCK_TEXELS];
+
+	for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+	{
+		texels[i] = glm::vec4(rgba[i][channel], 0.0f, 0.0f, 0.0f);
+	}
+
+	EncodeEndpointsBC4 endpoints{};
+
+	uint8_t indices[VKTS_ENCODE_BLOCK_TEXELS];
+
+	imageDataEncodeFit(endpoints, indices, texels, VKTS_ENCODE_BLOCK_TEXELS, quality);
+
+	//
+
+	memset(block, 0, 8);
+
+	uint32_t position = 0;
+
+	imageDataEncodeWriteBits(block, position, endpoints.bestValue[0], 8);
+	imageDataEncodeWriteBits(block, position, endpoints.bestValue[1], 8);
+
+	for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+	{
+		imageDataEncodeWriteBits(block, position, indices[i], 3);
+	}
+}
+
+static void imageDataEncodeBlockBC6H(uint8_t* block, const glm::vec4* rgba, const enum VkTsEncodeQuality quality)
+{
+	// Interpolation happens on the half float bits, so the fit is done there as well.
+
+	glm::vec4 texels[VKTS_ENCODE_BLOCK_TEXELS];
+
+	for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+	{
+		texels[i] = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+		for (uint32_t channel = 0; channel < 3; channel++)
+		{
+			// Also maps NaN and negative values to zero.
+			float value = rgba[i][channel] > 0.0f ? glm::min(rgba[i][channel], 65504.0f) : 0.0f;
+
+			texels[i][channel] = (float)(glm::packHalf2x16(glm::vec2(value, 0.0f)) & 0xFFFF);
+		}
+	}
+
+	EncodeEndpointsBC6H endpoints{};
+
+	uint8_t indices[VKTS_ENCODE_BLOCK_TEXELS];
+
+	imageDataEncodeFit(endpoints, indices, texels, VKTS_ENCODE_BLOCK_TEXELS, quality);
+
+	// The most significant bit of the first index is implicitly zero.
+
+	if (indices[0] >= 8)
+	{
+		for (uint32_t channel = 0; channel < 3; channel++)
+		{
+			std::swap(endpoints.bestEndpoint[0][channel], endpoints.bestEndpoint[1][channel]);
+		}
+
+		for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+		{
+			indices[i] = 15 - indices[i];
+		}
+	}
+
+	//
+
+	memset(block, 0, 16);
+
+	uint32_t position = 0;
+
+	imageDataEncodeWriteBits(block, position, 0x03, 5);
+
+	for (uint32_t e = 0; e < 2; e++)
+	{
+		for (uint32_t channel = 0; channel < 3; channel++)
+		{
+			imageDataEncodeWriteBits(block, position, endpoints.bestEndpoint[e][channel], 10);
+		}
+	}
+
+	for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+	{
+		imageDataEncodeWriteBits(block, position, indices[i], i == 0 ? 3 : 4);
+	}
+}
+
+static void imageDataEncodeBlockBC7(uint8_t* block, const glm::vec4* rgba, const enum VkTsEncodeQuality quality)
+{
+	EncodeEndpointsBC7 endpoints{};
+
+	uint8_t indices[VKTS_ENCODE_BLOCK_TEXELS];
+
+	imageDataEncodeFit(endpoints, indices, rgba, VKTS_ENCODE_BLOCK_TEXELS, quality);
+
+	// The most significant bit of the first index is implicitly zero.
+
+	if (indices[0] >= 8)
+	{
+		for (uint32_t channel = 0; channel < 4; channel++)
+		{
+			std::swap(endpoints.bestEndpoint[0][channel], endpoints.bestEndpoint[1][channel]);
+		}
+
+		std::swap(endpoints.bestParity[0], endpoints.bestParity[1]);
+
+		for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+		{
+			indices[i] = 15 - indices[i];
+		}
+	}
+
+	//
+
+	memset(block, 0, 16);
+
+	uint32_t position = 0;
+
+	imageDataEncodeWriteBits(block, position, 1 << 6, 7);
+
+	for (uint32_t channel = 0; channel < 4; channel++)
+	{
+		imageDataEncodeWriteBits(block, position, endpoints.bestEndpoint[0][channel], 7);
+		imageDataEncodeWriteBits(block, position, endpoints.bestEndpoint[1][channel], 7);
+	}
+
+	imageDataEncodeWriteBits(block, position, endpoints.bestParity[0], 1);
+	imageDataEncodeWriteBits(block, position, endpoints.bestParity[1], 1);
+
+	for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+	{
+		imageDataEncodeWriteBits(block, position, indices[i], i == 0 ? 3 : 4);
+	}
+}
+
+static void imageDataEncodeBlock(uint8_t* block, const glm::vec4* rgba, const VkFormat format, const enum VkTsEncodeQuality quality)
+{
+	switch (format)
+	{
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+
+			imageDataEncodeBlockBC1(block, rgba, VK_FALSE, VK_FALSE, quality);
+
+			break;
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+
+			imageDataEncodeBlockBC1(block, rgba, VK_FALSE, VK_TRUE, quality);
+
+			break;
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+
+			imageDataEncodeBlockBC4(block, rgba, 3, quality);
+			imageDataEncodeBlockBC1(block + 8, rgba, VK_TRUE, VK_FALSE, quality);
+
+			break;
+		case VK_FORMAT_BC4_UNORM_BLOCK:
+
+			imageDataEncodeBlockBC4(block, rgba, 0, quality);
+
+			break;
+		case VK_FORMAT_BC5_UNORM_BLOCK:
+
+			imageDataEncodeBlockBC4(block, rgba, 0, quality);
+			imageDataEncodeBlockBC4(block + 8, rgba, 1, quality);
+
+			break;
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+
+			imageDataEncodeBlockBC6H(block, rgba, quality);
+
+			break;
+		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+
+			imageDataEncodeBlockBC7(block, rgba, quality);
+
+			break;
+		default:
+			break;
+	}
+}
+
+VkBool32 VKTS_APIENTRY imageDataIsEncodable(const VkFormat format)
+{
+	switch (format)
+	{
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+		case VK_FORMAT_BC4_UNORM_BLOCK:
+		case VK_FORMAT_BC5_UNORM_BLOCK:
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+			return VK_TRUE;
+		default:
+			return VK_FALSE;
+	}
+
+	return VK_FALSE;
+}
+
+VkFormat VKTS_APIENTRY imageDataGetEncodeFormat(const VkFormat sourceFormat, const VkFormat targetFormat)
+{
+	if (!imageDataIsEncodable(targetFormat))
+	{
+		return VK_FORMAT_UNDEFINED;
+	}
+
+	VkBool32 sourceSRGB = imageDataIsSRGB(sourceFormat);
+
+	switch (targetFormat)
+	{
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+			return sourceSRGB ? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+			return sourceSRGB ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+			return sourceSRGB ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+			return sourceSRGB ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+		default:
+			// BC4, BC5 and BC6H have no SRGB variant.
+			return sourceSRGB ? VK_FORMAT_UNDEFINED : targetFormat;
+	}
+
+	return VK_FORMAT_UNDEFINED;
+}
+
+IImageDataSP VKTS_APIENTRY imageDataEncode(const IImageDataSP& sourceImage, const VkFormat requestedFormat, const std::string& name, const enum VkTsEncodeQuality quality)
+{
+	if (name.size() == 0 || !sourceImage.get() || !(sourceImage->isUNORM() || sourceImage->isSFLOAT() || sourceImage->isSRGB()))
+	{
+		return IImageDataSP();
+	}
+
+	VkFormat targetFormat = imageDataGetEncodeFormat(sourceImage->getFormat(), requestedFormat);
+
+	if (targetFormat == VK_FORMAT_UNDEFINED)
+	{
+		return IImageDataSP();
+	}
+
+	// Encoding is slow, so the result is only created once.
+
+	uint64_t key = 0;
+
+	if (cacheGetEnabled())
+	{
+		key = cacheCreateKey(sourceImage, "ENCODE_" + std::to_string((uint32_t)targetFormat) + "_" + std::to_string((uint32_t)quality));
+
+		auto allImageData = cacheLoadImageDatas(key);
+
+		if (allImageData.size() == 1 && allImageData[0]->getFormat() == targetFormat)
+		{
+			return allImageData[0];
+		}
+	}
+
+	//
+
+	VkExtent3D extent = sourceImage->getExtent3D();
+
+	uint32_t mipLevels = sourceImage->getMipLevels();
+	uint32_t arrayLayers = sourceImage->getArrayLayers();
+
+	uint32_t bytesPerBlock = imageDataGetBytesPerTexel(targetFormat);
+
+	std::vector<uint32_t> allOffsets;
+
+	uint32_t totalSize = 0;
+
+	for (uint32_t arrayLayer = 0; arrayLayer < arrayLayers; arrayLayer++)
+	{
+		for (uint32_t mipLevel = 0; mipLevel < mipLevels; mipLevel++)
+		{
+			allOffsets.push_back(totalSize);
+
+			uint32_t blocksX = (glm::max(extent.width >> mipLevel, 1u) + VKTS_ENCODE_BLOCK_LENGTH - 1) / VKTS_ENCODE_BLOCK_LENGTH;
+			uint32_t blocksY = (glm::max(extent.height >> mipLevel, 1u) + VKTS_ENCODE_BLOCK_LENGTH - 1) / VKTS_ENCODE_BLOCK_LENGTH;
+
+			totalSize += blocksX * blocksY * glm::max(extent.depth >> mipLevel, 1u) * bytesPerBlock;
+		}
+	}
+
+	std::vector<uint8_t> data(totalSize);
+
+	for (uint32_t arrayLayer = 0; arrayLayer < arrayLayers; arrayLayer++)
+	{
+		for (uint32_t mipLevel = 0; mipLevel < mipLevels; mipLevel++)
+		{
+			uint32_t width = glm::max(extent.width >> mipLevel, 1u);
+			uint32_t height = glm::max(extent.height >> mipLevel, 1u);
+			uint32_t depth = glm::max(extent.depth >> mipLevel, 1u);
+
+			uint32_t blocksX = (width + VKTS_ENCODE_BLOCK_LENGTH - 1) / VKTS_ENCODE_BLOCK_LENGTH;
+			uint32_t blocksY = (height + VKTS_ENCODE_BLOCK_LENGTH - 1) / VKTS_ENCODE_BLOCK_LENGTH;
+
+			uint8_t* levelData = &data[allOffsets[arrayLayer * mipLevels + mipLevel]];
+
+			std::atomic<VkBool32> result(VK_TRUE);
+
+			// Blocks do not depend on each other, so every row of blocks is encoded in parallel.
+
+			parallelFor(0, depth * blocksY, 1, [&](const uint32_t begin, const uint32_t end)
+			{
+				std::vector<glm::vec4> allRows(VKTS_ENCODE_BLOCK_LENGTH * width);
+
+				glm::vec4 rgba[VKTS_ENCODE_BLOCK_TEXELS];
+
+				for (uint32_t blockRow = begin; blockRow < end; blockRow++)
+				{
+					uint32_t blockY = blockRow % blocksY;
+					uint32_t z = blockRow / blocksY;
+
+					// Texels outside of the image repeat the last row and column.
+
+					for (uint32_t row = 0; row < VKTS_ENCODE_BLOCK_LENGTH; row++)
+					{
+						uint32_t y = glm::min(blockY * VKTS_ENCODE_BLOCK_LENGTH + row, height - 1);
+
+						if (!sourceImage->readRow(&allRows[row * width], 0, y, z, width, mipLevel, arrayLayer))
+						{
+							result = VK_FALSE;
+
+							return;
+						}
+					}
+
+					for (uint32_t blockX = 0; blockX < blocksX; blockX++)
+					{
+						for (uint32_t i = 0; i < VKTS_ENCODE_BLOCK_TEXELS; i++)
+						{
+							uint32_t x = glm::min(blockX * VKTS_ENCODE_BLOCK_LENGTH + i % VKTS_ENCODE_BLOCK_LENGTH, width - 1);
+
+							rgba[i] = allRows[(i / VKTS_ENCODE_BLOCK_LENGTH) * width + x];
+
+							// NaN would break the endpoint quantization.
+							rgba[i] = glm::mix(rgba[i], glm::vec4(0.0f, 0.0f, 0.0f, 0.0f), glm::isnan(rgba[i]));
+						}
+
+						imageDataEncodeBlock(&levelData[(blockRow * blocksX + blockX) * bytesPerBlock], rgba, targetFormat, quality);
+					}
+				}
+			});
+
+			if (!result)
+			{
+				return IImageDataSP();
+			}
+		}
+	}
+
+	auto targetImage = IImageDataSP(new ImageData(name, sourceImage->getImageType(), targetFormat, extent, mipLevels, arrayLayers, allOffsets, &data[0], totalSize, sourceImage->getMaxLuminance()));
+
+	if (!targetImage.get() || !targetImage->getData())
+	{
+		return IImageDataSP();
+	}
+
+	if (key)
+	{
+		SmartPointerVector<IImageDataSP> allImageData;
+
+		allImageData.append(targetImage);
+
+		cacheSaveImageDatas(key, allImageData);
+	}
+
+	return targetImage;
+}
+
+}
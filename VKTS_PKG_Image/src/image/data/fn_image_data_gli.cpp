@@ -75,20 +75,30 @@ static VkFormat imageDataTranslateFormat(const gli::format format)
 		//
 		case gli::FORMAT_RGB_DXT1_UNORM_BLOCK8:
 			return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+		case gli::FORMAT_RGB_DXT1_SRGB_BLOCK8:
+			return VK_FORMAT_BC1_RGB_SRGB_BLOCK;
 		case gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8:
 			return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+		case gli::FORMAT_RGBA_DXT1_SRGB_BLOCK8:
+			return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
 		case gli::FORMAT_RGBA_DXT3_UNORM_BLOCK16:
 			return VK_FORMAT_BC2_UNORM_BLOCK;
 		case gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16:
 			return VK_FORMAT_BC3_UNORM_BLOCK;
+		case gli::FORMAT_RGBA_DXT5_SRGB_BLOCK16:
+			return VK_FORMAT_BC3_SRGB_BLOCK;
 		case gli::FORMAT_R_ATI1N_UNORM_BLOCK8:
 			return VK_FORMAT_BC4_UNORM_BLOCK;
 		case gli::FORMAT_RG_ATI2N_UNORM_BLOCK16:
 			return VK_FORMAT_BC5_UNORM_BLOCK;
+		case gli::FORMAT_RGB_BP_UFLOAT_BLOCK16:
+			return VK_FORMAT_BC6H_UFLOAT_BLOCK;
 		case gli::FORMAT_RGB_BP_SFLOAT_BLOCK16:
 			return VK_FORMAT_BC6H_SFLOAT_BLOCK;
 		case gli::FORMAT_RGBA_BP_UNORM_BLOCK16:
 			return VK_FORMAT_BC7_UNORM_BLOCK;
+		case gli::FORMAT_RGBA_BP_SRGB_BLOCK16:
+			return VK_FORMAT_BC7_SRGB_BLOCK;
 		//
 		case gli::FORMAT_RGB_ETC2_UNORM_BLOCK8:
 			return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
@@ -179,20 +189,30 @@ static gli::format imageDataTranslateFormat(const VkFormat format)
 		//
 		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
 			return gli::FORMAT_RGB_DXT1_UNORM_BLOCK8;
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+			return gli::FORMAT_RGB_DXT1_SRGB_BLOCK8;
 		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
 			return gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8;
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+			return gli::FORMAT_RGBA_DXT1_SRGB_BLOCK8;
 		case VK_FORMAT_BC2_UNORM_BLOCK:
 			return gli::FORMAT_RGBA_DXT3_UNORM_BLOCK16;
 		case VK_FORMAT_BC3_UNORM_BLOCK:
 			return gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16;
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+			return gli::FORMAT_RGBA_DXT5_SRGB_BLOCK16;
 		case VK_FORMAT_BC4_UNORM_BLOCK:
 			return gli::FORMAT_R_ATI1N_UNORM_BLOCK8;
 		case VK_FORMAT_BC5_UNORM_BLOCK:
 			return gli::FORMAT_RG_ATI2N_UNORM_BLOCK16;
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+			return gli::FORMAT_RGB_BP_UFLOAT_BLOCK16;
 		case VK_FORMAT_BC6H_SFLOAT_BLOCK:
 			return gli::FORMAT_RGB_BP_SFLOAT_BLOCK16;
 		case VK_FORMAT_BC7_UNORM_BLOCK:
 			return gli::FORMAT_RGBA_BP_UNORM_BLOCK16;
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+			return gli::FORMAT_RGBA_BP_SRGB_BLOCK16;
 		//
 		case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
 			return gli::FORMAT_RGB_ETC2_UNORM_BLOCK8;
@@ -244,6 +264,8 @@ static gli::format imageDataTranslateFormat(const VkFormat format)
 
 IImageDataSP VKTS_APIENTRY imageDataLoadGli(const std::string& name, const IBinaryBufferSP& buffer)
 {
+    VKTS_PROFILE_ZONE("imageDataLoadGli");
+
     if (!buffer.get())
     {
         return IImageDataSP();
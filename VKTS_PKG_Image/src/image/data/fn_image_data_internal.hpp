@@ -32,8 +32,46 @@
 namespace vkts
 {
 
+/**
+ * Converts count tightly packed texels to RGBA. Missing channels are zero, a missing alpha is one.
+ */
+typedef void (*ImageDataReadTexelsFunction)(glm::vec4* rgba, const uint8_t* texels, const uint32_t count);
+
+/**
+ * Converts count RGBA values to tightly packed texels. Surplus channels are dropped.
+ */
+typedef void (*ImageDataWriteTexelsFunction)(uint8_t* texels, const glm::vec4* rgba, const uint32_t count);
+
+/**
+ * Never returns nullptr. Formats without texel access result in (0, 0, 0, 1). SRGB values are returned non-linear.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL ImageDataReadTexelsFunction VKTS_APIENTRY imageDataGetReadTexelsFunction(const VkFormat format);
+
+/**
+ * Never returns nullptr. Formats without texel access are not written.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL ImageDataWriteTexelsFunction VKTS_APIENTRY imageDataGetWriteTexelsFunction(const VkFormat format);
+
 VKTS_APICALL glm::vec3 VKTS_APIENTRY imageDataGetScanVector(const uint32_t x, const uint32_t y, const uint32_t side, const float step, const float offset);
 
+/**
+ * Creates an image data with all mip levels of all array layers in one allocation. The texels are not initialized.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL IImageDataSP VKTS_APIENTRY imageDataCreateChain(const std::string& name, const VkImageType imageType, const VkFormat format, const VkExtent3D& extent, const uint32_t arrayLayers, const float maxLuminance);
+
+/**
+ * Filters every mip level, starting with the second one, from the previous level of the same image data.
+ *
+ * @ThreadSafe
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY imageDataMipmapChainLevels(const IImageDataSP& imageData, const enum VkTsMipmapFilter filter, const VkBool32 nonLinear);
+
 /**
  *
  * @ThreadSafe
@@ -26,12 +26,285 @@
 
 #include <vkts/image/vkts_image.hpp>
 
+#include "ImageData.hpp"
+
+// Kaiser window as used by many texture tools: Three texels support and an alpha of four.
+#define VKTS_MIPMAP_FILTER_RADIUS 3.0f
+#define VKTS_MIPMAP_KAISER_ALPHA 4.0f
+
 namespace vkts
 {
 
-SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, VkBool32 const addSourceAsCopy, const std::string& name)
+/**
+ * Source texel and its weight for one target texel along one axis.
+ */
+typedef struct _MipmapTap {
+
+	uint32_t index;
+
+	float weight;
+
+} MipmapTap;
+
+static float imageDataMipmapSinc(const float x)
+{
+	if (fabsf(x) < 1.0e-6f)
+	{
+		return 1.0f;
+	}
+
+	return sinf(VKTS_MATH_PI * x) / (VKTS_MATH_PI * x);
+}
+
+static float imageDataMipmapBesselI0(const float x)
+{
+	// Power series, which converges fast for the used alpha.
+
+	float sum = 1.0f;
+	float term = 1.0f;
+
+	for (uint32_t k = 1; k < 32; k++)
+	{
+		term *= (x * 0.5f / (float)k) * (x * 0.5f / (float)k);
+
+		sum += term;
+
+		if (term < sum * 1.0e-7f)
+		{
+			break;
+		}
+	}
+
+	return sum;
+}
+
+static float imageDataMipmapGetWeight(const enum VkTsMipmapFilter filter, const float x)
+{
+	if (fabsf(x) >= VKTS_MIPMAP_FILTER_RADIUS)
+	{
+		return 0.0f;
+	}
+
+	float t = x / VKTS_MIPMAP_FILTER_RADIUS;
+
+	switch (filter)
+	{
+		case VKTS_MIPMAP_FILTER_KAISER:
+
+			return imageDataMipmapSinc(x) * imageDataMipmapBesselI0(VKTS_MIPMAP_KAISER_ALPHA * sqrtf(1.0f - t * t)) / imageDataMipmapBesselI0(VKTS_MIPMAP_KAISER_ALPHA);
+
+		case VKTS_MIPMAP_FILTER_LANCZOS:
+
+			return imageDataMipmapSinc(x) * imageDataMipmapSinc(t);
+
+		default:
+
+			return 0.0f;
+	}
+}
+
+/**
+ * Gathers the normalized taps for every target texel. Texels outside the source are clamped to the edge.
+ */
+static std::vector<std::vector<MipmapTap>> imageDataMipmapGetTaps(const enum VkTsMipmapFilter filter, const uint32_t sourceLength, const uint32_t targetLength)
+{
+	std::vector<std::vector<MipmapTap>> allTaps(targetLength);
+
+	float scale = (float)sourceLength / (float)targetLength;
+
+	for (uint32_t i = 0; i < targetLength; i++)
+	{
+		float center = ((float)i + 0.5f) * scale;
+
+		float radius = (filter == VKTS_MIPMAP_FILTER_BOX) ? scale * 0.5f : scale * VKTS_MIPMAP_FILTER_RADIUS;
+
+		int32_t first = (int32_t)floorf(center - radius);
+		int32_t last = (int32_t)ceilf(center + radius);
+
+		float sum = 0.0f;
+
+		for (int32_t j = first; j < last; j++)
+		{
+			float weight;
+
+			if (filter == VKTS_MIPMAP_FILTER_BOX)
+			{
+				// Covered part of the source texel.
+				weight = glm::min((float)(j + 1), center + radius) - glm::max((float)j, center - radius);
+			}
+			else
+			{
+				weight = imageDataMipmapGetWeight(filter, ((float)j + 0.5f - center) / scale);
+			}
+
+			if (weight == 0.0f)
+			{
+				continue;
+			}
+
+			MipmapTap tap;
+
+			tap.index = (uint32_t)glm::clamp(j, 0, (int32_t)sourceLength - 1);
+			tap.weight = weight;
+
+			allTaps[i].push_back(tap);
+
+			sum += weight;
+		}
+
+		if (sum != 0.0f)
+		{
+			for (auto& currentTap : allTaps[i])
+			{
+				currentTap.weight /= sum;
+			}
+		}
+	}
+
+	return allTaps;
+}
+
+/**
+ * Filters one level of the source into one level of the target. The filter is separable, so every target row
+ * is built from horizontally filtered source rows. Rows are built in parallel, as they do not depend on each other.
+ */
+static VkBool32 imageDataMipmapLevel(const IImageDataSP& targetImage, const uint32_t targetMipLevel, const uint32_t targetArrayLayer, const IImageDataSP& sourceImage, const uint32_t sourceMipLevel, const uint32_t sourceArrayLayer, const enum VkTsMipmapFilter filter, const VkBool32 nonLinear)
 {
-    if (name.size() == 0 || !sourceImage.get())
+	uint32_t sourceWidth = glm::max(sourceImage->getWidth() >> sourceMipLevel, 1u);
+	uint32_t sourceHeight = glm::max(sourceImage->getHeight() >> sourceMipLevel, 1u);
+	uint32_t sourceDepth = glm::max(sourceImage->getDepth() >> sourceMipLevel, 1u);
+
+	uint32_t targetWidth = glm::max(targetImage->getWidth() >> targetMipLevel, 1u);
+	uint32_t targetHeight = glm::max(targetImage->getHeight() >> targetMipLevel, 1u);
+	uint32_t targetDepth = glm::max(targetImage->getDepth() >> targetMipLevel, 1u);
+
+	auto allTapsX = imageDataMipmapGetTaps(filter, sourceWidth, targetWidth);
+	auto allTapsY = imageDataMipmapGetTaps(filter, sourceHeight, targetHeight);
+	auto allTapsZ = imageDataMipmapGetTaps(filter, sourceDepth, targetDepth);
+
+	// Consecutive target rows share most of their source rows, so the horizontally filtered rows are kept in a small ring.
+
+	size_t maxTapsY = 0;
+
+	for (const auto& currentTaps : allTapsY)
+	{
+		maxTapsY = glm::max(maxTapsY, currentTaps.size());
+	}
+
+	size_t cacheSize = maxTapsY + 2;
+
+	std::atomic<VkBool32> result(VK_TRUE);
+
+	parallelFor(0, targetDepth * targetHeight, 0, [&](const uint32_t begin, const uint32_t end)
+	{
+		std::vector<glm::vec4> sourceRow(sourceWidth);
+		std::vector<glm::vec4> targetRow(targetWidth);
+
+		std::vector<std::vector<glm::vec4>> allCachedRows(cacheSize, std::vector<glm::vec4>(targetWidth));
+		std::vector<int64_t> allCachedKeys(cacheSize, -1);
+		size_t nextCacheSlot = 0;
+
+		for (uint32_t row = begin; row < end; row++)
+		{
+			uint32_t y = row % targetHeight;
+			uint32_t z = row / targetHeight;
+
+			std::fill(targetRow.begin(), targetRow.end(), glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+
+			for (const auto& tapZ : allTapsZ[z])
+			{
+				for (const auto& tapY : allTapsY[y])
+				{
+					int64_t key = (int64_t)tapZ.index * (int64_t)sourceHeight + (int64_t)tapY.index;
+
+					size_t slot = 0;
+
+					while (slot < cacheSize && allCachedKeys[slot] != key)
+					{
+						slot++;
+					}
+
+					if (slot == cacheSize)
+					{
+						slot = nextCacheSlot;
+
+						nextCacheSlot = (nextCacheSlot + 1) % cacheSize;
+
+						if (!sourceImage->readRow(&sourceRow[0], 0, tapY.index, tapZ.index, sourceWidth, sourceMipLevel, sourceArrayLayer))
+						{
+							result = VK_FALSE;
+
+							return;
+						}
+
+						// Non-linear to linear, as averaging is only correct for linear color values.
+
+						if (nonLinear)
+						{
+							for (auto& currentTexel : sourceRow)
+							{
+								currentTexel = glm::vec4(glm::pow(glm::vec3(currentTexel), glm::vec3(VKTS_GAMMA)), currentTexel.a);
+							}
+						}
+
+						auto& cachedRow = allCachedRows[slot];
+
+						for (uint32_t x = 0; x < targetWidth; x++)
+						{
+							glm::vec4 rgba = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+							for (const auto& tapX : allTapsX[x])
+							{
+								rgba += sourceRow[tapX.index] * tapX.weight;
+							}
+
+							cachedRow[x] = rgba;
+						}
+
+						allCachedKeys[slot] = key;
+					}
+
+					const auto& cachedRow = allCachedRows[slot];
+
+					float weightYZ = tapY.weight * tapZ.weight;
+
+					for (uint32_t x = 0; x < targetWidth; x++)
+					{
+						targetRow[x] += cachedRow[x] * weightYZ;
+					}
+				}
+			}
+
+			// Linear to non-linear. Negative lobes of the filters are cut off before.
+
+			if (nonLinear)
+			{
+				for (auto& currentTexel : targetRow)
+				{
+					currentTexel = glm::vec4(glm::pow(glm::max(glm::vec3(currentTexel), glm::vec3(0.0f)), glm::vec3(1.0f / VKTS_GAMMA)), currentTexel.a);
+				}
+			}
+
+			if (!targetImage->writeRow(&targetRow[0], 0, y, z, targetWidth, targetMipLevel, targetArrayLayer))
+			{
+				result = VK_FALSE;
+
+				return;
+			}
+		}
+	});
+
+	return result;
+}
+
+static VkBool32 imageDataMipmapIsSupported(const IImageDataSP& sourceImage)
+{
+	return sourceImage->isUNORM() || sourceImage->isSFLOAT() || sourceImage->isSRGB();
+}
+
+SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataSP& sourceImage, VkBool32 const addSourceAsCopy, const std::string& name, const enum VkTsMipmapFilter filter, const enum VkTsImageDataType imageDataType)
+{
+    if (name.size() == 0 || !sourceImage.get() || !imageDataMipmapIsSupported(sourceImage))
     {
         return SmartPointerVector<IImageDataSP>();
     }
@@ -48,6 +321,8 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataS
     auto sourceImageName = sourceImageFilename.substr(0, dotIndex);
     auto sourceImageExtension = sourceImageFilename.substr(dotIndex);
 
+    VkBool32 nonLinear = sourceImage->isSRGB() || imageDataType == VKTS_LDR_COLOR_DATA;
+
     IImageDataSP currentSourceImage = sourceImage;
     int32_t width = currentSourceImage->getWidth();
     int32_t height = currentSourceImage->getHeight();
@@ -95,36 +370,9 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataS
             return SmartPointerVector<IImageDataSP>();
         }
 
-        for (int32_t z = 0; z < depth; z++)
+        if (!imageDataMipmapLevel(currentTargetImage, 0, 0, currentSourceImage, 0, 0, filter, nonLinear))
         {
-            for (int32_t y = 0; y < height; y++)
-            {
-                for (int32_t x = 0; x < width; x++)
-                {
-                    glm::vec4 rgba = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
-                    float sampleCount = 0.0f;
-
-                    for (int32_t iz = z * 2; iz < z * 2 + 1; iz++)
-                    {
-                        for (int32_t iy = y * 2; iy < y * 2 + 1; iy++)
-                        {
-                            for (int32_t ix = x * 2; ix < x * 2 + 1; ix++)
-                            {
-                                rgba += currentSourceImage->getTexel(ix, iy, iz, 0, 0);
-
-                                sampleCount += 1.0f;
-                            }
-                        }
-                    }
-
-                    if (sampleCount > 0.0f)
-                    {
-                        rgba /= sampleCount;
-
-                        currentTargetImage->setTexel(rgba, x, y, z, 0, 0);
-                    }
-                }
-            }
+            return SmartPointerVector<IImageDataSP>();
         }
 
         result.append(currentTargetImage);
@@ -140,4 +388,134 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataMipmap(const IImageDataS
     return result;
 }
 
+IImageDataSP VKTS_APIENTRY imageDataCreateChain(const std::string& name, const VkImageType imageType, const VkFormat format, const VkExtent3D& extent, const uint32_t arrayLayers, const float maxLuminance)
+{
+    uint32_t mipLevels = 1;
+
+    while ((extent.width >> mipLevels) > 0 || (extent.height >> mipLevels) > 0 || (extent.depth >> mipLevels) > 0)
+    {
+    	mipLevels++;
+    }
+
+    uint32_t bytesPerTexel = imageDataGetBytesPerTexel(format);
+
+    // All levels of all layers are stored in one allocation, in the same order as merged images.
+
+    std::vector<uint32_t> allOffsets;
+
+    uint32_t totalSize = 0;
+
+    for (uint32_t arrayLayer = 0; arrayLayer < arrayLayers; arrayLayer++)
+    {
+    	for (uint32_t mipLevel = 0; mipLevel < mipLevels; mipLevel++)
+    	{
+    		allOffsets.push_back(totalSize);
+
+    		totalSize += glm::max(extent.width >> mipLevel, 1u) * glm::max(extent.height >> mipLevel, 1u) * glm::max(extent.depth >> mipLevel, 1u) * bytesPerTexel;
+    	}
+    }
+
+    auto buffer = binaryBufferCreate(totalSize);
+
+    if (!buffer.get() || buffer->getSize() != totalSize)
+    {
+        return IImageDataSP();
+    }
+
+    IImageDataSP targetImage = IImageDataSP(new ImageData(name, imageType, format, extent, mipLevels, arrayLayers, allOffsets, buffer, maxLuminance));
+
+    if (!targetImage.get() || !targetImage->getData())
+    {
+    	return IImageDataSP();
+    }
+
+    return targetImage;
+}
+
+VkBool32 VKTS_APIENTRY imageDataMipmapChainLevels(const IImageDataSP& imageData, const enum VkTsMipmapFilter filter, const VkBool32 nonLinear)
+{
+    if (!imageData.get() || !imageDataMipmapIsSupported(imageData))
+    {
+        return VK_FALSE;
+    }
+
+    uint32_t arrayLayers = imageData->getArrayLayers();
+
+    for (uint32_t mipLevel = 1; mipLevel < imageData->getMipLevels(); mipLevel++)
+    {
+    	// Each level depends on the previous one, so only the layers and rows of one level are built in parallel.
+
+    	std::atomic<VkBool32> result(VK_TRUE);
+
+    	parallelFor(0, arrayLayers, 1, [&](const uint32_t begin, const uint32_t end)
+    	{
+    		for (uint32_t arrayLayer = begin; arrayLayer < end; arrayLayer++)
+    		{
+    			if (!imageDataMipmapLevel(imageData, mipLevel, arrayLayer, imageData, mipLevel - 1, arrayLayer, filter, nonLinear))
+    			{
+    				result = VK_FALSE;
+    			}
+    		}
+    	});
+
+    	if (!result)
+    	{
+    		return VK_FALSE;
+    	}
+    }
+
+    return VK_TRUE;
+}
+
+IImageDataSP VKTS_APIENTRY imageDataMipmapChain(const IImageDataSP& sourceImage, const std::string& name, const enum VkTsMipmapFilter filter, const enum VkTsImageDataType imageDataType)
+{
+    if (name.size() == 0 || !sourceImage.get() || !imageDataMipmapIsSupported(sourceImage))
+    {
+        return IImageDataSP();
+    }
+
+    VkExtent3D extent = sourceImage->getExtent3D();
+
+    uint32_t arrayLayers = sourceImage->getArrayLayers();
+
+    IImageDataSP targetImage = imageDataCreateChain(name, sourceImage->getImageType(), sourceImage->getFormat(), extent, arrayLayers, sourceImage->getMaxLuminance());
+
+    if (!targetImage.get())
+    {
+    	return IImageDataSP();
+    }
+
+    //
+
+    uint32_t rowSize = extent.width * imageDataGetBytesPerTexel(sourceImage->getFormat());
+
+    for (uint32_t arrayLayer = 0; arrayLayer < arrayLayers; arrayLayer++)
+    {
+    	for (uint32_t z = 0; z < extent.depth; z++)
+    	{
+    		for (uint32_t y = 0; y < extent.height; y++)
+    		{
+    			const void* sourceRow = sourceImage->getRowData(y, z, 0, arrayLayer);
+    			void* targetRow = targetImage->getWritableRowData(y, z, 0, arrayLayer);
+
+    			if (!sourceRow || !targetRow)
+    			{
+    				return IImageDataSP();
+    			}
+
+    			memcpy(targetRow, sourceRow, rowSize);
+    		}
+    	}
+    }
+
+    //
+
+    if (!imageDataMipmapChainLevels(targetImage, filter, sourceImage->isSRGB() || imageDataType == VKTS_LDR_COLOR_DATA))
+    {
+    	return IImageDataSP();
+    }
+
+    return targetImage;
+}
+
 }
@@ -80,6 +80,168 @@ VKTS_APICALL glm::vec3 VKTS_APIENTRY imageDataGetScanVector(const uint32_t x, co
 	return glm::normalize(scanVector);
 }
 
+/**
+ * Tangent space direction of one sample, its weight and the mip level of the source cube map, it is fetched from.
+ */
+typedef struct _PrefilterSample {
+
+	glm::vec3 direction;
+
+	float weight;
+
+	float lod;
+
+} PrefilterSample;
+
+static float imageDataGetPrefilterLod(const float pdf, const uint32_t samples, const IImageDataSP& sourceImage)
+{
+	// Filtered importance sampling: The more solid angle one sample covers compared to one texel, the coarser is the mip level.
+
+	if (sourceImage->getMipLevels() <= 1 || !(pdf > 0.0f))
+	{
+		return 0.0f;
+	}
+
+	float solidAngleSample = 1.0f / ((float)samples * pdf);
+	float solidAngleTexel = 4.0f * VKTS_MATH_PI / (6.0f * (float)sourceImage->getWidth() * (float)sourceImage->getHeight());
+
+	float lod = 0.5f * log2f(solidAngleSample / solidAngleTexel) + 1.0f;
+
+	if (!(lod > 0.0f))
+	{
+		return 0.0f;
+	}
+
+	return glm::min(lod, (float)(sourceImage->getMipLevels() - 1));
+}
+
+static glm::vec3 imageDataGetPrefilterSample(const IImageDataSP& sourceImage, const glm::vec3& L, const float lod)
+{
+	uint32_t mipLevel = (uint32_t)lod;
+
+	float fraction = lod - (float)mipLevel;
+
+	glm::vec3 color = glm::vec3(sourceImage->getSampleCubeMap(L.x, L.y, L.z, VK_FILTER_LINEAR, mipLevel));
+
+	if (fraction > 0.0f)
+	{
+		color = glm::mix(color, glm::vec3(sourceImage->getSampleCubeMap(L.x, L.y, L.z, VK_FILTER_LINEAR, mipLevel + 1)), fraction);
+	}
+
+	return color;
+}
+
+/**
+ * Filters the given side of the source cube map into the first mip level of the target image.
+ * Every texel only depends on the sample table, so the result is identical for any number of threads.
+ */
+static void imageDataPrefilterSide(const IImageDataSP& targetImage, const IImageDataSP& sourceImage, const uint32_t side, const std::vector<PrefilterSample>& allSamples, const VkBool32 reflect)
+{
+	uint32_t length = targetImage->getWidth();
+
+	// 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
+	float step = 2.0f / (float)length;
+	float offset = step * 0.5f;
+
+	parallelFor(0, length, 1, [&](const uint32_t begin, const uint32_t end)
+	{
+		std::vector<glm::vec4> row(length);
+
+		for (uint32_t y = begin; y < end; y++)
+		{
+			for (uint32_t x = 0; x < length; x++)
+			{
+				glm::vec3 scanVector = imageDataGetScanVector(x, y, side, step, offset);
+
+				glm::mat3 basis = renderGetBasis(scanVector);
+
+				glm::vec3 color = glm::vec3(0.0f, 0.0f, 0.0f);
+
+				float sampleDivisior = 0.0f;
+
+				for (const auto& currentSample : allSamples)
+				{
+					// Transform to world space.
+					glm::vec3 L = basis * currentSample.direction;
+
+					if (reflect)
+					{
+						// Note: reflect takes incident vector.
+						// Note: N = V
+						L = glm::reflect(-scanVector, L);
+					}
+
+					auto currentColor = imageDataGetPrefilterSample(sourceImage, L, currentSample.lod) * currentSample.weight;
+
+					if (!std::isnan(currentColor.x) && !std::isnan(currentColor.y) && !std::isnan(currentColor.z))
+					{
+						color += currentColor;
+
+						sampleDivisior += 1.0f;
+					}
+				}
+
+				//
+
+				if (sampleDivisior > 0.0f)
+				{
+					color = color / sampleDivisior;
+				}
+
+				row[x] = glm::vec4(color, 1.0f);
+			}
+
+			targetImage->writeRow(&row[0], 0, y, 0, length, 0, 0);
+		}
+	});
+}
+
+static std::vector<PrefilterSample> imageDataGetCookTorranceSamples(const IImageDataSP& sourceImage, const uint32_t samples, const float roughness)
+{
+	std::vector<PrefilterSample> allSamples(samples);
+
+	float alpha = roughness * roughness;
+	float alphaSquared = alpha * alpha;
+
+	for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+	{
+		glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
+
+		allSamples[sampleIndex].direction = renderGetGGXWeightedVector(randomPoint, roughness);
+		allSamples[sampleIndex].weight = 1.0f;
+
+		// As N = V, the PDF D * NdotH / (4 * VdotH) is reduced to D / 4.
+
+		float NdotH = allSamples[sampleIndex].direction.z;
+
+		float denominator = NdotH * NdotH * (alphaSquared - 1.0f) + 1.0f;
+
+		float D = alphaSquared / (VKTS_MATH_PI * denominator * denominator);
+
+		allSamples[sampleIndex].lod = imageDataGetPrefilterLod(D * 0.25f, samples, sourceImage);
+	}
+
+	return allSamples;
+}
+
+static std::vector<PrefilterSample> imageDataGetCosineSamples(const IImageDataSP& sourceImage, const uint32_t samples)
+{
+	std::vector<PrefilterSample> allSamples(samples);
+
+	for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+	{
+		glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
+
+		allSamples[sampleIndex].direction = renderGetCosineWeightedVector(randomPoint);
+		allSamples[sampleIndex].weight = 1.0f;
+
+		// PDF is NdotL / PI.
+		allSamples[sampleIndex].lod = imageDataGetPrefilterLod(allSamples[sampleIndex].direction.z / VKTS_MATH_PI, samples, sourceImage);
+	}
+
+	return allSamples;
+}
+
 SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterCookTorrance(const IImageDataSP& sourceImage, const uint32_t samples, const std::string& name)
 {
     if (name.size() == 0 || !sourceImage.get() || sourceImage->getArrayLayers() != 6 || sourceImage->getDepth() != 1 || sourceImage->getWidth() != sourceImage->getHeight() || samples == 0 || sourceImage->getWidth() < 2)
@@ -138,64 +300,29 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterCookTorrance(co
 
     uint32_t roughnessSamples = result.size() / 6;
 
-    for (uint32_t side = 0; side < 6; side++)
-    {
-    	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
-    	{
-    		uint32_t length = sourceImage->getWidth() / (1 << roughnessSampleIndex);
-
-    		// 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-    		float step = 2.0f / (float)length;
-    		float offset = step * 0.5f;
-
-    		//
-
-    		float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
-
-    		//
-
-    		glm::vec3 scanVector;
-
-    		for (uint32_t y = 0; y < length; y++)
-    		{
-    			for (uint32_t x = 0; x < length; x++)
-    			{
-    				scanVector = imageDataGetScanVector(x, y, side, step, offset);
-
-    				//
+    // The samples only depend on the roughness, so they are shared by all sides.
 
-    				glm::mat3 basis = renderGetBasis(scanVector);
+    std::vector<std::vector<PrefilterSample>> allRoughnessSamples(roughnessSamples);
 
-    				glm::vec3 colorCookTorrance = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    				float sampleDivisior = 0.0f;
-
-    				for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    				{
-    					glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
-
-    					// N = V
-    					auto currentColorCookTorrance = renderCookTorrance(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, roughness);
-
-    					if (!std::isnan(currentColorCookTorrance.x) && !std::isnan(currentColorCookTorrance.y) && !std::isnan(currentColorCookTorrance.z))
-    					{
-    						colorCookTorrance += currentColorCookTorrance;
+    for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+    {
+    	float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
 
-    						sampleDivisior += 1.0f;
-    					}
-    				}
+    	allRoughnessSamples[roughnessSampleIndex] = imageDataGetCookTorranceSamples(sourceImage, samples, roughness);
+    }
 
-    				//
+    for (uint32_t side = 0; side < 6; side++)
+    {
+    	VKTS_PROFILE_ZONE("imageDataPrefilterCookTorrance side");
 
-    				if (sampleDivisior > 0.0f)
-    				{
-    					colorCookTorrance = colorCookTorrance / sampleDivisior;
-    				}
+    	double startTime = timeGetRaw();
 
-    				result[side * roughnessSamples + roughnessSampleIndex]->setTexel(glm::vec4(colorCookTorrance, 1.0f), x, y, 0, 0, 0);
-    			}
-    		}
+    	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+    	{
+    		imageDataPrefilterSide(result[side * roughnessSamples + roughnessSampleIndex], sourceImage, side, allRoughnessSamples[roughnessSampleIndex], VK_TRUE);
     	}
+
+    	logPrint(VKTS_LOG_DEBUG, __FILE__, __LINE__, "Cook torrance side %u prefiltered in %f seconds", side, timeGetRaw() - startTime);
     }
 
     //
@@ -261,61 +388,40 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterOrenNayar(const
 
     uint32_t roughnessSamples = result.size() / 6;
 
-    uint32_t length = sourceImage->getWidth();
-
-    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-	float step = 2.0f / (float)length;
-	float offset = step * 0.5f;
+    // The directions are cosine weighted for every roughness, only the weights differ.
 
-    for (uint32_t side = 0; side < 6; side++)
-    {
-    	glm::vec3 scanVector;
-
-    	for (uint32_t y = 0; y < length; y++)
-    	{
-    		for (uint32_t x = 0; x < length; x++)
-    		{
-    			scanVector = imageDataGetScanVector(x, y, side, step, offset);
+    auto allCosineSamples = imageDataGetCosineSamples(sourceImage, samples);
 
-    			//
+    std::vector<std::vector<PrefilterSample>> allRoughnessSamples(roughnessSamples, allCosineSamples);
 
-    			glm::mat3 basis = renderGetBasis(scanVector);
-
-    			for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
-    			{
-    				glm::vec3 colorOrenNayar = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    				float roughness = (float)roughnessSampleIndex / (float)(roughnessSamples - 1);
-
-    				float sampleDivisior = 0.0f;
-
-    				for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    				{
-    					glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
+    for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+    {
+    	float roughness = roughnessSamples > 1 ? (float)roughnessSampleIndex / (float)(roughnessSamples - 1) : 0.0f;
 
-    					// N = V
-    					auto currentColorOrenNayar = renderOrenNayar(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis, scanVector, scanVector, roughness);
+    	float roughnessSquared = roughness * roughness;
 
-    					if (!std::isnan(currentColorOrenNayar.x) && !std::isnan(currentColorOrenNayar.y) && !std::isnan(currentColorOrenNayar.z))
-    					{
-    						colorOrenNayar += currentColorOrenNayar;
+    	float A = 1.0f - 0.5f * (roughnessSquared / (roughnessSquared + 0.57f));
 
-    						sampleDivisior += 1.0f;
-    					}
+    	// As N = V, the angle between V and N and the projected angle gamma are zero, so the B term vanishes.
 
-    				}
+    	for (auto& currentSample : allRoughnessSamples[roughnessSampleIndex])
+    	{
+    		currentSample.weight = glm::max(0.0f, currentSample.direction.z) * A;
+    	}
+    }
 
-    				//
+    for (uint32_t side = 0; side < 6; side++)
+    {
+    	VKTS_PROFILE_ZONE("imageDataPrefilterOrenNayar side");
 
-    				if (sampleDivisior > 0.0f)
-    				{
-    					colorOrenNayar = colorOrenNayar / sampleDivisior;
-    				}
+    	double startTime = timeGetRaw();
 
-    				result[side * roughnessSamples + roughnessSampleIndex]->setTexel(glm::vec4(colorOrenNayar, 1.0f), x, y, 0, 0, 0);
-    			}
-    		}
+    	for (uint32_t roughnessSampleIndex = 0; roughnessSampleIndex < roughnessSamples; roughnessSampleIndex++)
+    	{
+    		imageDataPrefilterSide(result[side * roughnessSamples + roughnessSampleIndex], sourceImage, side, allRoughnessSamples[roughnessSampleIndex], VK_FALSE);
     	}
+
+    	logPrint(VKTS_LOG_DEBUG, __FILE__, __LINE__, "Oren-Nayar side %u prefiltered in %f seconds", side, timeGetRaw() - startTime);
     }
 
     //
@@ -366,54 +472,17 @@ SmartPointerVector<IImageDataSP> VKTS_APIENTRY imageDataPrefilterLambert(const I
     // Lambert diffuse.
     //
 
-    uint32_t length = sourceImage->getWidth();
-
-    // 0.5 as step goes form -1.0 to 1.0 and not just 0.0 to 1.0
-	float step = 2.0f / (float)length;
-	float offset = step * 0.5f;
+    auto allSamples = imageDataGetCosineSamples(sourceImage, samples);
 
     for (uint32_t side = 0; side < 6; side++)
     {
-    	glm::vec3 scanVector;
-
-    	for (uint32_t y = 0; y < length; y++)
-    	{
-    		for (uint32_t x = 0; x < length; x++)
-    		{
-    			scanVector = imageDataGetScanVector(x, y, side, step, offset);
+    	VKTS_PROFILE_ZONE("imageDataPrefilterLambert side");
 
-    			//
+    	double startTime = timeGetRaw();
 
-    			glm::mat3 basis = renderGetBasis(scanVector);
+    	imageDataPrefilterSide(result[side], sourceImage, side, allSamples, VK_FALSE);
 
-    			glm::vec3 colorLambert = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    			float sampleDivisior = 0.0f;
-
-    			for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-    			{
-    				glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
-
-    				auto currentColorLambert = renderLambert(sourceImage, VK_FILTER_LINEAR, 0, randomPoint, basis);
-
-    				if (!std::isnan(currentColorLambert.x) && !std::isnan(currentColorLambert.y) && !std::isnan(currentColorLambert.z))
-    				{
-    					colorLambert += currentColorLambert;
-
-    					sampleDivisior += 1.0f;
-    				}
-    			}
-
-    			//
-
-    			if (sampleDivisior > 0.0f)
-    			{
-    				colorLambert = colorLambert / sampleDivisior;
-    			}
-
-    			result[side]->setTexel(glm::vec4(colorLambert, 1.0f), x, y, 0, 0, 0);
-    		}
-    	}
+    	logPrint(VKTS_LOG_DEBUG, __FILE__, __LINE__, "Lambert side %u prefiltered in %f seconds", side, timeGetRaw() - startTime);
     }
 
     //
@@ -451,29 +520,41 @@ IImageDataSP VKTS_APIENTRY imageDataEnvironmentBRDF(const uint32_t length, const
 
 	//
 
-	for (uint32_t y = 0; y < length; y++)
+	std::vector<glm::vec2> allRandomPoints(samples);
+
+	for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+	{
+		allRandomPoints[sampleIndex] = randomHammersley(sampleIndex, samples);
+	}
+
+	parallelFor(0, length, 1, [&](const uint32_t begin, const uint32_t end)
 	{
-		float roughness = float(y) / float(length - 1);
+		std::vector<glm::vec4> row(length);
 
-		for (uint32_t x = 0; x < length; x++)
+		for (uint32_t y = begin; y < end; y++)
 		{
-			float NdotV = float(x) / float(length - 1);
+			float roughness = float(y) / float(length - 1);
 
-			glm::vec3 V = glm::vec3(sqrtf(1.0f - NdotV * NdotV), 0.0f, NdotV);
+			for (uint32_t x = 0; x < length; x++)
+			{
+				float NdotV = float(x) / float(length - 1);
 
-			glm::vec2 outputCookTorrance = glm::vec2(0.0f, 0.0f);
+				glm::vec3 V = glm::vec3(sqrtf(1.0f - NdotV * NdotV), 0.0f, NdotV);
 
-			for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
-			{
-				glm::vec2 randomPoint = randomHammersley(sampleIndex, samples);
+				glm::vec2 outputCookTorrance = glm::vec2(0.0f, 0.0f);
 
-				// Specular
-				outputCookTorrance += renderIntegrateCookTorrance(randomPoint, NdotV, V, roughness);
+				for (uint32_t sampleIndex = 0; sampleIndex < samples; sampleIndex++)
+				{
+					// Specular
+					outputCookTorrance += renderIntegrateCookTorrance(allRandomPoints[sampleIndex], NdotV, V, roughness);
+				}
+
+				row[x] = glm::vec4(outputCookTorrance / float(samples), 0.0f, 1.0f);
 			}
 
-			currentTargetImage->setTexel(glm::vec4(outputCookTorrance / float(samples), 0.0f, 1.0f), x, y, 0, 0, 0);
+			currentTargetImage->writeRow(&row[0], 0, y, 0, length, 0, 0);
 		}
-	}
+	});
 
 	//
 
@@ -53,13 +53,18 @@ VkBool32 VKTS_APIENTRY imageDataIsBLOCK(const VkFormat format)
 	switch (format)
 	{
 		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
 		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
 		case VK_FORMAT_BC2_UNORM_BLOCK:
 		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
 		case VK_FORMAT_BC4_UNORM_BLOCK:
 		case VK_FORMAT_BC5_UNORM_BLOCK:
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
 		case VK_FORMAT_BC6H_SFLOAT_BLOCK:
 		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
 		case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
 		case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK:
 		case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
@@ -162,20 +167,26 @@ uint32_t VKTS_APIENTRY imageDataGetBytesPerTexel(const VkFormat format)
             return imageDataGetBytesPerChannel(format) * imageDataGetNumberChannels(format);
         //
 		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
 			return 8;
 		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
 			return 8;
 		case VK_FORMAT_BC2_UNORM_BLOCK:
 			return 16;
 		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
 			return 16;
 		case VK_FORMAT_BC4_UNORM_BLOCK:
 			return 8;
 		case VK_FORMAT_BC5_UNORM_BLOCK:
 			return 16;
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+			return 16;
 		case VK_FORMAT_BC6H_SFLOAT_BLOCK:
 			return 16;
 		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
 			return 16;
 		case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
 			return 8;
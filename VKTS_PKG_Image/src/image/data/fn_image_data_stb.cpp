@@ -81,6 +81,8 @@ static int imageDataTranslateFormat(const VkFormat format)
 
 IImageDataSP VKTS_APIENTRY imageDataLoadStb(const std::string& name, const IBinaryBufferSP& buffer)
 {
+    VKTS_PROFILE_ZONE("imageDataLoadStb");
+
     if (!buffer.get())
     {
         return IImageDataSP();
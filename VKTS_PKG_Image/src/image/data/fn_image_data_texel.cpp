@@ -0,0 +1,282 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/image/vkts_image.hpp>
+
+#include "fn_image_data_internal.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VKTS_IMAGE_DATA_SSE2
+#endif
+
+namespace vkts
+{
+
+static_assert(sizeof(glm::vec4) == 4 * sizeof(float), "RGBA has to be tightly packed");
+
+static float imageDataSaturate(const float value)
+{
+    // Also maps NaN to zero.
+    return value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+}
+
+template<uint32_t CHANNELS, VkBool32 SWAP>
+static void imageDataReadUNORM(glm::vec4* rgba, const uint8_t* texels, const uint32_t count)
+{
+    uint32_t i = 0;
+
+#ifdef VKTS_IMAGE_DATA_SSE2
+    if (CHANNELS == 4)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 scale = _mm_set1_ps(255.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)&texels[i * 4]);
+
+            __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+            // Division and not multiplication with the reciprocal, to match the scalar path.
+
+            __m128 allTexels[4];
+
+            allTexels[0] = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale);
+            allTexels[1] = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale);
+            allTexels[2] = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale);
+            allTexels[3] = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale);
+
+            for (uint32_t k = 0; k < 4; k++)
+            {
+                if (SWAP)
+                {
+                    allTexels[k] = _mm_shuffle_ps(allTexels[k], allTexels[k], _MM_SHUFFLE(3, 0, 1, 2));
+                }
+
+                _mm_storeu_ps(&rgba[i + k][0], allTexels[k]);
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        glm::vec4 result(0.0f, 0.0f, 0.0f, 1.0f);
+
+        for (uint32_t channel = 0; channel < CHANNELS; channel++)
+        {
+            result[channel] = (float)texels[i * CHANNELS + channel] / 255.0f;
+        }
+
+        if (SWAP)
+        {
+            std::swap(result.r, result.b);
+        }
+
+        rgba[i] = result;
+    }
+}
+
+template<uint32_t CHANNELS, VkBool32 SWAP>
+static void imageDataWriteUNORM(uint8_t* texels, const glm::vec4* rgba, const uint32_t count)
+{
+    uint32_t i = 0;
+
+#ifdef VKTS_IMAGE_DATA_SSE2
+    if (CHANNELS == 4)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 scale = _mm_set1_ps(255.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i allTexels[4];
+
+            for (uint32_t k = 0; k < 4; k++)
+            {
+                __m128 value = _mm_loadu_ps(&rgba[i + k][0]);
+
+                if (SWAP)
+                {
+                    value = _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 0, 1, 2));
+                }
+
+                // Maximum first, as it returns zero for NaN.
+                value = _mm_min_ps(_mm_max_ps(value, zero), one);
+
+                // Truncated, as in the scalar path.
+                allTexels[k] = _mm_cvttps_epi32(_mm_mul_ps(value, scale));
+            }
+
+            __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(allTexels[0], allTexels[1]), _mm_packs_epi32(allTexels[2], allTexels[3]));
+
+            _mm_storeu_si128((__m128i*)&texels[i * 4], bytes);
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        for (uint32_t channel = 0; channel < CHANNELS; channel++)
+        {
+            uint32_t sourceChannel = channel;
+
+            if (SWAP && (channel == 0 || channel == 2))
+            {
+                sourceChannel = 2 - channel;
+            }
+
+            texels[i * CHANNELS + channel] = (uint8_t)(imageDataSaturate(rgba[i][sourceChannel]) * 255.0f);
+        }
+    }
+}
+
+template<uint32_t CHANNELS>
+static void imageDataReadSFLOAT(glm::vec4* rgba, const uint8_t* texels, const uint32_t count)
+{
+    if (CHANNELS == 4)
+    {
+        memcpy(rgba, texels, (size_t)count * sizeof(glm::vec4));
+
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        glm::vec4 result(0.0f, 0.0f, 0.0f, 1.0f);
+
+        memcpy(&result[0], &texels[i * CHANNELS * sizeof(float)], CHANNELS * sizeof(float));
+
+        rgba[i] = result;
+    }
+}
+
+template<uint32_t CHANNELS>
+static void imageDataWriteSFLOAT(uint8_t* texels, const glm::vec4* rgba, const uint32_t count)
+{
+    if (CHANNELS == 4)
+    {
+        memcpy(texels, rgba, (size_t)count * sizeof(glm::vec4));
+
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        memcpy(&texels[i * CHANNELS * sizeof(float)], &rgba[i][0], CHANNELS * sizeof(float));
+    }
+}
+
+static void imageDataReadNone(glm::vec4* rgba, const uint8_t* texels, const uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        rgba[i] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+}
+
+static void imageDataWriteNone(uint8_t* texels, const glm::vec4* rgba, const uint32_t count)
+{
+}
+
+ImageDataReadTexelsFunction VKTS_APIENTRY imageDataGetReadTexelsFunction(const VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_R8_UNORM:
+        case VK_FORMAT_R8_SRGB:
+            return imageDataReadUNORM<1, VK_FALSE>;
+        case VK_FORMAT_R8G8_UNORM:
+        case VK_FORMAT_R8G8_SRGB:
+            return imageDataReadUNORM<2, VK_FALSE>;
+        case VK_FORMAT_R8G8B8_UNORM:
+        case VK_FORMAT_R8G8B8_SRGB:
+            return imageDataReadUNORM<3, VK_FALSE>;
+        case VK_FORMAT_B8G8R8_UNORM:
+        case VK_FORMAT_B8G8R8_SRGB:
+            return imageDataReadUNORM<3, VK_TRUE>;
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            return imageDataReadUNORM<4, VK_FALSE>;
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            return imageDataReadUNORM<4, VK_TRUE>;
+        case VK_FORMAT_R32_SFLOAT:
+            return imageDataReadSFLOAT<1>;
+        case VK_FORMAT_R32G32_SFLOAT:
+            return imageDataReadSFLOAT<2>;
+        case VK_FORMAT_R32G32B32_SFLOAT:
+            return imageDataReadSFLOAT<3>;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return imageDataReadSFLOAT<4>;
+        default:
+            return imageDataReadNone;
+    }
+
+    return imageDataReadNone;
+}
+
+ImageDataWriteTexelsFunction VKTS_APIENTRY imageDataGetWriteTexelsFunction(const VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_R8_UNORM:
+        case VK_FORMAT_R8_SRGB:
+            return imageDataWriteUNORM<1, VK_FALSE>;
+        case VK_FORMAT_R8G8_UNORM:
+        case VK_FORMAT_R8G8_SRGB:
+            return imageDataWriteUNORM<2, VK_FALSE>;
+        case VK_FORMAT_R8G8B8_UNORM:
+        case VK_FORMAT_R8G8B8_SRGB:
+            return imageDataWriteUNORM<3, VK_FALSE>;
+        case VK_FORMAT_B8G8R8_UNORM:
+        case VK_FORMAT_B8G8R8_SRGB:
+            return imageDataWriteUNORM<3, VK_TRUE>;
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            return imageDataWriteUNORM<4, VK_FALSE>;
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            return imageDataWriteUNORM<4, VK_TRUE>;
+        case VK_FORMAT_R32_SFLOAT:
+            return imageDataWriteSFLOAT<1>;
+        case VK_FORMAT_R32G32_SFLOAT:
+            return imageDataWriteSFLOAT<2>;
+        case VK_FORMAT_R32G32B32_SFLOAT:
+            return imageDataWriteSFLOAT<3>;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return imageDataWriteSFLOAT<4>;
+        default:
+            return imageDataWriteNone;
+    }
+
+    return imageDataWriteNone;
+}
+
+}
@@ -0,0 +1,208 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Barrier.hpp"
+
+namespace vkts
+{
+
+void Barrier::release(const int32_t threadIndex)
+{
+    // Timing of this generation. All arrival times are visible, as every thread did decrement the counter.
+
+    double firstArrivalTime = -1.0;
+
+    for (int32_t i = 0; i < threadCount; i++)
+    {
+        double currentArrivalTime = allArrivalTimes[i].load(std::memory_order_relaxed);
+
+        if (currentArrivalTime >= 0.0 && (firstArrivalTime < 0.0 || currentArrivalTime < firstArrivalTime))
+        {
+            firstArrivalTime = currentArrivalTime;
+        }
+    }
+
+    for (int32_t i = 0; i < threadCount; i++)
+    {
+        double currentArrivalTime = allArrivalTimes[i].load(std::memory_order_relaxed);
+
+        allArrivalSkews[i].store(currentArrivalTime >= 0.0 ? currentArrivalTime - firstArrivalTime : 0.0, std::memory_order_relaxed);
+
+        allArrivalTimes[i].store(-1.0, std::memory_order_relaxed);
+    }
+
+    lastArrivedThreadIndex.store(threadIndex, std::memory_order_relaxed);
+
+    generation++;
+
+    // Reset for the next generation before releasing the others.
+
+    arrivingCount.store(threadCount);
+
+    sense.store(!sense.load());
+
+    // Has to be sequentially consistent with the parking in sync().
+    if (parkedCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> parkLockGuard(parkMutex);
+
+        parkConditionVariable.notify_all();
+    }
+}
+
+Barrier::Barrier(const int32_t threadCount, const uint32_t spinCount) :
+    IBarrier(), threadCount(threadCount), spinCount(spinCount), arrivingCount(threadCount), sense(VK_FALSE), killed(VK_FALSE), generation(0), parkedCount(0), parkMutex(), parkConditionVariable(), allArrivalTimes(new std::atomic<double>[threadCount]), allArrivalSkews(new std::atomic<double>[threadCount]), allWaitTimes(new std::atomic<double>[threadCount]), lastArrivedThreadIndex(-1)
+{
+    for (int32_t i = 0; i < threadCount; i++)
+    {
+        allArrivalTimes[i] = -1.0;
+        allArrivalSkews[i] = 0.0;
+        allWaitTimes[i] = 0.0;
+    }
+}
+
+Barrier::~Barrier()
+{
+}
+
+//
+// IBarrier
+//
+
+VkBool32 Barrier::sync(const int32_t threadIndex)
+{
+    if (killed.load())
+    {
+        return VK_FALSE;
+    }
+
+    VkBool32 validThreadIndex = threadIndex >= 0 && threadIndex < threadCount;
+
+    double arrivalTime = timeGetRaw();
+
+    if (validThreadIndex)
+    {
+        allArrivalTimes[threadIndex].store(arrivalTime, std::memory_order_relaxed);
+    }
+
+    // Sense can only flip after this thread did arrive, so it is safe to read it before.
+    VkBool32 currentSense = sense.load();
+
+    if (arrivingCount.fetch_sub(1) == 1)
+    {
+        release(threadIndex);
+
+        if (validThreadIndex)
+        {
+            allWaitTimes[threadIndex].store(0.0, std::memory_order_relaxed);
+        }
+
+        return !killed.load();
+    }
+
+    // Spin, as the other threads usually arrive soon.
+
+    for (uint32_t i = 0; i < spinCount; i++)
+    {
+        if (sense.load() != currentSense || killed.load())
+        {
+            break;
+        }
+
+        std::this_thread::yield();
+    }
+
+    // Park, if still not released.
+
+    if (sense.load() == currentSense && !killed.load())
+    {
+        std::unique_lock<std::mutex> parkUniqueLock(parkMutex);
+
+        parkedCount++;
+
+        parkConditionVariable.wait(parkUniqueLock, [this, currentSense] {return sense.load() != currentSense || killed.load();});
+
+        parkedCount--;
+    }
+
+    if (validThreadIndex)
+    {
+        allWaitTimes[threadIndex].store(timeGetRaw() - arrivalTime, std::memory_order_relaxed);
+    }
+
+    return !killed.load();
+}
+
+void Barrier::kill()
+{
+    killed = VK_TRUE;
+
+    std::lock_guard<std::mutex> parkLockGuard(parkMutex);
+
+    parkConditionVariable.notify_all();
+}
+
+VkBool32 Barrier::isKilled() const
+{
+    return killed.load();
+}
+
+int32_t Barrier::getThreadCount() const
+{
+    return threadCount;
+}
+
+uint64_t Barrier::getGeneration() const
+{
+    return generation.load();
+}
+
+int32_t Barrier::getLastArrivedThreadIndex() const
+{
+    return lastArrivedThreadIndex.load(std::memory_order_relaxed);
+}
+
+double Barrier::getArrivalSkew(const int32_t threadIndex) const
+{
+    if (threadIndex < 0 || threadIndex >= threadCount)
+    {
+        return 0.0;
+    }
+
+    return allArrivalSkews[threadIndex].load(std::memory_order_relaxed);
+}
+
+double Barrier::getWaitTime(const int32_t threadIndex) const
+{
+    if (threadIndex < 0 || threadIndex >= threadCount)
+    {
+        return 0.0;
+    }
+
+    return allWaitTimes[threadIndex].load(std::memory_order_relaxed);
+}
+
+} /* namespace vkts */
@@ -0,0 +1,109 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_BARRIER_HPP_
+#define VKTS_BARRIER_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Centralized sense reversing barrier.
+ *
+ * The last arriving thread resets the counter and flips the sense, which releases all others.
+ * Waiting threads spin for a short time before they park on a condition variable.
+ */
+class Barrier: public IBarrier
+{
+
+private:
+
+    const int32_t threadCount;
+
+    const uint32_t spinCount;
+
+    std::atomic<int32_t> arrivingCount;
+
+    std::atomic<VkBool32> sense;
+
+    std::atomic<VkBool32> killed;
+
+    std::atomic<uint64_t> generation;
+
+    std::atomic<int32_t> parkedCount;
+
+    std::mutex parkMutex;
+
+    std::condition_variable parkConditionVariable;
+
+    std::unique_ptr<std::atomic<double>[]> allArrivalTimes;
+
+    std::unique_ptr<std::atomic<double>[]> allArrivalSkews;
+
+    std::unique_ptr<std::atomic<double>[]> allWaitTimes;
+
+    std::atomic<int32_t> lastArrivedThreadIndex;
+
+    void release(const int32_t threadIndex);
+
+public:
+
+    Barrier() = delete;
+    Barrier(const Barrier& other) = delete;
+    Barrier(Barrier&& other) = delete;
+    Barrier(const int32_t threadCount, const uint32_t spinCount);
+    virtual ~Barrier();
+
+    Barrier& operator =(const Barrier& other) = delete;
+    Barrier& operator =(Barrier && other) = delete;
+
+    //
+    // IBarrier
+    //
+
+    virtual VkBool32 sync(const int32_t threadIndex = -1) override;
+
+    virtual void kill() override;
+
+    virtual VkBool32 isKilled() const override;
+
+    virtual int32_t getThreadCount() const override;
+
+    virtual uint64_t getGeneration() const override;
+
+    virtual int32_t getLastArrivedThreadIndex() const override;
+
+    virtual double getArrivalSkew(const int32_t threadIndex) const override;
+
+    virtual double getWaitTime(const int32_t threadIndex) const override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_BARRIER_HPP_ */
@@ -26,99 +26,91 @@
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
+#include "Barrier.hpp"
+#include "fn_barrier_internal.hpp"
+
 namespace vkts
 {
 
-static std::mutex g_barrierMutex;
-
-static std::condition_variable g_barrierConditionVariable;
+static IBarrierSP g_barrier;
 
-static int32_t g_barrierExecutingUpdateThreads = 0;
+static thread_local int32_t g_barrierThreadIndex = -1;
 
-static int32_t g_barrierGeneration = 0;
+void VKTS_APIENTRY _barrierSetThreadIndex(const int32_t threadIndex)
+{
+    g_barrierThreadIndex = threadIndex;
+}
 
 VkBool32 VKTS_APIENTRY barrierInit()
 {
-	std::lock_guard<std::mutex> barrierLockGuard(g_barrierMutex);
+    IBarrierSP barrier;
+
+    // Before the update threads are added, there is nothing to synchronize.
+    if (engineGetNumberUpdateThreads() >= VKTS_MIN_UPDATE_THREADS)
+    {
+        barrier = barrierCreate(engineGetNumberUpdateThreads());
 
-    g_barrierExecutingUpdateThreads = 0;
+        if (!barrier.get())
+        {
+            return VK_FALSE;
+        }
+    }
 
-    g_barrierGeneration = 0;
+    std::atomic_store(&g_barrier, barrier);
 
     return VK_TRUE;
 }
 
-VkBool32 VKTS_APIENTRY barrierSync()
+IBarrierSP VKTS_APIENTRY barrierCreate(const int32_t threadCount, const uint32_t spinCount)
 {
-    std::unique_lock<std::mutex> barrierUniqueLock(g_barrierMutex);
-
-    if (g_barrierGeneration < 0)
+    if (threadCount < 1)
     {
-        return VK_FALSE;
+        return IBarrierSP();
     }
 
-    // If there is no executing thread, start new barrier ...
-    if (g_barrierExecutingUpdateThreads == 0)
-    {
-        // ... by setting the total number of threads.
-        g_barrierExecutingUpdateThreads = engineGetNumberUpdateThreads();
+    auto newInstance = new Barrier(threadCount, spinCount);
 
-        // Error case, so just return.
-        if (g_barrierExecutingUpdateThreads < VKTS_MIN_UPDATE_THREADS)
-        {
-            return VK_FALSE;
-        }
+    if (!newInstance)
+    {
+        return IBarrierSP();
     }
 
-    // Remove this executing thread.
-    g_barrierExecutingUpdateThreads--;
-
-    // Are there any executing threads?
-    if (g_barrierExecutingUpdateThreads > 0)
-    {
-        int32_t currentBarrierGeneration = g_barrierGeneration;
+    return IBarrierSP(newInstance);
+}
 
-        // Yes, so wait until all have reached the barrier.
-        do
-        {
-            g_barrierConditionVariable.wait(barrierUniqueLock);
-        }
-        while (currentBarrierGeneration == g_barrierGeneration);
-    }
-    else
-    {
-        // No, so all have reached the barrier.
+IBarrierSP VKTS_APIENTRY barrierGet()
+{
+    return std::atomic_load(&g_barrier);
+}
 
-        // Initiate next barrier generation. This allows the other threads to proceed.
-        g_barrierGeneration++;
-        if (g_barrierGeneration < 0)
-        {
-            g_barrierGeneration = 0;
-        }
+VkBool32 VKTS_APIENTRY barrierSync()
+{
+    VKTS_PROFILE_ZONE("barrierSync");
 
-        // Wake up the rest.
-        g_barrierConditionVariable.notify_all();
+    auto barrier = std::atomic_load(&g_barrier);
 
-        return VK_TRUE;
+    // Error case, so just return.
+    if (!barrier.get())
+    {
+        return VK_FALSE;
     }
 
-    return VK_TRUE;
+    return barrier->sync(g_barrierThreadIndex);
 }
 
 void VKTS_APIENTRY barrierKill()
 {
-    std::lock_guard<std::mutex> barrierLockGuard(g_barrierMutex);
+    auto barrier = std::atomic_load(&g_barrier);
 
-    g_barrierExecutingUpdateThreads = 0;
-
-    g_barrierGeneration = -1;
-
-    g_barrierConditionVariable.notify_all();
+    if (barrier.get())
+    {
+        barrier->kill();
+    }
 }
 
 void VKTS_APIENTRY barrierTerminate()
 {
-    // Nothing for now.
+    std::atomic_store(&g_barrier, IBarrierSP());
 }
 
 }
@@ -0,0 +1,185 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "FramePacer.hpp"
+
+namespace vkts
+{
+
+static std::atomic<double> g_vsyncPresentTime(0.0);
+
+static std::atomic<double> g_vsyncRefreshInterval(0.0);
+
+void FramePacer::setVsyncTiming(const double presentTime, const double refreshInterval)
+{
+    g_vsyncPresentTime.store(presentTime, std::memory_order_relaxed);
+
+    g_vsyncRefreshInterval.store(refreshInterval, std::memory_order_relaxed);
+}
+
+double FramePacer::alignToVsync(const double deadline) const
+{
+    double refreshInterval = g_vsyncRefreshInterval.load(std::memory_order_relaxed);
+
+    if (refreshInterval <= 0.0)
+    {
+        // No timing from the swapchain yet, so behave like fixed rate.
+        return deadline;
+    }
+
+    double presentTime = g_vsyncPresentTime.load(std::memory_order_relaxed);
+
+    // Snap to the nearest vertical blank, but never before the frame started.
+
+    double alignedDeadline = presentTime + glm::round((deadline - presentTime) / refreshInterval) * refreshInterval;
+
+    while (alignedDeadline <= frameStartTime)
+    {
+        alignedDeadline += refreshInterval;
+    }
+
+    return alignedDeadline;
+}
+
+void FramePacer::adapt(const double workTime)
+{
+    averageWorkTime = glm::mix(averageWorkTime, workTime, 0.1);
+
+    // Too slow, so drop to the next lower rate e.g. from 60 to 30 frames per second.
+
+    if (workTime > frameTime)
+    {
+        fastFrames = 0;
+
+        frameTime = glm::min(frameTime + baseFrameTime, baseFrameTime * VKTS_FRAME_PACING_MAX_FRAME_MULTIPLIER);
+
+        return;
+    }
+
+    // Enough headroom for a while, so try the next higher rate.
+
+    if (frameTime > baseFrameTime && averageWorkTime < (frameTime - baseFrameTime) * VKTS_FRAME_PACING_HEADROOM)
+    {
+        fastFrames++;
+
+        if (fastFrames >= VKTS_FRAME_PACING_ADAPT_FRAMES)
+        {
+            fastFrames = 0;
+
+            frameTime -= baseFrameTime;
+        }
+    }
+    else
+    {
+        fastFrames = 0;
+    }
+}
+
+void FramePacer::sleepUntil(const double deadline)
+{
+    // Sleeping is coarse, so the last part is spent yielding.
+
+    double remainingTime = deadline - timeGetRaw();
+
+    if (remainingTime > VKTS_FRAME_PACING_SPIN_TIME)
+    {
+        std::this_thread::sleep_for(std::chrono::duration<double>(remainingTime - VKTS_FRAME_PACING_SPIN_TIME));
+    }
+
+    while (timeGetRaw() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+FramePacer::FramePacer(const VkTsFramePacing framePacing, const double frameTime) :
+    framePacing(framePacing), baseFrameTime(frameTime), frameTime(frameTime), frameStartTime(timeGetRaw()), averageWorkTime(0.0), fastFrames(0), missedFrames(0)
+{
+}
+
+FramePacer::~FramePacer()
+{
+}
+
+VkBool32 FramePacer::wait()
+{
+    if (framePacing == VKTS_FRAME_PACING_NONE)
+    {
+        std::this_thread::yield();
+
+        return VK_TRUE;
+    }
+
+    double currentTime = timeGetRaw();
+
+    if (framePacing == VKTS_FRAME_PACING_ADAPTIVE)
+    {
+        adapt(currentTime - frameStartTime);
+    }
+
+    double deadline = frameStartTime + frameTime;
+
+    if (framePacing == VKTS_FRAME_PACING_VSYNC || framePacing == VKTS_FRAME_PACING_ADAPTIVE)
+    {
+        deadline = alignToVsync(deadline);
+    }
+
+    if (currentTime > deadline)
+    {
+        missedFrames++;
+
+        logPrint(VKTS_LOG_DEBUG, __FILE__, __LINE__, "Missed frame deadline by %f seconds.", currentTime - deadline);
+
+        // Do not try to catch up, as this would cause a burst of frames.
+        frameStartTime = currentTime;
+
+        return VK_FALSE;
+    }
+
+    sleepUntil(deadline);
+
+    // Next frame starts at the deadline, so the rate does not drift.
+    frameStartTime = deadline;
+
+    return VK_TRUE;
+}
+
+VkTsFramePacing FramePacer::getFramePacing() const
+{
+    return framePacing;
+}
+
+double FramePacer::getFrameTime() const
+{
+    return frameTime;
+}
+
+uint64_t FramePacer::getMissedFrames() const
+{
+    return missedFrames;
+}
+
+} /* namespace vkts */
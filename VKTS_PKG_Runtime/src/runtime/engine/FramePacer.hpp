@@ -0,0 +1,98 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FRAMEPACER_HPP_
+#define VKTS_FRAMEPACER_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+namespace vkts
+{
+
+/**
+ * Waits until the deadline of the next frame of one update thread.
+ *
+ * Not thread Safe.
+ */
+class FramePacer
+{
+
+private:
+
+    const VkTsFramePacing framePacing;
+
+    const double baseFrameTime;
+
+    double frameTime;
+
+    double frameStartTime;
+
+    double averageWorkTime;
+
+    uint32_t fastFrames;
+
+    uint64_t missedFrames;
+
+    double alignToVsync(const double deadline) const;
+
+    void adapt(const double workTime);
+
+    static void sleepUntil(const double deadline);
+
+public:
+
+    /**
+     * @ThreadSafe
+     *
+     * Time of the last present and the refresh interval of the display, both in seconds of timeGetRaw().
+     */
+    static void setVsyncTiming(const double presentTime, const double refreshInterval);
+
+    FramePacer() = delete;
+    FramePacer(const FramePacer& other) = delete;
+    FramePacer(FramePacer&& other) = delete;
+    FramePacer(const VkTsFramePacing framePacing, const double frameTime);
+    ~FramePacer();
+
+    FramePacer& operator =(const FramePacer& other) = delete;
+    FramePacer& operator =(FramePacer && other) = delete;
+
+    /**
+     * Waits until the next deadline. Returns VK_FALSE, if the deadline was already missed.
+     */
+    VkBool32 wait();
+
+    VkTsFramePacing getFramePacing() const;
+
+    double getFrameTime() const;
+
+    uint64_t getMissedFrames() const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_FRAMEPACER_HPP_ */
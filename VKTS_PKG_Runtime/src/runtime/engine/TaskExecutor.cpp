@@ -25,12 +25,13 @@
  */
 
 #include "TaskExecutor.hpp"
+#include "TaskGraph.hpp"
 
 namespace vkts
 {
 
-TaskExecutor::TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue) :
-    index(index), sync(sync), sendTaskQueue(sendTaskQueue), executedTaskQueue(executedTaskQueue)
+TaskExecutor::TaskExecutor(const int32_t index, ExecutorSync& sync, const TaskSchedulerSP& sendTaskScheduler, const TaskQueueSP& executedTaskQueue) :
+    index(index), sync(sync), sendTaskScheduler(sendTaskScheduler), executedTaskQueue(executedTaskQueue)
 {
 }
 
@@ -47,13 +48,19 @@ void TaskExecutor::run() const
 {
     logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "TaskExecutor %d started.", index);
 
+    sendTaskScheduler->bindExecutor(index);
+
     ITaskSP task;
 
+    TaskGraphSP taskGraph;
+    uint32_t taskGraphIndex = 0;
+
     auto doRun = VK_TRUE;
 
     while (doRun && sync.doAllRun())
     {
-        doRun = sendTaskQueue->receiveTask(task);
+        // Blocks and parks this thread, until a task is available.
+        doRun = sendTaskScheduler->receiveTask(task, taskGraph, taskGraphIndex);
 
         if (!task.get())
         {
@@ -62,21 +69,31 @@ void TaskExecutor::run() const
 
         if (doRun && task.get())
         {
-            doRun = task->run();
-
-            doRun = doRun && executedTaskQueue->addTask(task);
+            VKTS_PROFILE_ZONE("TaskExecutor::run");
+
+            if (taskGraph.get())
+            {
+                // A failing task of a graph does only stop the graph.
+                taskGraph->execute(taskGraphIndex);
+            }
+            else
+            {
+                doRun = task->run();
+
+                // Never blocks, as a stalled update thread would otherwise park this executor for ever.
+                doRun = doRun && executedTaskQueue->addTaskOrAllocate(task);
+            }
         }
 
         if (doRun)
         {
             task = ITaskSP();
+            taskGraph = TaskGraphSP();
         }
         else
         {
             sync.setDoAllRunFalse();
         }
-
-        std::this_thread::yield();
     }
 
     logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "TaskExecutor %d terminated.", index);
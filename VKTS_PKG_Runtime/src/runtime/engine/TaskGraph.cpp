@@ -0,0 +1,308 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskGraph.hpp"
+
+namespace vkts
+{
+
+VkBool32 TaskGraph::validate()
+{
+    if (validated)
+    {
+        return VK_TRUE;
+    }
+
+    uint32_t taskCount = allTasks.size();
+
+    // Check for cycles by sorting the graph topologically.
+
+    std::vector<uint32_t> currentPredecessorCounts(allPredecessorCounts);
+
+    std::vector<uint32_t> readyTasks;
+
+    for (uint32_t i = 0; i < taskCount; i++)
+    {
+        if (currentPredecessorCounts[i] == 0)
+        {
+            readyTasks.push_back(i);
+        }
+    }
+
+    uint32_t sortedCount = 0;
+
+    while (readyTasks.size() > 0)
+    {
+        uint32_t currentTask = readyTasks.back();
+        readyTasks.pop_back();
+
+        sortedCount++;
+
+        for (uint32_t successor : allSuccessors[currentTask])
+        {
+            currentPredecessorCounts[successor]--;
+
+            if (currentPredecessorCounts[successor] == 0)
+            {
+                readyTasks.push_back(successor);
+            }
+        }
+    }
+
+    if (sortedCount != taskCount)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Task graph has a cycle.");
+
+        return VK_FALSE;
+    }
+
+    // Only reallocate, if the number of tasks did change.
+
+    if (allPendingCountsSize != taskCount)
+    {
+        allPendingCounts = std::unique_ptr<std::atomic<uint32_t>[]>(new std::atomic<uint32_t>[taskCount]);
+
+        allPendingCountsSize = taskCount;
+    }
+
+    validated = VK_TRUE;
+
+    return VK_TRUE;
+}
+
+void TaskGraph::finish()
+{
+    ITaskSP currentContinuation = continuation;
+
+    TaskScheduler* currentTaskScheduler = taskScheduler;
+
+    {
+        std::lock_guard<std::mutex> finishedLockGuard(finishedMutex);
+
+        executing = VK_FALSE;
+
+        finishedConditionVariable.notify_all();
+    }
+
+    if (currentContinuation.get() && currentTaskScheduler)
+    {
+        currentTaskScheduler->addTask(currentContinuation);
+    }
+}
+
+TaskGraph::TaskGraph() :
+    ITaskGraph(), allTasks(), allSuccessors(), allPredecessorCounts(), allPendingCounts(), allPendingCountsSize(0), validated(VK_TRUE), continuation(), taskScheduler(nullptr), remainingCount(0), failed(VK_FALSE), executing(VK_FALSE), finishedMutex(), finishedConditionVariable()
+{
+}
+
+TaskGraph::~TaskGraph()
+{
+}
+
+VkBool32 TaskGraph::submit(TaskScheduler& taskScheduler)
+{
+    if (executing.exchange(VK_TRUE))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Task graph is still executing.");
+
+        return VK_FALSE;
+    }
+
+    if (!validate())
+    {
+        executing = VK_FALSE;
+
+        return VK_FALSE;
+    }
+
+    this->taskScheduler = &taskScheduler;
+
+    failed = VK_FALSE;
+
+    uint32_t taskCount = allTasks.size();
+
+    if (taskCount == 0)
+    {
+        finish();
+
+        return VK_TRUE;
+    }
+
+    remainingCount = taskCount;
+
+    for (uint32_t i = 0; i < taskCount; i++)
+    {
+        allPendingCounts[i].store(allPredecessorCounts[i], std::memory_order_relaxed);
+    }
+
+    auto taskGraph = shared_from_this();
+
+    for (uint32_t i = 0; i < taskCount; i++)
+    {
+        if (allPredecessorCounts[i] == 0)
+        {
+            taskScheduler.addTaskGraphTask(taskGraph, i);
+        }
+    }
+
+    return VK_TRUE;
+}
+
+void TaskGraph::release(const uint32_t index)
+{
+    // Successors are added to the deque of this thread, as they most likely use the same data.
+
+    for (uint32_t successor : allSuccessors[index])
+    {
+        if (allPendingCounts[successor].fetch_sub(1) == 1)
+        {
+            taskScheduler->addTaskGraphTask(shared_from_this(), successor);
+        }
+    }
+
+    if (remainingCount.fetch_sub(1) == 1)
+    {
+        finish();
+    }
+}
+
+void TaskGraph::execute(const uint32_t index)
+{
+    if (!failed)
+    {
+        if (!allTasks[index]->run())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Task graph task %u failed.", index);
+
+            failed = VK_TRUE;
+        }
+    }
+
+    release(index);
+}
+
+void TaskGraph::cancel(const uint32_t index)
+{
+    failed = VK_TRUE;
+
+    release(index);
+}
+
+//
+// ITaskGraph
+//
+
+int32_t TaskGraph::addTask(const ITaskSP& task)
+{
+    if (executing || !task.get())
+    {
+        return -1;
+    }
+
+    allTasks.append(task);
+    allSuccessors.push_back(std::vector<uint32_t>());
+    allPredecessorCounts.push_back(0);
+
+    validated = VK_FALSE;
+
+    return (int32_t)allTasks.size() - 1;
+}
+
+VkBool32 TaskGraph::addDependency(const int32_t beforeIndex, const int32_t afterIndex)
+{
+    if (executing)
+    {
+        return VK_FALSE;
+    }
+
+    if (beforeIndex < 0 || afterIndex < 0 || beforeIndex == afterIndex || beforeIndex >= (int32_t)allTasks.size() || afterIndex >= (int32_t)allTasks.size())
+    {
+        return VK_FALSE;
+    }
+
+    allSuccessors[beforeIndex].push_back((uint32_t)afterIndex);
+    allPredecessorCounts[afterIndex]++;
+
+    validated = VK_FALSE;
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskGraph::setContinuation(const ITaskSP& continuation)
+{
+    if (executing)
+    {
+        return VK_FALSE;
+    }
+
+    this->continuation = continuation;
+
+    return VK_TRUE;
+}
+
+uint32_t TaskGraph::getNumberTasks() const
+{
+    return allTasks.size();
+}
+
+const ITaskSP& TaskGraph::getTask(const uint32_t index) const
+{
+    return allTasks[index];
+}
+
+VkBool32 TaskGraph::clear()
+{
+    if (executing)
+    {
+        return VK_FALSE;
+    }
+
+    allTasks.clear();
+    allSuccessors.clear();
+    allPredecessorCounts.clear();
+
+    continuation = ITaskSP();
+
+    validated = VK_FALSE;
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskGraph::isFinished() const
+{
+    return !executing;
+}
+
+VkBool32 TaskGraph::wait() const
+{
+    std::unique_lock<std::mutex> finishedUniqueLock(finishedMutex);
+
+    finishedConditionVariable.wait(finishedUniqueLock, [this] {return !executing;});
+
+    return !failed;
+}
+
+} /* namespace vkts */
@@ -0,0 +1,125 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKGRAPH_HPP_
+#define VKTS_TASKGRAPH_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#include "TaskScheduler.hpp"
+
+namespace vkts
+{
+
+class TaskGraph: public ITaskGraph, public std::enable_shared_from_this<TaskGraph>
+{
+
+private:
+
+    SmartPointerVector<ITaskSP> allTasks;
+
+    std::vector<std::vector<uint32_t> > allSuccessors;
+
+    std::vector<uint32_t> allPredecessorCounts;
+
+    std::unique_ptr<std::atomic<uint32_t>[]> allPendingCounts;
+
+    uint32_t allPendingCountsSize;
+
+    VkBool32 validated;
+
+    ITaskSP continuation;
+
+    TaskScheduler* taskScheduler;
+
+    std::atomic<uint32_t> remainingCount;
+
+    std::atomic<VkBool32> failed;
+
+    std::atomic<VkBool32> executing;
+
+    mutable std::mutex finishedMutex;
+
+    mutable std::condition_variable finishedConditionVariable;
+
+    VkBool32 validate();
+
+    void finish();
+
+    void release(const uint32_t index);
+
+public:
+
+    TaskGraph();
+    TaskGraph(const TaskGraph& other) = delete;
+    TaskGraph(TaskGraph&& other) = delete;
+    virtual ~TaskGraph();
+
+    TaskGraph& operator =(const TaskGraph& other) = delete;
+    TaskGraph& operator =(TaskGraph && other) = delete;
+
+    /**
+     * Resets all pending counts and adds the root tasks to the scheduler.
+     */
+    VkBool32 submit(TaskScheduler& taskScheduler);
+
+    /**
+     * Called by the task executor. Runs the task and adds the successors, which got ready.
+     */
+    void execute(const uint32_t index);
+
+    /**
+     * Called, if a task was removed from the scheduler without executing it. The graph fails.
+     */
+    void cancel(const uint32_t index);
+
+    //
+    // ITaskGraph
+    //
+
+    virtual int32_t addTask(const ITaskSP& task) override;
+
+    virtual VkBool32 addDependency(const int32_t beforeIndex, const int32_t afterIndex) override;
+
+    virtual VkBool32 setContinuation(const ITaskSP& continuation) override;
+
+    virtual uint32_t getNumberTasks() const override;
+
+    virtual const ITaskSP& getTask(const uint32_t index) const override;
+
+    virtual VkBool32 clear() override;
+
+    virtual VkBool32 isFinished() const override;
+
+    virtual VkBool32 wait() const override;
+
+};
+
+typedef std::shared_ptr<TaskGraph> TaskGraphSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKGRAPH_HPP_ */
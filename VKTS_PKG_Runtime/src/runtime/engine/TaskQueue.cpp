@@ -29,85 +29,37 @@
 namespace vkts
 {
 
-TaskQueueElement* TaskQueue::getTaskQueueElement()
+TaskQueue::TaskQueue() :
+    taskQueueElementPool(), queue()
 {
-	std::unique_lock<std::mutex> uniqueLock(mutex);
-
-	if (taskQueueElementCount == VKTS_MAX_TASK_QUEUE_ELEMENT)
-	{
-		conditionVariable.wait(uniqueLock, [this] {return taskQueueElementCount == VKTS_MAX_TASK_QUEUE_ELEMENT;});
-	}
-
-	for (uint64_t i = 0; i < VKTS_MAX_TASK_QUEUE_ELEMENT; i++)
-	{
-		if (taskQueueElementCacheUsed[i] == VK_FALSE)
-		{
-			taskQueueElementCacheUsed[i] = VK_TRUE;
-
-			taskQueueElementCache[i].used = timeGetRaw();
-
-			taskQueueElementCount++;
-
-	        return &taskQueueElementCache[i];
-		}
-	}
-
-	return nullptr;
 }
 
-void TaskQueue::recycleTaskQueueElement(TaskQueueElement* taskQueueElement)
-{
-    if (!taskQueueElement)
-    {
-        return;
-    }
-
-    std::lock_guard<std::mutex> lockGuard(mutex);
-
-    taskQueueElement->task = ITaskSP();
-
-    taskQueueElement->recycled = timeGetRaw();
-
-    taskQueueElementCacheUsed[taskQueueElement->index] = VK_FALSE;
-
-    taskQueueElementCount--;
-
-    conditionVariable.notify_all();
-}
-
-TaskQueue::TaskQueue() :
-    taskQueueElementCache(), taskQueueElementCacheUsed(), queue(), mutex(), conditionVariable(), taskQueueElementCount(0)
+TaskQueue::~TaskQueue()
 {
-	for (uint64_t i = 0; i < VKTS_MAX_TASK_QUEUE_ELEMENT; i++)
-	{
-		taskQueueElementCache[i].index = i;
-
-		taskQueueElementCacheUsed[i] = VK_FALSE;
-	}
+    reset();
 }
 
-TaskQueue::~TaskQueue()
+VkBool32 TaskQueue::addTask(const ITaskSP& task, const VkTsTaskWait wait, const double timeout)
 {
-    TaskQueueElement* taskQueueElement;
+    auto taskQueueElement = taskQueueElementPool.acquire(wait, timeout);
 
-    do
+    if (!taskQueueElement)
     {
-        taskQueueElement = nullptr;
+        return VK_FALSE;
+    }
 
-        queue.take(taskQueueElement);
+    taskQueueElement->task = task;
 
-        if (taskQueueElement)
-        {
-            recycleTaskQueueElement(taskQueueElement);
-        }
+    taskQueueElement->send = timeGetRaw();
 
-    }
-    while (taskQueueElement != nullptr);
+    queue.add(taskQueueElement);
+
+    return VK_TRUE;
 }
 
-VkBool32 TaskQueue::addTask(const ITaskSP& task)
+VkBool32 TaskQueue::addTaskOrAllocate(const ITaskSP& task)
 {
-    auto taskQueueElement = getTaskQueueElement();
+    auto taskQueueElement = taskQueueElementPool.acquireOrAllocate();
 
     if (!taskQueueElement)
     {
@@ -148,7 +100,7 @@ VkBool32 TaskQueue::receiveTask(ITaskSP& task, const VkBool32 wait)
 
     task = taskQueueElement->task;
 
-    recycleTaskQueueElement(taskQueueElement);
+    taskQueueElementPool.release(taskQueueElement);
 
     if (!task.get())
     {
@@ -162,10 +114,15 @@ void TaskQueue::reset()
 {
 	TaskQueueElement* taskQueueElement = nullptr;
 
-	while (!queue.empty())
+	while (queue.take(taskQueueElement))
 	{
-		queue.take(taskQueueElement);
+		taskQueueElementPool.release(taskQueueElement);
 	}
 }
 
+void TaskQueue::getLatency(VkTsTaskLatency& latency) const
+{
+    taskQueueElementPool.getLatency(latency);
+}
+
 } /* namespace vkts */
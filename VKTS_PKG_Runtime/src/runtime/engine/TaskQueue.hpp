@@ -29,61 +29,20 @@
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
-#define VKTS_MAX_TASK_QUEUE_ELEMENT 1000
+#include "TaskQueueElementPool.hpp"
 
 namespace vkts
 {
 
-class TaskQueueElement
-{
-
-public:
-
-	uint64_t index;
-
-    ITaskSP task;
-
-    double created;
-
-    double used;
-
-    double recycled;
-
-    double send;
-
-    double received;
-
-    TaskQueueElement() :
-        index(0), task(nullptr), created(0.0), used(-1.0), recycled(-1.0), send(-1.0f), received(-1.0f)
-    {
-    }
-
-    ~TaskQueueElement()
-    {
-    }
-
-};
-
 class TaskQueue
 {
 
 private:
 
-    TaskQueueElement taskQueueElementCache[VKTS_MAX_TASK_QUEUE_ELEMENT];
-    VkBool32 taskQueueElementCacheUsed[VKTS_MAX_TASK_QUEUE_ELEMENT];
+    TaskQueueElementPool taskQueueElementPool;
 
     ThreadsafeQueue<TaskQueueElement*> queue;
 
-    mutable std::mutex mutex;
-
-    std::condition_variable conditionVariable;
-
-    uint64_t taskQueueElementCount;
-
-    TaskQueueElement* getTaskQueueElement();
-
-    void recycleTaskQueueElement(TaskQueueElement* taskQueueElement);
-
 public:
 
     TaskQueue();
@@ -94,12 +53,19 @@ public:
     TaskQueue& operator =(const TaskQueue& other) = delete;
     TaskQueue& operator =(TaskQueue && other) = delete;
 
-    VkBool32 addTask(const ITaskSP& task);
+    VkBool32 addTask(const ITaskSP& task, const VkTsTaskWait wait = VKTS_TASK_WAIT_BLOCK, const double timeout = 0.0);
+
+    /**
+     * Never blocks. If the pool is exhausted, the element is allocated on the heap.
+     */
+    VkBool32 addTaskOrAllocate(const ITaskSP& task);
 
     VkBool32 receiveTask(ITaskSP& task, const VkBool32 wait = VK_TRUE);
 
     void reset();
 
+    void getLatency(VkTsTaskLatency& latency) const;
+
 };
 
 typedef std::shared_ptr<TaskQueue> TaskQueueSP;
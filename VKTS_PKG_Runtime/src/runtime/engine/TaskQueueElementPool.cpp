@@ -0,0 +1,248 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskQueueElementPool.hpp"
+
+#define VKTS_TASK_QUEUE_ELEMENT_NONE 0xFFFFFFFF
+
+namespace vkts
+{
+
+TaskQueueElement* TaskQueueElementPool::pop()
+{
+    uint64_t currentHead = head.load();
+
+    while (true)
+    {
+        uint32_t currentIndex = (uint32_t)(currentHead & 0xFFFFFFFF);
+
+        if (currentIndex == VKTS_TASK_QUEUE_ELEMENT_NONE)
+        {
+            return nullptr;
+        }
+
+        // Next index could be outdated, but then the tag does not match anymore.
+        uint64_t newHead = (((currentHead >> 32) + 1) << 32) | (uint64_t)allNextIndices[currentIndex].load(std::memory_order_relaxed);
+
+        if (head.compare_exchange_weak(currentHead, newHead))
+        {
+            return &allElements[currentIndex];
+        }
+    }
+}
+
+void TaskQueueElementPool::push(TaskQueueElement* taskQueueElement)
+{
+    uint32_t newIndex = (uint32_t)taskQueueElement->index;
+
+    uint64_t currentHead = head.load();
+
+    uint64_t newHead;
+
+    do
+    {
+        allNextIndices[newIndex].store((uint32_t)(currentHead & 0xFFFFFFFF), std::memory_order_relaxed);
+
+        newHead = (((currentHead >> 32) + 1) << 32) | (uint64_t)newIndex;
+    }
+    while (!head.compare_exchange_weak(currentHead, newHead));
+}
+
+VkBool32 TaskQueueElementPool::hasFree() const
+{
+    return (VkBool32)((uint32_t)(head.load() & 0xFFFFFFFF) != VKTS_TASK_QUEUE_ELEMENT_NONE);
+}
+
+void TaskQueueElementPool::recordLatency(const double latency)
+{
+    if (latency < 0.0)
+    {
+        return;
+    }
+
+    uint64_t nanoseconds = (uint64_t)(latency * 1000000000.0);
+
+    uint64_t microseconds = nanoseconds / 1000;
+
+    uint32_t bucket = 0;
+
+    while (microseconds > 0 && bucket < VKTS_TASK_LATENCY_BUCKETS - 1)
+    {
+        microseconds >>= 1;
+
+        bucket++;
+    }
+
+    latencyBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    latencyCount.fetch_add(1, std::memory_order_relaxed);
+    latencyTotal.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    uint64_t currentMaximum = latencyMaximum.load(std::memory_order_relaxed);
+
+    while (nanoseconds > currentMaximum && !latencyMaximum.compare_exchange_weak(currentMaximum, nanoseconds, std::memory_order_relaxed))
+    {
+        // Nothing, as currentMaximum is updated.
+    }
+}
+
+TaskQueueElementPool::TaskQueueElementPool() :
+    allElements(), head(0), waitingCount(0), waitMutex(), waitConditionVariable(), latencyCount(0), latencyTotal(0), latencyMaximum(0)
+{
+    for (uint32_t i = 0; i < VKTS_MAX_TASK_QUEUE_ELEMENT; i++)
+    {
+        allElements[i].index = i;
+
+        allNextIndices[i] = (i + 1 < VKTS_MAX_TASK_QUEUE_ELEMENT) ? i + 1 : VKTS_TASK_QUEUE_ELEMENT_NONE;
+    }
+
+    for (uint32_t i = 0; i < VKTS_TASK_LATENCY_BUCKETS; i++)
+    {
+        latencyBuckets[i] = 0;
+    }
+}
+
+TaskQueueElementPool::~TaskQueueElementPool()
+{
+}
+
+TaskQueueElement* TaskQueueElementPool::acquire(const VkTsTaskWait wait, const double timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds((int64_t)(glm::max(timeout, 0.0) * 1000000.0));
+
+    while (true)
+    {
+        TaskQueueElement* taskQueueElement = pop();
+
+        if (taskQueueElement)
+        {
+            taskQueueElement->used = timeGetRaw();
+
+            return taskQueueElement;
+        }
+
+        if (wait == VKTS_TASK_WAIT_TRY)
+        {
+            return nullptr;
+        }
+
+        // Pool is exhausted, so wait until an element is released.
+
+        std::unique_lock<std::mutex> waitUniqueLock(waitMutex);
+
+        waitingCount++;
+
+        if (wait == VKTS_TASK_WAIT_TIMEOUT)
+        {
+            if (!waitConditionVariable.wait_until(waitUniqueLock, deadline, [this] {return hasFree();}))
+            {
+                waitingCount--;
+
+                return nullptr;
+            }
+        }
+        else
+        {
+            waitConditionVariable.wait(waitUniqueLock, [this] {return hasFree();});
+        }
+
+        waitingCount--;
+    }
+}
+
+TaskQueueElement* TaskQueueElementPool::acquireOrAllocate()
+{
+    TaskQueueElement* taskQueueElement = acquire(VKTS_TASK_WAIT_TRY, 0.0);
+
+    if (taskQueueElement)
+    {
+        return taskQueueElement;
+    }
+
+    taskQueueElement = new TaskQueueElement();
+
+    if (!taskQueueElement)
+    {
+        return nullptr;
+    }
+
+    taskQueueElement->index = VKTS_TASK_QUEUE_ELEMENT_ALLOCATED;
+
+    taskQueueElement->used = timeGetRaw();
+
+    return taskQueueElement;
+}
+
+void TaskQueueElementPool::release(TaskQueueElement* taskQueueElement)
+{
+    if (!taskQueueElement)
+    {
+        return;
+    }
+
+    taskQueueElement->recycled = timeGetRaw();
+
+    if (taskQueueElement->received >= 0.0 && taskQueueElement->send >= 0.0)
+    {
+        recordLatency(taskQueueElement->received - taskQueueElement->send);
+    }
+
+    if (taskQueueElement->index == VKTS_TASK_QUEUE_ELEMENT_ALLOCATED)
+    {
+        delete taskQueueElement;
+
+        return;
+    }
+
+    taskQueueElement->task = ITaskSP();
+    taskQueueElement->taskGraph = std::shared_ptr<TaskGraph>();
+    taskQueueElement->send = -1.0;
+    taskQueueElement->received = -1.0;
+
+    push(taskQueueElement);
+
+    // Has to be sequentially consistent with the waiting in acquire().
+    if (waitingCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> waitLockGuard(waitMutex);
+
+        waitConditionVariable.notify_one();
+    }
+}
+
+void TaskQueueElementPool::getLatency(VkTsTaskLatency& latency) const
+{
+    latency.count = latencyCount.load(std::memory_order_relaxed);
+    latency.total = (double)latencyTotal.load(std::memory_order_relaxed) / 1000000000.0;
+    latency.maximum = (double)latencyMaximum.load(std::memory_order_relaxed) / 1000000000.0;
+
+    for (uint32_t i = 0; i < VKTS_TASK_LATENCY_BUCKETS; i++)
+    {
+        latency.buckets[i] = latencyBuckets[i].load(std::memory_order_relaxed);
+    }
+}
+
+} /* namespace vkts */
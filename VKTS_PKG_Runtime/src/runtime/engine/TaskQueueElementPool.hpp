@@ -0,0 +1,143 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKQUEUEELEMENTPOOL_HPP_
+#define VKTS_TASKQUEUEELEMENTPOOL_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#define VKTS_MAX_TASK_QUEUE_ELEMENT 1000
+
+#define VKTS_TASK_QUEUE_ELEMENT_ALLOCATED UINT64_MAX
+
+namespace vkts
+{
+
+class TaskGraph;
+
+class TaskQueueElement
+{
+
+public:
+
+	uint64_t index;
+
+    ITaskSP task;
+
+    std::shared_ptr<TaskGraph> taskGraph;
+
+    uint32_t taskGraphIndex;
+
+    double created;
+
+    double used;
+
+    double recycled;
+
+    double send;
+
+    double received;
+
+    TaskQueueElement() :
+        index(0), task(nullptr), taskGraph(nullptr), taskGraphIndex(0), created(0.0), used(-1.0), recycled(-1.0), send(-1.0f), received(-1.0f)
+    {
+    }
+
+    ~TaskQueueElement()
+    {
+    }
+
+};
+
+/**
+ * Fixed capacity pool of task queue elements.
+ *
+ * The free elements are kept in a lock-free stack, so acquire and release are O(1).
+ * The stack head contains a tag besides the index, to avoid the ABA problem.
+ * Only if the pool is exhausted, the acquiring thread is blocked depending on the wait mode.
+ */
+class TaskQueueElementPool
+{
+
+private:
+
+    TaskQueueElement allElements[VKTS_MAX_TASK_QUEUE_ELEMENT];
+
+    std::atomic<uint32_t> allNextIndices[VKTS_MAX_TASK_QUEUE_ELEMENT];
+
+    std::atomic<uint64_t> head;
+
+    std::atomic<int32_t> waitingCount;
+
+    std::mutex waitMutex;
+
+    std::condition_variable waitConditionVariable;
+
+    std::atomic<uint64_t> latencyCount;
+    std::atomic<uint64_t> latencyTotal;
+    std::atomic<uint64_t> latencyMaximum;
+    std::atomic<uint64_t> latencyBuckets[VKTS_TASK_LATENCY_BUCKETS];
+
+    TaskQueueElement* pop();
+
+    void push(TaskQueueElement* taskQueueElement);
+
+    VkBool32 hasFree() const;
+
+    void recordLatency(const double latency);
+
+public:
+
+    TaskQueueElementPool();
+    TaskQueueElementPool(const TaskQueueElementPool& other) = delete;
+    TaskQueueElementPool(TaskQueueElementPool&& other) = delete;
+    ~TaskQueueElementPool();
+
+    TaskQueueElementPool& operator =(const TaskQueueElementPool& other) = delete;
+    TaskQueueElementPool& operator =(TaskQueueElementPool && other) = delete;
+
+    /**
+     * Thread safe. Returns nullptr, if no element got free in the given wait mode.
+     */
+    TaskQueueElement* acquire(const VkTsTaskWait wait, const double timeout);
+
+    /**
+     * Thread safe. Never blocks. If the pool is exhausted, the element is allocated on the heap.
+     */
+    TaskQueueElement* acquireOrAllocate();
+
+    /**
+     * Thread safe. Records the latency between send and received.
+     */
+    void release(TaskQueueElement* taskQueueElement);
+
+    void getLatency(VkTsTaskLatency& latency) const;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKQUEUEELEMENTPOOL_HPP_ */
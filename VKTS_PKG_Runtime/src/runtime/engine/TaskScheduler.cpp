@@ -0,0 +1,373 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TaskScheduler.hpp"
+#include "TaskGraph.hpp"
+
+namespace vkts
+{
+
+static thread_local const TaskScheduler* g_boundTaskScheduler = nullptr;
+
+static thread_local int32_t g_boundTaskSlot = -1;
+
+int32_t TaskScheduler::getBoundSlot() const
+{
+    if (g_boundTaskScheduler != this)
+    {
+        return -1;
+    }
+
+    return g_boundTaskSlot;
+}
+
+void TaskScheduler::bindSlot(const int32_t slot) const
+{
+    if (slot < 0 || slot >= (int32_t)allDeques.size())
+    {
+        g_boundTaskScheduler = nullptr;
+        g_boundTaskSlot = -1;
+
+        return;
+    }
+
+    g_boundTaskScheduler = this;
+    g_boundTaskSlot = slot;
+}
+
+TaskQueueElement* TaskScheduler::acquireElement(const VkTsTaskWait wait, const double timeout)
+{
+    int32_t slot = getBoundSlot();
+
+    // Task executors never block, as they are the ones releasing the elements.
+    if (slot >= 0 && slot < executorCount)
+    {
+        return taskQueueElementPool.acquireOrAllocate();
+    }
+
+    return taskQueueElementPool.acquire(wait, timeout);
+}
+
+VkBool32 TaskScheduler::addElement(TaskQueueElement* taskQueueElement)
+{
+    taskQueueElement->send = timeGetRaw();
+
+    int32_t slot = getBoundSlot();
+
+    if (slot < 0 || !allDeques[slot]->push(taskQueueElement))
+    {
+        overflowQueue.add(taskQueueElement);
+
+        overflowCount++;
+    }
+
+    // Has to be sequentially consistent with the parking in receiveTask().
+    pendingCount++;
+
+    wakeUp();
+
+    return VK_TRUE;
+}
+
+VkBool32 TaskScheduler::takeElement(TaskQueueElement*& taskQueueElement, const int32_t slot, uint32_t& victim)
+{
+    // First, own deque in LIFO order, as the data is most likely still in the cache.
+
+    if (slot >= 0 && allDeques[slot]->pop(taskQueueElement))
+    {
+        return VK_TRUE;
+    }
+
+    // Second, tasks from threads without an own deque.
+
+    if (overflowCount.load(std::memory_order_acquire) > 0 && overflowQueue.take(taskQueueElement))
+    {
+        overflowCount--;
+
+        return VK_TRUE;
+    }
+
+    // Finally, steal in FIFO order from the others, starting at the last successful victim.
+
+    uint32_t dequeCount = (uint32_t)allDeques.size();
+
+    for (uint32_t i = 0; i < dequeCount; i++)
+    {
+        uint32_t currentVictim = (victim + i) % dequeCount;
+
+        if ((int32_t)currentVictim == slot)
+        {
+            continue;
+        }
+
+        if (allDeques[currentVictim]->steal(taskQueueElement))
+        {
+            victim = currentVictim;
+
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+void TaskScheduler::wakeUp()
+{
+    if (parkedCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> parkLockGuard(parkMutex);
+
+        parkConditionVariable.notify_one();
+    }
+}
+
+TaskScheduler::TaskScheduler(const int32_t executorCount, const int32_t updateThreadCount) :
+    executorCount(executorCount), updateThreadCount(updateThreadCount), allDeques(), taskQueueElementPool(), overflowQueue(), overflowCount(0), pendingCount(0), parkedCount(0), running(VK_TRUE), parkMutex(), parkConditionVariable()
+{
+    for (int32_t i = 0; i < executorCount + updateThreadCount; i++)
+    {
+        allDeques.push_back(TaskDequeSP(new WorkStealingDeque<TaskQueueElement*>(VKTS_TASK_DEQUE_CAPACITY)));
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    reset();
+}
+
+int32_t TaskScheduler::getExecutorCount() const
+{
+    return executorCount;
+}
+
+int32_t TaskScheduler::getUpdateThreadCount() const
+{
+    return updateThreadCount;
+}
+
+void TaskScheduler::bindExecutor(const int32_t executorIndex) const
+{
+    if (executorIndex < 0 || executorIndex >= executorCount)
+    {
+        bindSlot(-1);
+
+        return;
+    }
+
+    bindSlot(executorIndex);
+}
+
+void TaskScheduler::bindUpdateThread(const int32_t updateThreadIndex) const
+{
+    if (updateThreadIndex < 0 || updateThreadIndex >= updateThreadCount)
+    {
+        bindSlot(-1);
+
+        return;
+    }
+
+    bindSlot(executorCount + updateThreadIndex);
+}
+
+VkBool32 TaskScheduler::addTask(const ITaskSP& task, const VkTsTaskWait wait, const double timeout)
+{
+    auto taskQueueElement = acquireElement(wait, timeout);
+
+    if (!taskQueueElement)
+    {
+        return VK_FALSE;
+    }
+
+    taskQueueElement->task = task;
+
+    return addElement(taskQueueElement);
+}
+
+VkBool32 TaskScheduler::addTaskGraphTask(const std::shared_ptr<TaskGraph>& taskGraph, const uint32_t taskGraphIndex)
+{
+    if (!taskGraph.get())
+    {
+        return VK_FALSE;
+    }
+
+    auto taskQueueElement = acquireElement(VKTS_TASK_WAIT_BLOCK, 0.0);
+
+    if (!taskQueueElement)
+    {
+        return VK_FALSE;
+    }
+
+    taskQueueElement->task = taskGraph->getTask(taskGraphIndex);
+    taskQueueElement->taskGraph = taskGraph;
+    taskQueueElement->taskGraphIndex = taskGraphIndex;
+
+    return addElement(taskQueueElement);
+}
+
+VkBool32 TaskScheduler::receiveTask(ITaskSP& task, std::shared_ptr<TaskGraph>& taskGraph, uint32_t& taskGraphIndex, const VkBool32 wait)
+{
+    int32_t slot = getBoundSlot();
+
+    uint32_t victim = slot >= 0 ? (uint32_t)slot + 1 : 0;
+
+    TaskQueueElement* taskQueueElement = nullptr;
+
+    while (!taskQueueElement)
+    {
+        // Spin for a short time, as new tasks usually arrive in bursts.
+
+        for (uint32_t round = 0; round < VKTS_TASK_SPIN_ROUNDS; round++)
+        {
+            if (!running.load())
+            {
+                return VK_FALSE;
+            }
+
+            if (takeElement(taskQueueElement, slot, victim))
+            {
+                break;
+            }
+
+            taskQueueElement = nullptr;
+
+            if (pendingCount.load() == 0)
+            {
+                if (!wait)
+                {
+                    return VK_FALSE;
+                }
+
+                break;
+            }
+
+            std::this_thread::yield();
+        }
+
+        if (taskQueueElement)
+        {
+            break;
+        }
+
+        if (!wait)
+        {
+            return VK_FALSE;
+        }
+
+        // Nothing to do, so park until a task arrives.
+
+        std::unique_lock<std::mutex> parkUniqueLock(parkMutex);
+
+        parkedCount++;
+
+        while (running.load() && pendingCount.load() == 0)
+        {
+            parkConditionVariable.wait(parkUniqueLock);
+        }
+
+        parkedCount--;
+    }
+
+    pendingCount--;
+
+    taskQueueElement->received = timeGetRaw();
+
+    task = taskQueueElement->task;
+    taskGraph = taskQueueElement->taskGraph;
+    taskGraphIndex = taskQueueElement->taskGraphIndex;
+
+    taskQueueElementPool.release(taskQueueElement);
+
+    if (!task.get())
+    {
+        return VK_FALSE;
+    }
+
+    return VK_TRUE;
+}
+
+void TaskScheduler::discardElement(TaskQueueElement* taskQueueElement)
+{
+    pendingCount--;
+
+    // Cancelling a task graph task releases its successors, which are discarded in the next round.
+    if (taskQueueElement->taskGraph.get())
+    {
+        taskQueueElement->taskGraph->cancel(taskQueueElement->taskGraphIndex);
+    }
+
+    taskQueueElementPool.release(taskQueueElement);
+}
+
+void TaskScheduler::reset()
+{
+    TaskQueueElement* taskQueueElement = nullptr;
+
+    VkBool32 discarded;
+
+    do
+    {
+        discarded = VK_FALSE;
+
+        while (overflowQueue.take(taskQueueElement))
+        {
+            overflowCount--;
+
+            discardElement(taskQueueElement);
+
+            discarded = VK_TRUE;
+        }
+
+        for (size_t i = 0; i < allDeques.size(); i++)
+        {
+            while (!allDeques[i]->empty())
+            {
+                if (allDeques[i]->steal(taskQueueElement))
+                {
+                    discardElement(taskQueueElement);
+
+                    discarded = VK_TRUE;
+                }
+            }
+        }
+    }
+    while (discarded);
+}
+
+void TaskScheduler::getLatency(VkTsTaskLatency& latency) const
+{
+    taskQueueElementPool.getLatency(latency);
+}
+
+void TaskScheduler::shutdown()
+{
+    running = VK_FALSE;
+
+    std::lock_guard<std::mutex> parkLockGuard(parkMutex);
+
+    parkConditionVariable.notify_all();
+}
+
+} /* namespace vkts */
@@ -0,0 +1,152 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_TASKSCHEDULER_HPP_
+#define VKTS_TASKSCHEDULER_HPP_
+
+#include <vkts/runtime/vkts_runtime.hpp>
+
+#include "TaskQueue.hpp"
+
+#define VKTS_TASK_DEQUE_CAPACITY 1024
+
+#define VKTS_TASK_SPIN_ROUNDS 64
+
+namespace vkts
+{
+
+typedef std::shared_ptr<WorkStealingDeque<TaskQueueElement*> > TaskDequeSP;
+
+/**
+ * Work stealing scheduler.
+ *
+ * Every task executor and every update thread owns one deque. A thread bound to a slot pushes and pops
+ * at the bottom of its own deque without locking. Idle task executors steal from the top of the other deques.
+ * Tasks added by threads without a slot, or when the own deque is full, go to a shared overflow queue.
+ * Task executors without work park on a condition variable instead of spinning.
+ */
+class TaskScheduler
+{
+
+private:
+
+    const int32_t executorCount;
+
+    const int32_t updateThreadCount;
+
+    std::vector<TaskDequeSP> allDeques;
+
+    TaskQueueElementPool taskQueueElementPool;
+
+    ThreadsafeQueue<TaskQueueElement*> overflowQueue;
+
+    std::atomic<int64_t> overflowCount;
+
+    std::atomic<int64_t> pendingCount;
+
+    std::atomic<int32_t> parkedCount;
+
+    std::atomic<VkBool32> running;
+
+    std::mutex parkMutex;
+
+    std::condition_variable parkConditionVariable;
+
+    int32_t getBoundSlot() const;
+
+    void bindSlot(const int32_t slot) const;
+
+    TaskQueueElement* acquireElement(const VkTsTaskWait wait, const double timeout);
+
+    VkBool32 addElement(TaskQueueElement* taskQueueElement);
+
+    void discardElement(TaskQueueElement* taskQueueElement);
+
+    VkBool32 takeElement(TaskQueueElement*& taskQueueElement, const int32_t slot, uint32_t& victim);
+
+    void wakeUp();
+
+public:
+
+    TaskScheduler() = delete;
+    TaskScheduler(const TaskScheduler& other) = delete;
+    TaskScheduler(TaskScheduler&& other) = delete;
+    TaskScheduler(const int32_t executorCount, const int32_t updateThreadCount);
+    virtual ~TaskScheduler();
+
+    TaskScheduler& operator =(const TaskScheduler& other) = delete;
+    TaskScheduler& operator =(TaskScheduler && other) = delete;
+
+    int32_t getExecutorCount() const;
+
+    int32_t getUpdateThreadCount() const;
+
+    /**
+     * Has to be called by the task executor thread itself.
+     */
+    void bindExecutor(const int32_t executorIndex) const;
+
+    /**
+     * Has to be called by the update thread itself.
+     */
+    void bindUpdateThread(const int32_t updateThreadIndex) const;
+
+    /**
+     * Thread safe. An empty task stops exactly one task executor.
+     * If all elements are in use, the wait mode decides, if the call blocks, fails or fails after the timeout.
+     */
+    VkBool32 addTask(const ITaskSP& task, const VkTsTaskWait wait = VKTS_TASK_WAIT_BLOCK, const double timeout = 0.0);
+
+    /**
+     * Thread safe. Adds a task of a task graph, which is ready to be executed.
+     */
+    VkBool32 addTaskGraphTask(const std::shared_ptr<TaskGraph>& taskGraph, const uint32_t taskGraphIndex);
+
+    /**
+     * Thread safe. Returns VK_FALSE for an empty task or if the scheduler is shut down.
+     * If the task belongs to a task graph, the graph and the index in the graph are returned as well.
+     */
+    VkBool32 receiveTask(ITaskSP& task, std::shared_ptr<TaskGraph>& taskGraph, uint32_t& taskGraphIndex, const VkBool32 wait = VK_TRUE);
+
+    /**
+     * Thread safe. Discards all pending tasks.
+     */
+    void reset();
+
+    /**
+     * Thread safe. Wakes up all parked task executors and lets them return without a task.
+     */
+    void shutdown();
+
+    void getLatency(VkTsTaskLatency& latency) const;
+
+};
+
+typedef std::shared_ptr<TaskScheduler> TaskSchedulerSP;
+
+} /* namespace vkts */
+
+#endif /* VKTS_TASKSCHEDULER_HPP_ */
@@ -25,12 +25,13 @@
  */
 
 #include "UpdateThreadContext.hpp"
+#include "TaskGraph.hpp"
 
 namespace vkts
 {
 
-UpdateThreadContext::UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue) :
-    IUpdateThreadContext(), threadIndex(threadIndex), threadCount(threadCount), sendTaskQueue(sendTaskQueue), executedTaskQueue(executedTaskQueue)
+UpdateThreadContext::UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const VkTsFramePacing framePacing, const double frameTime, const TaskSchedulerSP& sendTaskScheduler, const TaskQueueSP& executedTaskQueue) :
+    IUpdateThreadContext(), threadIndex(threadIndex), threadCount(threadCount), sendTaskScheduler(sendTaskScheduler), executedTaskQueue(executedTaskQueue), framePacer(framePacing, frameTime)
 {
     this->startTime = timeGetRaw();
     this->lastTime = startTime;
@@ -45,6 +46,14 @@ UpdateThreadContext::~UpdateThreadContext()
 {
 }
 
+void UpdateThreadContext::bind() const
+{
+    if (sendTaskScheduler.get())
+    {
+        sendTaskScheduler->bindUpdateThread(threadIndex);
+    }
+}
+
 void UpdateThreadContext::update()
 {
     lastTime = currentTime;
@@ -54,6 +63,11 @@ void UpdateThreadContext::update()
     currentTicks = static_cast<uint64_t>(getTotalTime() / getTickTime());
 }
 
+void UpdateThreadContext::pace()
+{
+    framePacer.wait();
+}
+
 //
 // IUpdateThreadContext
 //
@@ -97,14 +111,31 @@ uint64_t UpdateThreadContext::getDeltaTicks() const
     return currentTicks - lastTicks;
 }
 
-VkBool32 UpdateThreadContext::sendTask(const ITaskSP& task) const
+double UpdateThreadContext::getTickAlpha() const
+{
+    return glm::clamp(getTotalTime() / getTickTime() - static_cast<double>(currentTicks), 0.0, 1.0);
+}
+
+// Frame pacing functions.
+
+double UpdateThreadContext::getFrameTime() const
+{
+    return framePacer.getFrameTime();
+}
+
+uint64_t UpdateThreadContext::getMissedFrames() const
+{
+    return framePacer.getMissedFrames();
+}
+
+VkBool32 UpdateThreadContext::sendTask(const ITaskSP& task, const VkTsTaskWait wait, const double timeout) const
 {
-    if (!sendTaskQueue.get())
+    if (!sendTaskScheduler.get())
     {
         return VK_FALSE;
     }
 
-    return sendTaskQueue->addTask(task);
+    return sendTaskScheduler->addTask(task, wait, timeout);
 }
 
 VkBool32 UpdateThreadContext::receiveExecutedTask(ITaskSP& task, const VkBool32 wait) const
@@ -117,11 +148,21 @@ VkBool32 UpdateThreadContext::receiveExecutedTask(ITaskSP& task, const VkBool32
     return executedTaskQueue->receiveTask(task, wait);
 }
 
+VkBool32 UpdateThreadContext::sendTaskGraph(const ITaskGraphSP& taskGraph) const
+{
+    if (!sendTaskScheduler.get() || !taskGraph.get())
+    {
+        return VK_FALSE;
+    }
+
+    return static_cast<TaskGraph*>(taskGraph.get())->submit(*sendTaskScheduler);
+}
+
 void UpdateThreadContext::resetSendTasks() const
 {
-    if (sendTaskQueue.get())
+    if (sendTaskScheduler.get())
     {
-    	sendTaskQueue->reset();
+    	sendTaskScheduler->reset();
     }
 }
 
@@ -133,4 +174,20 @@ void UpdateThreadContext::resetExecutedTasks() const
     }
 }
 
+void UpdateThreadContext::getTaskLatency(VkTsTaskLatency& sendLatency, VkTsTaskLatency& executedLatency) const
+{
+    memset(&sendLatency, 0, sizeof(VkTsTaskLatency));
+    memset(&executedLatency, 0, sizeof(VkTsTaskLatency));
+
+    if (sendTaskScheduler.get())
+    {
+        sendTaskScheduler->getLatency(sendLatency);
+    }
+
+    if (executedTaskQueue.get())
+    {
+        executedTaskQueue->getLatency(executedLatency);
+    }
+}
+
 } /* namespace vkts */
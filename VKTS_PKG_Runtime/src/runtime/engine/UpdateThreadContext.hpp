@@ -29,7 +29,9 @@
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
+#include "FramePacer.hpp"
 #include "TaskQueue.hpp"
+#include "TaskScheduler.hpp"
 
 namespace vkts
 {
@@ -49,25 +51,37 @@ private:
 
     double tickTime;
 
-    TaskQueueSP sendTaskQueue;
+    TaskSchedulerSP sendTaskScheduler;
     TaskQueueSP executedTaskQueue;
 
     uint64_t lastTicks;
     uint64_t currentTicks;
 
+    FramePacer framePacer;
+
 public:
 
     UpdateThreadContext() = delete;
     UpdateThreadContext(const UpdateThreadContext& other) = delete;
     UpdateThreadContext(UpdateThreadContext&& other) = delete;
-    UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const TaskQueueSP& sendTaskQueue, const TaskQueueSP& executedTaskQueue);
+    UpdateThreadContext(const int32_t threadIndex, const int32_t threadCount, const double tickTime, const VkTsFramePacing framePacing, const double frameTime, const TaskSchedulerSP& sendTaskScheduler, const TaskQueueSP& executedTaskQueue);
     virtual ~UpdateThreadContext();
 
     UpdateThreadContext& operator =(const UpdateThreadContext& other) = delete;
     UpdateThreadContext& operator =(UpdateThreadContext && other) = delete;
 
+    /**
+     * Has to be called by the update thread itself.
+     */
+    void bind() const;
+
     void update();
 
+    /**
+     * Waits until the next frame is due.
+     */
+    void pace();
+
     //
     // IUpdateThreadContext
     //
@@ -90,16 +104,28 @@ public:
 
     virtual uint64_t getDeltaTicks() const override;
 
+    virtual double getTickAlpha() const override;
+
+    // Frame pacing functions.
+
+    virtual double getFrameTime() const override;
+
+    virtual uint64_t getMissedFrames() const override;
+
     // Task functions
 
-    virtual VkBool32 sendTask(const ITaskSP& task) const override;
+    virtual VkBool32 sendTask(const ITaskSP& task, const VkTsTaskWait wait = VKTS_TASK_WAIT_BLOCK, const double timeout = 0.0) const override;
 
     virtual VkBool32 receiveExecutedTask(ITaskSP& task, const VkBool32 wait = VK_TRUE) const override;
 
+    virtual VkBool32 sendTaskGraph(const ITaskGraphSP& taskGraph) const override;
+
     virtual void resetSendTasks() const override;
 
     virtual void resetExecutedTasks() const override;
 
+    virtual void getTaskLatency(VkTsTaskLatency& sendLatency, VkTsTaskLatency& executedLatency) const override;
+
 };
 
 typedef std::shared_ptr<UpdateThreadContext> UpdateThreadContextSP;
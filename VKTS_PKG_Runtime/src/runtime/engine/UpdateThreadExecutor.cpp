@@ -26,6 +26,8 @@
 
 #include "UpdateThreadExecutor.hpp"
 
+#include "../barrier/fn_barrier_internal.hpp"
+
 namespace vkts
 {
 
@@ -47,6 +49,10 @@ void UpdateThreadExecutor::run() const
 {
     // Initialization.
 
+    updateThreadContext->bind();
+
+    _barrierSetThreadIndex(index);
+
     VkBool32 doRun = VK_TRUE;
 
     if (!updateThread->init(*updateThreadContext))
@@ -69,7 +75,11 @@ void UpdateThreadExecutor::run() const
 
     while (doRun && executorSync.doAllRun())
     {
-        doRun = updateThread->update(*updateThreadContext);
+        {
+            VKTS_PROFILE_ZONE("UpdateThreadExecutor::run");
+
+            doRun = updateThread->update(*updateThreadContext);
+        }
 
         if (!doRun)
         {
@@ -112,7 +122,7 @@ void UpdateThreadExecutor::run() const
             }
         }
 
-        std::this_thread::yield();
+        updateThreadContext->pace();
     }
 
     // Blocking call, that all executors have finished their update thread.
@@ -26,6 +26,7 @@
 
 #include <vkts/runtime/vkts_runtime.hpp>
 
+#include "FramePacer.hpp"
 #include "TaskExecutor.hpp"
 #include "UpdateThreadExecutor.hpp"
 
@@ -45,10 +46,22 @@ static SmartPointerVector<IUpdateThreadSP> g_allUpdateThreads;
 
 static double g_tickTime = 1.0 / VKTS_TICKS_PER_SECOND;
 
+static VkTsFramePacing g_framePacing = VKTS_FRAME_PACING_NONE;
+
+static double g_frameTime = 1.0 / VKTS_FRAMES_PER_SECOND;
+
 static uint32_t g_taskExecutorCount = 0;
 
 static PFN_dispatchFunction g_dispatchFunction = nullptr;
 
+// Kept after the run, so the task latency can still be queried.
+
+static std::mutex g_taskLatencyMutex;
+
+static TaskSchedulerSP g_sendTaskScheduler;
+
+static TaskQueueSP g_executedTaskQueue;
+
 VkBool32 VKTS_APIENTRY engineInit(const PFN_dispatchFunction dispatchFunction)
 {
     if (!processorInit())
@@ -135,6 +148,29 @@ VkBool32 VKTS_APIENTRY engineSetTicksPerSecond(const double ticksPerSecond)
     return VK_TRUE;
 }
 
+VkBool32 VKTS_APIENTRY engineSetFramePacing(const VkTsFramePacing framePacing, const double framesPerSecond)
+{
+    if (g_engineState != VKTS_ENGINE_INIT_STATE)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Setting frame pacing failed! Not in initialize state.");
+
+        return VK_FALSE;
+    }
+
+    double newFramesPerSecond = glm::clamp(framesPerSecond, VKTS_FRAMES_PER_SECOND_MIN, VKTS_FRAMES_PER_SECOND_MAX);
+
+    g_framePacing = framePacing;
+
+    g_frameTime = 1.0 / newFramesPerSecond;
+
+    return VK_TRUE;
+}
+
+void VKTS_APIENTRY engineSetVsyncTiming(const double presentTime, const double refreshInterval)
+{
+    FramePacer::setVsyncTiming(presentTime, refreshInterval);
+}
+
 VkBool32 VKTS_APIENTRY engineRun()
 {
     if (g_engineState != VKTS_ENGINE_INIT_STATE)
@@ -151,6 +187,15 @@ VkBool32 VKTS_APIENTRY engineRun()
         return VK_FALSE;
     }
 
+    // Barrier creation for the final number of update threads.
+
+    if (!barrierInit())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Run failed! Could not initialize the barrier.");
+
+        return VK_FALSE;
+    }
+
     //
     // Main thread gets all displays and windows attached.
     //
@@ -161,16 +206,16 @@ VkBool32 VKTS_APIENTRY engineRun()
 
     // Task queue creation.
 
-    TaskQueueSP sendTaskQueue;
+    TaskSchedulerSP sendTaskScheduler;
     TaskQueueSP executedTaskQueue;
 
     if (g_taskExecutorCount > 0)
     {
-        sendTaskQueue = TaskQueueSP(new TaskQueue);
+        sendTaskScheduler = TaskSchedulerSP(new TaskScheduler((int32_t) g_taskExecutorCount, engineGetNumberUpdateThreads()));
 
-        if (!sendTaskQueue.get())
+        if (!sendTaskScheduler.get())
         {
-            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Run failed! Could not create task queue.");
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Run failed! Could not create task scheduler.");
 
             return VK_FALSE;
         }
@@ -185,6 +230,13 @@ VkBool32 VKTS_APIENTRY engineRun()
         }
     }
 
+    {
+        std::lock_guard<std::mutex> taskLatencyLockGuard(g_taskLatencyMutex);
+
+        g_sendTaskScheduler = sendTaskScheduler;
+        g_executedTaskQueue = executedTaskQueue;
+    }
+
     // Object, needed for synchronizing the executors.
 
     ExecutorSync executorSync;
@@ -198,7 +250,7 @@ VkBool32 VKTS_APIENTRY engineRun()
 
     for (uint32_t i = 0; i < g_taskExecutorCount; i++)
     {
-        auto currentTaskExecutor = TaskExecutorSP(new TaskExecutor(i, executorSync, sendTaskQueue, executedTaskQueue));
+        auto currentTaskExecutor = TaskExecutorSP(new TaskExecutor(i, executorSync, sendTaskScheduler, executedTaskQueue));
 
         if (!currentTaskExecutor.get())
         {
@@ -241,7 +293,7 @@ VkBool32 VKTS_APIENTRY engineRun()
 
         //
 
-        auto currentUpdateThreadContext = UpdateThreadContextSP(new UpdateThreadContext((int32_t) updateThreadIndex, (int32_t) g_allUpdateThreads.size(), g_tickTime, sendTaskQueue, executedTaskQueue));
+        auto currentUpdateThreadContext = UpdateThreadContextSP(new UpdateThreadContext((int32_t) updateThreadIndex, (int32_t) g_allUpdateThreads.size(), g_tickTime, g_framePacing, g_frameTime, sendTaskScheduler, executedTaskQueue));
 
         if (!currentUpdateThreadContext.get())
         {
@@ -319,24 +371,19 @@ VkBool32 VKTS_APIENTRY engineRun()
 
     //
 
-    if (sendTaskQueue.get())
+    if (sendTaskScheduler.get())
     {
     	// Empty the queue.
     	// As no update thread can feed the queue anymore, it is save to call reset.
 
-    	sendTaskQueue->reset();
+    	sendTaskScheduler->reset();
 
     	//
 
-    	ITaskSP stopTask;
-
         logPrint(VKTS_LOG_SEVERE, __FILE__, __LINE__, "Disabling task queue.");
 
-    	for (uint32_t i = 0; i < g_taskExecutorCount; i++)
-    	{
-    		// Send an empty task to the queue, to exit the thread.
-    		sendTaskQueue->addTask(stopTask);
-    	}
+        // Wakes up all parked task executors. Busy ones return after their current task.
+        sendTaskScheduler->shutdown();
     }
 
     // Wait for all tasks to finish in the reverse order they were created.
@@ -352,6 +399,13 @@ VkBool32 VKTS_APIENTRY engineRun()
     realTaskExecutors.clear();
     realTaskThreads.clear();
 
+    if (sendTaskScheduler.get())
+    {
+    	// Task graphs could have added successors, while the task executors were stopping.
+
+    	sendTaskScheduler->reset();
+    }
+
     //
 
     g_engineState = VKTS_ENGINE_INIT_STATE;
@@ -378,10 +432,34 @@ uint32_t VKTS_APIENTRY engineGetTaskExecutorCount()
     return g_taskExecutorCount;
 }
 
+VkBool32 VKTS_APIENTRY engineGetTaskLatency(VkTsTaskLatency& sendLatency, VkTsTaskLatency& executedLatency)
+{
+    std::lock_guard<std::mutex> taskLatencyLockGuard(g_taskLatencyMutex);
+
+    if (!g_sendTaskScheduler.get() || !g_executedTaskQueue.get())
+    {
+        return VK_FALSE;
+    }
+
+    g_sendTaskScheduler->getLatency(sendLatency);
+    g_executedTaskQueue->getLatency(executedLatency);
+
+    return VK_TRUE;
+}
+
 void VKTS_APIENTRY engineTerminate()
 {
 	g_dispatchFunction = nullptr;
 
+	{
+		std::lock_guard<std::mutex> taskLatencyLockGuard(g_taskLatencyMutex);
+
+		g_sendTaskScheduler.reset();
+		g_executedTaskQueue.reset();
+	}
+
+	parallelTerminate();
+
 	fileTerminate();
 
     barrierTerminate();
@@ -0,0 +1,277 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "GltfHandler.hpp"
+
+namespace vkts
+{
+
+GltfHandler::GltfHandler(GltfVisitor& gltfVisitor) :
+	JsonHandler(), gltfVisitor(gltfVisitor), collect(VK_TRUE), allMemberTexts(GltfVisitor::getMemberCount(), GltfMemberText{nullptr, 0}), jsonBuilder(), depth(0), memberIndex(-1), arrayMember(VK_FALSE), elementIndex(0)
+{
+}
+
+GltfHandler::GltfHandler(GltfVisitor& gltfVisitor, const uint32_t memberIndex) :
+	JsonHandler(), gltfVisitor(gltfVisitor), collect(VK_FALSE), allMemberTexts(), jsonBuilder(), depth(1), memberIndex((int32_t)memberIndex), arrayMember(VK_FALSE), elementIndex(0)
+{
+	// The decoded text starts with the member value, as if the top level object and the key were already decoded.
+}
+
+GltfHandler::~GltfHandler()
+{
+}
+
+VkBool32 GltfHandler::visitValue()
+{
+	if (arrayMember && depth == 2)
+	{
+		// Only the current element is kept in memory.
+
+		JSONarray jsonArray;
+
+		jsonArray.addValue(jsonBuilder.getValue());
+
+		gltfVisitor.visitMember((uint32_t)memberIndex, jsonArray, elementIndex);
+
+		elementIndex++;
+	}
+	else if (!arrayMember && depth == 1)
+	{
+		gltfVisitor.visitMember((uint32_t)memberIndex, *jsonBuilder.getValue(), 0);
+	}
+	else
+	{
+		return VK_TRUE;
+	}
+
+	return gltfVisitor.getState() != GltfState_Error;
+}
+
+const std::vector<GltfMemberText>& GltfHandler::getAllMemberTexts() const
+{
+	return allMemberTexts;
+}
+
+//
+
+VkBool32 GltfHandler::skipValue()
+{
+	// While collecting, the member values are only scanned.
+
+	return collect && depth == 1;
+}
+
+VkBool32 GltfHandler::skippedValue(const char* jsonText, const uint64_t length)
+{
+	if (memberIndex >= 0 && !allMemberTexts[memberIndex].jsonText)
+	{
+		allMemberTexts[memberIndex].jsonText = jsonText;
+		allMemberTexts[memberIndex].length = length;
+	}
+
+	return VK_TRUE;
+}
+
+VkBool32 GltfHandler::startObject()
+{
+	if (depth == 0)
+	{
+		depth++;
+
+		return VK_TRUE;
+	}
+
+	if (depth == 1)
+	{
+		arrayMember = VK_FALSE;
+	}
+
+	depth++;
+
+	return jsonBuilder.startObject();
+}
+
+VkBool32 GltfHandler::key(const std::string& key)
+{
+	if (depth == 1)
+	{
+		memberIndex = GltfVisitor::getMemberIndex(key);
+
+		return VK_TRUE;
+	}
+
+	return jsonBuilder.key(key);
+}
+
+VkBool32 GltfHandler::endObject()
+{
+	depth--;
+
+	if (depth == 0)
+	{
+		return VK_TRUE;
+	}
+
+	if (!jsonBuilder.endObject())
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+VkBool32 GltfHandler::startArray()
+{
+	if (depth == 0)
+	{
+		return VK_FALSE;
+	}
+
+	if (depth == 1)
+	{
+		arrayMember = VK_TRUE;
+		elementIndex = 0;
+
+		depth++;
+
+		return VK_TRUE;
+	}
+
+	depth++;
+
+	return jsonBuilder.startArray();
+}
+
+VkBool32 GltfHandler::endArray()
+{
+	depth--;
+
+	if (depth == 1 && arrayMember)
+	{
+		arrayMember = VK_FALSE;
+
+		return VK_TRUE;
+	}
+
+	if (!jsonBuilder.endArray())
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+VkBool32 GltfHandler::stringValue(const std::string& value)
+{
+	if (depth == 1)
+	{
+		arrayMember = VK_FALSE;
+	}
+
+	if (!jsonBuilder.stringValue(value))
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+VkBool32 GltfHandler::integerValue(const int32_t value)
+{
+	if (depth == 1)
+	{
+		arrayMember = VK_FALSE;
+	}
+
+	if (!jsonBuilder.integerValue(value))
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+VkBool32 GltfHandler::floatValue(const float value)
+{
+	if (depth == 1)
+	{
+		arrayMember = VK_FALSE;
+	}
+
+	if (!jsonBuilder.floatValue(value))
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+VkBool32 GltfHandler::trueValue()
+{
+	if (depth == 1)
+	{
+		arrayMember = VK_FALSE;
+	}
+
+	if (!jsonBuilder.trueValue())
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+VkBool32 GltfHandler::falseValue()
+{
+	if (depth == 1)
+	{
+		arrayMember = VK_FALSE;
+	}
+
+	if (!jsonBuilder.falseValue())
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+VkBool32 GltfHandler::nullValue()
+{
+	if (depth == 1)
+	{
+		arrayMember = VK_FALSE;
+	}
+
+	if (!jsonBuilder.nullValue())
+	{
+		return VK_FALSE;
+	}
+
+	return visitValue();
+}
+
+}
@@ -0,0 +1,128 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_GLTFHANDLER_HPP_
+#define VKTS_GLTFHANDLER_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#include "GltfVisitor.hpp"
+
+namespace vkts
+{
+
+/**
+ * Text of a top level member value. Empty, if the member is not in the file.
+ */
+typedef struct _GltfMemberText {
+	const char* jsonText;
+	uint64_t length;
+} GltfMemberText;
+
+/**
+ * Either collects the text of the top level members of a glTF file, or passes the value of one member to the visitor.
+ * The whole JSON document is never built. Elements of array members are built and visited one by one.
+ */
+class GltfHandler : public JsonHandler
+{
+
+private:
+
+	GltfVisitor& gltfVisitor;
+
+	const VkBool32 collect;
+
+	std::vector<GltfMemberText> allMemberTexts;
+
+	JsonBuilder jsonBuilder;
+
+	uint32_t depth;
+
+	int32_t memberIndex;
+
+	VkBool32 arrayMember;
+
+	int32_t elementIndex;
+
+	VkBool32 visitValue();
+
+public:
+
+	GltfHandler() = delete;
+	/**
+	 * Collects the text of all top level members.
+	 */
+	explicit GltfHandler(GltfVisitor& gltfVisitor);
+
+	/**
+	 * Visits the value of the given member. The decoded text has to be the text of the member value.
+	 */
+	GltfHandler(GltfVisitor& gltfVisitor, const uint32_t memberIndex);
+	GltfHandler(const GltfHandler& other) = delete;
+	GltfHandler(GltfHandler&& other) = delete;
+	virtual ~GltfHandler();
+
+	GltfHandler& operator =(const GltfHandler& other) = delete;
+	GltfHandler& operator =(GltfHandler && other) = delete;
+
+	/**
+	 * Indexed by the member index.
+	 */
+	const std::vector<GltfMemberText>& getAllMemberTexts() const;
+
+	//
+
+	virtual VkBool32 skipValue() override;
+
+	virtual VkBool32 skippedValue(const char* jsonText, const uint64_t length) override;
+
+	virtual VkBool32 startObject() override;
+
+	virtual VkBool32 key(const std::string& key) override;
+
+	virtual VkBool32 endObject() override;
+
+	virtual VkBool32 startArray() override;
+
+	virtual VkBool32 endArray() override;
+
+	virtual VkBool32 stringValue(const std::string& value) override;
+
+	virtual VkBool32 integerValue(const int32_t value) override;
+
+	virtual VkBool32 floatValue(const float value) override;
+
+	virtual VkBool32 trueValue() override;
+
+	virtual VkBool32 falseValue() override;
+
+	virtual VkBool32 nullValue() override;
+
+};
+
+}
+
+#endif /* VKTS_GLTFHANDLER_HPP_ */
@@ -29,8 +29,32 @@
 namespace vkts
 {
 
+typedef struct GltfMember_ {
+	const char* name;
+	enum GltfState state;
+	VkBool32 required;
+} GltfMember;
+
+// In the order, in which the members do depend on each other.
+static const GltfMember g_gltfMembers[] = {
+	{"asset", GltfState_Asset, VK_TRUE},
+	{"buffers", GltfState_Buffers, VK_TRUE},
+	{"bufferViews", GltfState_BufferViews, VK_TRUE},
+	{"accessors", GltfState_Accessors, VK_TRUE},
+	{"images", GltfState_Images, VK_FALSE},
+	{"samplers", GltfState_Samplers, VK_FALSE},
+	{"textures", GltfState_Textures, VK_FALSE},
+	{"materials", GltfState_Materials, VK_FALSE},
+	{"meshes", GltfState_Meshes, VK_TRUE},
+	{"skins", GltfState_Skins, VK_FALSE},
+	{"nodes", GltfState_Nodes, VK_FALSE},
+	{"animations", GltfState_Animations, VK_FALSE},
+	{"scenes", GltfState_Scenes, VK_FALSE},
+	{"scene", GltfState_DefaultScene, VK_FALSE}
+};
+
 GltfVisitor::GltfVisitor(const std::string& directory) :
-	JsonVisitor(), directory(directory), state(), gltfBool(VK_FALSE), gltfString(), gltfInteger(0), gltfFloat(0.0f), gltfIntegerArray{}, gltfFloatArray{}, arrayIndex(0), arraySize(0), numberArray(VK_FALSE), objectArray(VK_FALSE), gltfBuffer{}, gltfBufferView{}, gltfAccessor{}, gltfPrimitive{}, gltfImage{}, gltfSampler{}, gltfTexture{}, gltfMaterial{}, gltfMesh{}, gltfSkin{}, gltfNode{}, gltfAnimation_Sampler{}, gltfChannel{}, gltfAnimation{}, gltfScene{}, allGltfBuffers(), allGltfBufferViews(), allGltfAccessors(), allGltfImages(), allGltfSamplers(), allGltfTextures(), allGltfMaterials(), allGltfMeshes(), allGltfSkins(), allGltfNodes(), allGltfAnimations(), allGltfScenes(), defaultScene(nullptr)
+	JsonVisitor(), directory(directory), state(), visitedMembers(0), arrayOffset(0), gltfBool(VK_FALSE), gltfString(), gltfInteger(0), gltfFloat(0.0f), gltfIntegerArray{}, gltfFloatArray{}, arrayIndex(0), arraySize(0), numberArray(VK_FALSE), objectArray(VK_FALSE), gltfBuffer{}, gltfBufferView{}, gltfAccessor{}, gltfPrimitive{}, gltfImage{}, gltfSampler{}, gltfTexture{}, gltfMaterial{}, gltfMesh{}, gltfSkin{}, gltfNode{}, gltfAnimation_Sampler{}, gltfChannel{}, gltfAnimation{}, gltfScene{}, allGltfBuffers(), allGltfBufferViews(), allGltfAccessors(), allGltfImages(), allGltfSamplers(), allGltfTextures(), allGltfMaterials(), allGltfMeshes(), allGltfSkins(), allGltfNodes(), allGltfAnimations(), allGltfScenes(), defaultScene(nullptr)
 {
 }
 
@@ -63,11 +87,12 @@ void GltfVisitor::visitBuffer(JSONobject& jsonObject)
 
 	std::string finalFilename = directory + gltfString;
 
-	auto binaryBuffer = fileLoadBinary(finalFilename.c_str());
+	// Buffer data is only read, so it is mapped and not copied.
+	auto binaryBuffer = fileMapBinary(finalFilename.c_str(), VKTS_FILE_ACCESS_RANDOM);
 
 	if (!binaryBuffer.get())
 	{
-		binaryBuffer = fileLoadBinary(gltfString.c_str());
+		binaryBuffer = fileMapBinary(gltfString.c_str(), VKTS_FILE_ACCESS_RANDOM);
 
 		if (!binaryBuffer.get())
 		{
@@ -91,7 +116,7 @@ void GltfVisitor::visitBuffer(JSONobject& jsonObject)
 
 	gltfBuffer.byteLength = (int32_t)gltfInteger;
 
-	if (gltfBuffer.byteLength != gltfBuffer.binaryBuffer->getSize())
+	if ((uint64_t)gltfBuffer.byteLength != gltfBuffer.binaryBuffer->getSize())
 	{
 		state.push(GltfState_Error);
 		return;
@@ -2079,7 +2104,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 			{
 				gltfBuffer.binaryBuffer = IBinaryBufferSP();
 				gltfBuffer.byteLength = 0;
-				gltfBuffer.name = "Buffer_" + std::to_string(i);
+				gltfBuffer.name = "Buffer_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2104,7 +2129,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 				gltfBufferView.byteOffset = 0;
 			    gltfBufferView.byteLength = 0;
 			    gltfBufferView.byteStride = 0;
-				gltfBufferView.name = "BufferView_" + std::to_string(i);
+				gltfBufferView.name = "BufferView_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2133,7 +2158,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 				gltfAccessor.type = "";
 				gltfAccessor.max.clear();
 				gltfAccessor.min.clear();
-				gltfAccessor.name = "Accessor_" + std::to_string(i);
+				gltfAccessor.name = "Accessor_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2155,7 +2180,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
 			{
 				gltfImage.imageData.reset();
-				gltfImage.name = "Image_" + std::to_string(i);
+				gltfImage.name = "Image_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2180,7 +2205,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 				gltfSampler.minFilter = 9986;
 				gltfSampler.wrapS = 10497;
 				gltfSampler.wrapT = 10497;
-				gltfSampler.name = "Sampler_" + std::to_string(i);
+				gltfSampler.name = "Sampler_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2207,7 +2232,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 				gltfTexture.source = nullptr;
 				gltfTexture.target = 3553;
 				gltfTexture.type = 5121;
-				gltfTexture.name = "Texture_" + std::to_string(i);
+				gltfTexture.name = "Texture_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2253,7 +2278,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 				gltfMaterial.emissiveFactor[2] = 1.0f;
 				gltfMaterial.emissiveTexture = nullptr;
 
-				gltfMaterial.name = "Material_" + std::to_string(i);
+				gltfMaterial.name = "Material_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2275,7 +2300,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
 			{
 				gltfMesh.primitives.clear();
-				gltfMesh.name = "Mesh_" + std::to_string(i);
+				gltfMesh.name = "Mesh_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2299,7 +2324,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 				gltfSkin.inverseBindMatrices.clear();
 				gltfSkin.skeleton = 0;
 				gltfSkin.joints.clear();
-				gltfSkin.name = "Skin_" + std::to_string(i);
+				gltfSkin.name = "Skin_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2322,7 +2347,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 			{
 				gltfNode.children.clear();
 				gltfNode.skin = nullptr;
-				gltfNode.name = "Node_" + std::to_string(i);
+				gltfNode.name = "Node_" + std::to_string(arrayOffset + i);
 
 				for (int32_t k = 0; k < 16; k++)
 				{
@@ -2372,7 +2397,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 			{
 				gltfAnimation.samplers.clear();
 				gltfAnimation.channels.clear();
-				gltfAnimation.name = "Animation_" + std::to_string(i);
+				gltfAnimation.name = "Animation_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2394,7 +2419,7 @@ void GltfVisitor::visit(JSONarray& jsonArray)
 			for (int32_t i = 0; i < (int32_t)jsonArray.size(); i++)
 			{
 				gltfScene.nodes.clear();
-				gltfScene.name = "Scene_" + std::to_string(i);
+				gltfScene.name = "Scene_" + std::to_string(arrayOffset + i);
 
 				//
 
@@ -2562,298 +2587,24 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 	{
 		// Not processing extensionsUsed, extensionsRequired, cameras, programs, shaders, techniques, glExtensionsUsed, extensions, extras
 
-		//
-
-		if (!jsonObject.hasKey("asset"))
-		{
-			state.push(GltfState_Error);
-			return;
-		}
-
-		auto asset = jsonObject.getValue("asset");
-
-		state.push(GltfState_Asset);
-		asset->visit(*this);
-
-		if (state.top() == GltfState_Error)
-		{
-			return;
-		}
-
-		//
-
-		if (!jsonObject.hasKey("buffers"))
-		{
-			state.push(GltfState_Error);
-			return;
-		}
-
-		objectArray = VK_TRUE;
-
-		auto buffers = jsonObject.getValue("buffers");
-
-		state.push(GltfState_Buffers);
-		buffers->visit(*this);
-
-		objectArray = VK_FALSE;
-
-		if (state.top() == GltfState_Error)
-		{
-			return;
-		}
-
-		//
-
-		if (!jsonObject.hasKey("bufferViews"))
-		{
-			state.push(GltfState_Error);
-			return;
-		}
-
-		objectArray = VK_TRUE;
-
-		auto bufferViews = jsonObject.getValue("bufferViews");
-
-		state.push(GltfState_BufferViews);
-		bufferViews->visit(*this);
-
-		objectArray = VK_FALSE;
-
-		if (state.top() == GltfState_Error)
-		{
-			return;
-		}
-
-		//
-
-		if (!jsonObject.hasKey("accessors"))
-		{
-			state.push(GltfState_Error);
-			return;
-		}
-
-		objectArray = VK_TRUE;
-
-		auto accessors = jsonObject.getValue("accessors");
-
-		state.push(GltfState_Accessors);
-		accessors->visit(*this);
-
-		objectArray = VK_FALSE;
-
-		if (state.top() == GltfState_Error)
-		{
-			return;
-		}
-
-		//
-
-		// Optional.
-
-		if (jsonObject.hasKey("images"))
-		{
-			objectArray = VK_TRUE;
-
-			auto images = jsonObject.getValue("images");
-
-			state.push(GltfState_Images);
-			images->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-		if (jsonObject.hasKey("samplers"))
-		{
-			objectArray = VK_TRUE;
-
-			auto samplers = jsonObject.getValue("samplers");
-
-			state.push(GltfState_Samplers);
-			samplers->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-		if (jsonObject.hasKey("textures"))
-		{
-			objectArray = VK_TRUE;
-
-			auto textures = jsonObject.getValue("textures");
-
-			state.push(GltfState_Textures);
-			textures->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-		if (jsonObject.hasKey("materials"))
-		{
-			objectArray = VK_TRUE;
-
-			auto materials = jsonObject.getValue("materials");
-
-			state.push(GltfState_Materials);
-			materials->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-		//
-
-		if (!jsonObject.hasKey("meshes"))
-		{
-			state.push(GltfState_Error);
-			return;
-		}
-
-		objectArray = VK_TRUE;
-
-		auto meshes = jsonObject.getValue("meshes");
-
-		state.push(GltfState_Meshes);
-		meshes->visit(*this);
-
-		objectArray = VK_FALSE;
-
-		if (state.top() == GltfState_Error)
-		{
-			return;
-		}
-
-		//
-
-		// Optional.
-
-		if (jsonObject.hasKey("skins"))
-		{
-			objectArray = VK_TRUE;
-
-			auto skins = jsonObject.getValue("skins");
-
-			state.push(GltfState_Skins);
-			skins->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-		//
-
-		if (jsonObject.hasKey("nodes"))
-		{
-			objectArray = VK_TRUE;
-
-			auto nodes = jsonObject.getValue("nodes");
-
-			state.push(GltfState_Nodes);
-			nodes->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-		//
-
-		if (jsonObject.hasKey("animations"))
-		{
-			objectArray = VK_TRUE;
-
-			auto animations = jsonObject.getValue("animations");
-
-			state.push(GltfState_Animations);
-			animations->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-
-		//
-
-		if (jsonObject.hasKey("scenes"))
-		{
-			objectArray = VK_TRUE;
-
-			auto scenes = jsonObject.getValue("scenes");
-
-			state.push(GltfState_Scenes);
-			scenes->visit(*this);
-
-			objectArray = VK_FALSE;
-
-			if (state.top() == GltfState_Error)
-			{
-				return;
-			}
-		}
-
-		//
-
-		if (jsonObject.hasKey("scene"))
+		for (uint32_t memberIndex = 0; memberIndex < getMemberCount(); memberIndex++)
 		{
-			if (!jsonObject.hasKey("scenes"))
+			if (!jsonObject.hasKey(g_gltfMembers[memberIndex].name))
 			{
-				state.push(GltfState_Error);
-				return;
+				continue;
 			}
 
-			//
+			auto member = jsonObject.getValue(g_gltfMembers[memberIndex].name);
 
-			auto scene = jsonObject.getValue("scene");
-
-			scene->visit(*this);
+			visitMember(memberIndex, *member, 0);
 
 			if (state.top() == GltfState_Error)
 			{
 				return;
 			}
-
-			if (allGltfScenes.size() <= (uint32_t)gltfInteger)
-			{
-				state.push(GltfState_Error);
-				return;
-			}
-
-			defaultScene = &(allGltfScenes[gltfInteger]);
 		}
 
-		//
-		// If this point is reached, the glTF file could be parsed successfully.
-		//
-
-		state.push(GltfState_End);
+		visitEnd();
 
 		return;
 	}
@@ -2996,6 +2747,124 @@ void GltfVisitor::visit(JSONobject& jsonObject)
 	state.pop();
 }
 
+//
+
+uint32_t GltfVisitor::getMemberCount()
+{
+	return (uint32_t)(sizeof(g_gltfMembers) / sizeof(g_gltfMembers[0]));
+}
+
+int32_t GltfVisitor::getMemberIndex(const std::string& name)
+{
+	for (uint32_t memberIndex = 0; memberIndex < getMemberCount(); memberIndex++)
+	{
+		if (name == g_gltfMembers[memberIndex].name)
+		{
+			return (int32_t)memberIndex;
+		}
+	}
+
+	return -1;
+}
+
+void GltfVisitor::visitMember(const uint32_t memberIndex, JSONvalue& jsonValue, const int32_t arrayOffset)
+{
+	if (state.size() == 0)
+	{
+		state.push(GltfState_Start);
+	}
+
+	if (state.top() == GltfState_Error)
+	{
+		return;
+	}
+
+	if (memberIndex >= getMemberCount())
+	{
+		state.push(GltfState_Error);
+		return;
+	}
+
+	visitedMembers |= 1u << memberIndex;
+
+	auto memberState = g_gltfMembers[memberIndex].state;
+
+	if (memberState == GltfState_Asset)
+	{
+		state.push(GltfState_Asset);
+		jsonValue.visit(*this);
+	}
+	else if (memberState == GltfState_DefaultScene)
+	{
+		if (!(visitedMembers & (1u << (uint32_t)getMemberIndex("scenes"))))
+		{
+			state.push(GltfState_Error);
+			return;
+		}
+
+		jsonValue.visit(*this);
+
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
+
+		if (allGltfScenes.size() <= (uint32_t)gltfInteger)
+		{
+			state.push(GltfState_Error);
+			return;
+		}
+
+		defaultScene = &(allGltfScenes[gltfInteger]);
+	}
+	else
+	{
+		objectArray = VK_TRUE;
+		this->arrayOffset = arrayOffset;
+
+		state.push(memberState);
+		jsonValue.visit(*this);
+
+		objectArray = VK_FALSE;
+		this->arrayOffset = 0;
+
+		if (state.top() == GltfState_Error)
+		{
+			return;
+		}
+
+		state.pop();
+	}
+}
+
+void GltfVisitor::visitEnd()
+{
+	if (state.size() == 0)
+	{
+		state.push(GltfState_Start);
+	}
+
+	if (state.top() == GltfState_Error)
+	{
+		return;
+	}
+
+	for (uint32_t memberIndex = 0; memberIndex < getMemberCount(); memberIndex++)
+	{
+		if (g_gltfMembers[memberIndex].required && !(visitedMembers & (1u << memberIndex)))
+		{
+			state.push(GltfState_Error);
+			return;
+		}
+	}
+
+	//
+	// If this point is reached, the glTF file could be parsed successfully.
+	//
+
+	state.push(GltfState_End);
+}
+
 const std::string& GltfVisitor::getDirectory() const
 {
 	return directory;
@@ -3169,7 +3038,7 @@ const void* GltfVisitor::getBufferPointer(const GltfAccessor& accessor, const ui
 	{
 		return nullptr;
 	}
-	if (accessor.bufferView->buffer->byteLength != accessor.bufferView->buffer->binaryBuffer->getSize())
+	if ((uint64_t)accessor.bufferView->buffer->byteLength != accessor.bufferView->buffer->binaryBuffer->getSize())
 	{
 		return nullptr;
 	}
@@ -51,6 +51,7 @@ enum GltfState {
 	GltfState_Nodes,
 	GltfState_Animations,
 	GltfState_Scenes,
+	GltfState_DefaultScene,
 
 	GltfState_Buffer,
 	GltfState_BufferView,
@@ -231,6 +232,9 @@ private:
 
 	std::stack<enum GltfState> state;
 
+	uint32_t visitedMembers;
+	int32_t arrayOffset;
+
 	VkBool32 gltfBool;
 	std::string gltfString;
 	int32_t gltfInteger;
@@ -325,6 +329,26 @@ public:
 
 	//
 
+	static uint32_t getMemberCount();
+
+	/**
+	 * Index of a top level member in the order, in which the members have to be visited. Not processed members return -1.
+	 */
+	static int32_t getMemberIndex(const std::string& name);
+
+	/**
+	 * Visits a top level member of a streamed glTF file. The elements of array members can be visited one by one,
+	 * where the offset is the index of the first element in the given array.
+	 */
+	void visitMember(const uint32_t memberIndex, JSONvalue& jsonValue, const int32_t arrayOffset);
+
+	/**
+	 * Checks, if all required members have been visited.
+	 */
+	void visitEnd();
+
+	//
+
 	const std::string& getDirectory() const;
 
 	enum GltfState getState() const;
@@ -0,0 +1,189 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SceneStream.hpp"
+
+namespace vkts
+{
+
+SceneStream::SceneStream(const uint32_t retireFrames) :
+    ISceneStream(), sceneStreamMutex(), scene(), allFunctions(), allRetiringFunctions(retireFrames + 1), updateCount(0), bufferCount(0), allWriteDescriptorSetsCount(0), allWriteDescriptorSets(nullptr), descriptorSetsFunction(), finished(VK_FALSE), loaded(VK_FALSE)
+{
+}
+
+SceneStream::~SceneStream()
+{
+    destroy();
+}
+
+//
+// ISceneStream
+//
+
+ISceneSP SceneStream::getScene() const
+{
+    std::lock_guard<std::mutex> sceneStreamLockGuard(sceneStreamMutex);
+
+    return scene;
+}
+
+VkBool32 SceneStream::update()
+{
+    auto currentScene = getScene();
+
+    if (!currentScene.get())
+    {
+        return VK_FALSE;
+    }
+
+    // Functions executed retire frames ago are released, as no command buffer uses their replaced objects anymore.
+
+    auto& retiringFunctions = allRetiringFunctions[updateCount % allRetiringFunctions.size()];
+
+    retiringFunctions.clear();
+
+    updateCount++;
+
+    //
+
+    VkBool32 changed = VK_FALSE;
+
+    SceneStreamFunction function;
+
+    while (allFunctions.take(function))
+    {
+        function(currentScene);
+
+        retiringFunctions.push_back(function);
+
+        changed = VK_TRUE;
+    }
+
+    return changed;
+}
+
+void SceneStream::setDescriptorSets(const uint32_t bufferCount, const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const SceneStreamDescriptorSetsFunction& function)
+{
+    this->bufferCount = bufferCount;
+    this->allWriteDescriptorSetsCount = allWriteDescriptorSetsCount;
+    this->allWriteDescriptorSets = allWriteDescriptorSets;
+    this->descriptorSetsFunction = function;
+}
+
+VkBool32 SceneStream::updateDescriptorSets(const IObjectSP& object)
+{
+    if (!object.get())
+    {
+        return VK_FALSE;
+    }
+
+    if (!descriptorSetsFunction || !allWriteDescriptorSets)
+    {
+        return VK_TRUE;
+    }
+
+    for (uint32_t i = 0; i < bufferCount; i++)
+    {
+        if (!descriptorSetsFunction(i))
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not prepare descriptor sets of buffer %u", i);
+
+            return VK_FALSE;
+        }
+
+        object->updateDescriptorSetsRecursive(allWriteDescriptorSetsCount, allWriteDescriptorSets, i);
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 SceneStream::isFinished() const
+{
+    std::lock_guard<std::mutex> sceneStreamLockGuard(sceneStreamMutex);
+
+    return finished && allFunctions.empty();
+}
+
+VkBool32 SceneStream::isLoaded() const
+{
+    std::lock_guard<std::mutex> sceneStreamLockGuard(sceneStreamMutex);
+
+    return loaded;
+}
+
+void SceneStream::setScene(const ISceneSP& scene)
+{
+    std::lock_guard<std::mutex> sceneStreamLockGuard(sceneStreamMutex);
+
+    this->scene = scene;
+}
+
+void SceneStream::publish(const SceneStreamFunction& function)
+{
+    if (!function)
+    {
+        return;
+    }
+
+    allFunctions.add(function);
+}
+
+void SceneStream::finish(const VkBool32 loaded)
+{
+    std::lock_guard<std::mutex> sceneStreamLockGuard(sceneStreamMutex);
+
+    this->finished = VK_TRUE;
+    this->loaded = loaded;
+}
+
+//
+// IDestroyable
+//
+
+void SceneStream::destroy()
+{
+    SceneStreamFunction function;
+
+    while (allFunctions.take(function))
+    {
+        // Discard unexecuted changes.
+    }
+
+    descriptorSetsFunction = SceneStreamDescriptorSetsFunction();
+
+    // Device has to be idle.
+
+    for (auto& retiringFunctions : allRetiringFunctions)
+    {
+        retiringFunctions.clear();
+    }
+
+    std::lock_guard<std::mutex> sceneStreamLockGuard(sceneStreamMutex);
+
+    scene.reset();
+}
+
+} /* namespace vkts */
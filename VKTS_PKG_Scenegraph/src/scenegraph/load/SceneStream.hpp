@@ -0,0 +1,104 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_SCENESTREAM_HPP_
+#define VKTS_SCENESTREAM_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+namespace vkts
+{
+
+class SceneStream: public ISceneStream
+{
+
+protected:
+
+    mutable std::mutex sceneStreamMutex;
+
+    ISceneSP scene;
+
+    ThreadsafeQueue<SceneStreamFunction> allFunctions;
+
+    // Only accessed by the render thread. Indexed by the update count modulo the retire frames plus one.
+    std::vector<std::vector<SceneStreamFunction>> allRetiringFunctions;
+
+    uint64_t updateCount;
+
+    // Only accessed by the render thread.
+    uint32_t bufferCount;
+    uint32_t allWriteDescriptorSetsCount;
+    VkWriteDescriptorSet* allWriteDescriptorSets;
+    SceneStreamDescriptorSetsFunction descriptorSetsFunction;
+
+    VkBool32 finished;
+
+    VkBool32 loaded;
+
+public:
+
+    SceneStream() = delete;
+    explicit SceneStream(const uint32_t retireFrames);
+    SceneStream(const SceneStream& other) = delete;
+    SceneStream(SceneStream&& other) = delete;
+    virtual ~SceneStream();
+
+    SceneStream& operator =(const SceneStream& other) = delete;
+    SceneStream& operator =(SceneStream&& other) = delete;
+
+    //
+    // ISceneStream
+    //
+
+    virtual ISceneSP getScene() const override;
+
+    virtual VkBool32 update() override;
+
+    virtual void setDescriptorSets(const uint32_t bufferCount, const uint32_t allWriteDescriptorSetsCount, VkWriteDescriptorSet* allWriteDescriptorSets, const SceneStreamDescriptorSetsFunction& function) override;
+
+    virtual VkBool32 updateDescriptorSets(const IObjectSP& object) override;
+
+    virtual VkBool32 isFinished() const override;
+
+    virtual VkBool32 isLoaded() const override;
+
+    virtual void setScene(const ISceneSP& scene) override;
+
+    virtual void publish(const SceneStreamFunction& function) override;
+
+    virtual void finish(const VkBool32 loaded) override;
+
+    //
+    // IDestroyable
+    //
+
+    virtual void destroy() override;
+
+};
+
+} /* namespace vkts */
+
+#endif /* VKTS_SCENESTREAM_HPP_ */
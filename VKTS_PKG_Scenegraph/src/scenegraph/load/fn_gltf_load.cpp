@@ -26,6 +26,7 @@
 
 #include <vkts/scenegraph/vkts_scenegraph.hpp>
 
+#include "GltfHandler.hpp"
 #include "GltfVisitor.hpp"
 
 #define VKTS_GLTF_FORWARD_FRAGMENT_SHADER_NAME "shader/SPIR/V/glTF_forward.frag.spv"
@@ -1382,37 +1383,78 @@ static VkBool32 gltfProcessObject(IObjectSP& object, const GltfVisitor& visitor,
 	return VK_TRUE;
 }
 
+static VkBool32 gltfVisit(GltfVisitor& visitor, const ITextBufferSP& textFile)
+{
+	// Collect the text of the top level members. Their values are only scanned, but not decoded.
+
+	GltfHandler collectHandler(visitor);
+
+	if (!jsonRead(textFile->getString(), textFile->getLength(), collectHandler))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Parsing JSON failed");
+
+		return VK_FALSE;
+	}
+
+	// The members have to be visited in dependency order. Each member is decoded once from its text, independent of the order in the file.
+
+	for (uint32_t memberIndex = 0; memberIndex < GltfVisitor::getMemberCount(); memberIndex++)
+	{
+		const auto& memberText = collectHandler.getAllMemberTexts()[memberIndex];
+
+		if (!memberText.jsonText)
+		{
+			continue;
+		}
+
+		GltfHandler visitHandler(visitor, memberIndex);
+
+		if (!jsonRead(memberText.jsonText, memberText.length, visitHandler))
+		{
+			// Errors of the visitor are processed by the caller.
+			if (visitor.getState() == GltfState_Error)
+			{
+				return VK_TRUE;
+			}
+
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Parsing JSON failed");
+
+			return VK_FALSE;
+		}
+	}
+
+	visitor.visitEnd();
+
+	return VK_TRUE;
+}
 
 ISceneSP VKTS_APIENTRY gltfLoad(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory)
 {
+    VKTS_PROFILE_ZONE("gltfLoad");
+
     if (!filename || !sceneManager.get() || !sceneFactory.get())
     {
         return ISceneSP();
     }
 
-	auto textFile = fileLoadText(filename);
+	auto textFile = fileMapText(filename);
 
 	if (!textFile.get())
 	{
 		return ISceneSP();
 	}
 
-	auto json = jsonDecode(textFile->getString());
-
-	if (!json.get())
-	{
-		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Parsing JSON failed");
-
-		return ISceneSP();
-	}
-
     char directory[VKTS_MAX_BUFFER_CHARS] = "";
 
     fileGetDirectory(directory, filename);
 
 	GltfVisitor visitor(directory);
 
-	json->visit(visitor);
+	// The JSON document is streamed into the visitor and not decoded as a whole.
+	if (!gltfVisit(visitor, textFile))
+	{
+		return ISceneSP();
+	}
 
 	if (visitor.getState() != GltfState_End)
 	{
@@ -1527,9 +1569,11 @@ ISceneSP VKTS_APIENTRY gltfLoad(const char* filename, const ISceneManagerSP& sce
     //
     if (freeHostMemory)
     {
-        for (uint32_t i = 0; i < sceneManager->getAllImageDatas().values().size(); i++)
+        const auto allImageDatas = sceneManager->getAllImageDatas();
+
+        for (uint32_t i = 0; i < allImageDatas.values().size(); i++)
         {
-        	sceneManager->getAllImageDatas().values()[i]->freeHostMemory();
+        	allImageDatas.values()[i]->freeHostMemory();
         }
     }
 
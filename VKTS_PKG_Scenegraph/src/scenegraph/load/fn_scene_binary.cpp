@@ -0,0 +1,577 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#include "fn_scene_load_internal.hpp"
+
+#define VKTS_SCENE_BINARY_VERSION 1
+
+#define VKTS_SCENE_BINARY_ALIGNMENT 16
+
+#define VKTS_SCENE_BINARY_SECTION_STRINGS 0
+#define VKTS_SCENE_BINARY_SECTION_MATERIAL_LIBRARIES 1
+#define VKTS_SCENE_BINARY_SECTION_SUB_MESHES 2
+#define VKTS_SCENE_BINARY_SECTION_VERTICES 3
+#define VKTS_SCENE_BINARY_SECTION_INDICES 4
+#define VKTS_SCENE_BINARY_SECTION_COUNT 5
+
+namespace vkts
+{
+
+// All values are stored little endian, as on all supported platforms.
+
+static const char g_sceneBinaryMagic[8] = {'V', 'K', 'T', 'S', 'B', 'I', 'N', '\0'};
+
+typedef struct _SceneBinaryHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint64_t sourceSize;
+    uint64_t sourceHash;
+} SceneBinaryHeader;
+
+typedef struct _SceneBinarySection {
+    uint32_t type;
+    uint32_t count;
+    uint64_t offset;
+    uint64_t size;
+} SceneBinarySection;
+
+// Names are offsets into the string table. Vertex and index bytes are relative to their sections.
+typedef struct _SceneBinarySubMesh {
+    uint32_t name;
+    uint32_t material;
+    uint32_t doubleSided;
+    uint32_t vertexBufferType;
+    uint32_t numberVertices;
+    uint32_t numberIndices;
+    uint32_t strideInBytes;
+    int32_t offsets[10];
+    uint32_t reserved;
+    uint64_t vertexByteOffset;
+    uint64_t vertexByteSize;
+    uint64_t indexByteOffset;
+    uint64_t indexByteSize;
+} SceneBinarySubMesh;
+
+static_assert(sizeof(SceneBinaryHeader) == 32, "Scene binary header has wrong size");
+static_assert(sizeof(SceneBinarySection) == 24, "Scene binary section has wrong size");
+static_assert(sizeof(SceneBinarySubMesh) == 104, "Scene binary sub mesh has wrong size");
+
+static const char* g_sceneLibraryTokens[] = {"object_library", "mesh_library", "submesh_library"};
+
+static const uint32_t g_sceneLibraryLevels = sizeof(g_sceneLibraryTokens) / sizeof(g_sceneLibraryTokens[0]);
+
+static uint64_t sceneAlign(const uint64_t value)
+{
+    return (value + VKTS_SCENE_BINARY_ALIGNMENT - 1) & ~(uint64_t)(VKTS_SCENE_BINARY_ALIGNMENT - 1);
+}
+
+static uint64_t sceneHashText(const ITextBufferSP& textBuffer)
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(textBuffer->getString());
+    const uint64_t length = textBuffer->getLength();
+
+    uint64_t hash = 0xCBF29CE484222325ull ^ length;
+
+    uint64_t i = 0;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t word;
+
+        memcpy(&word, data + i, sizeof(word));
+
+        hash = (hash ^ word) * 0x100000001B3ull;
+        hash ^= hash >> 29;
+    }
+
+    for (; i < length; i++)
+    {
+        hash = (hash ^ (uint64_t)data[i]) * 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+static VkBool32 sceneGetSection(SceneBinarySection& section, const IBinaryBufferSP& binaryBuffer, const uint32_t type)
+{
+    SceneBinaryHeader header;
+
+    memcpy(&header, binaryBuffer->getData(), sizeof(header));
+
+    for (uint32_t i = 0; i < header.sectionCount; i++)
+    {
+        memcpy(&section, static_cast<const uint8_t*>(binaryBuffer->getData()) + sizeof(SceneBinaryHeader) + i * sizeof(SceneBinarySection), sizeof(SceneBinarySection));
+
+        if (section.type == type)
+        {
+            return VK_TRUE;
+        }
+    }
+
+    return VK_FALSE;
+}
+
+static void sceneGetSubMesh(SceneBinarySubMesh& subMesh, const IBinaryBufferSP& binaryBuffer, const SceneBinarySection& subMeshSection, const uint32_t index)
+{
+    memcpy(&subMesh, static_cast<const uint8_t*>(binaryBuffer->getData()) + subMeshSection.offset + index * sizeof(SceneBinarySubMesh), sizeof(SceneBinarySubMesh));
+}
+
+VkBool32 VKTS_APIENTRY _sceneCheckBinary(const IBinaryBufferSP& binaryBuffer, const ITextBufferSP& textBuffer)
+{
+    if (!binaryBuffer.get() || !textBuffer.get() || binaryBuffer->getSize() < sizeof(SceneBinaryHeader))
+    {
+        return VK_FALSE;
+    }
+
+    SceneBinaryHeader header;
+
+    memcpy(&header, binaryBuffer->getData(), sizeof(header));
+
+    if (memcmp(header.magic, g_sceneBinaryMagic, sizeof(g_sceneBinaryMagic)) != 0 || header.version != VKTS_SCENE_BINARY_VERSION)
+    {
+        return VK_FALSE;
+    }
+
+    if (sizeof(SceneBinaryHeader) + (uint64_t)header.sectionCount * sizeof(SceneBinarySection) > binaryBuffer->getSize())
+    {
+        return VK_FALSE;
+    }
+
+    if (header.sourceSize != textBuffer->getLength() || header.sourceHash != sceneHashText(textBuffer))
+    {
+        return VK_FALSE;
+    }
+
+    SceneBinarySection allSections[VKTS_SCENE_BINARY_SECTION_COUNT];
+
+    for (uint32_t type = 0; type < VKTS_SCENE_BINARY_SECTION_COUNT; type++)
+    {
+        if (!sceneGetSection(allSections[type], binaryBuffer, type))
+        {
+            return VK_FALSE;
+        }
+
+        if (allSections[type].offset > binaryBuffer->getSize() || allSections[type].size > binaryBuffer->getSize() - allSections[type].offset)
+        {
+            return VK_FALSE;
+        }
+    }
+
+    const auto& stringSection = allSections[VKTS_SCENE_BINARY_SECTION_STRINGS];
+    const auto& materialLibrarySection = allSections[VKTS_SCENE_BINARY_SECTION_MATERIAL_LIBRARIES];
+    const auto& subMeshSection = allSections[VKTS_SCENE_BINARY_SECTION_SUB_MESHES];
+    const auto& vertexSection = allSections[VKTS_SCENE_BINARY_SECTION_VERTICES];
+    const auto& indexSection = allSections[VKTS_SCENE_BINARY_SECTION_INDICES];
+
+    // All strings are zero terminated, so it is sufficient, that the string table ends with zero.
+    if (stringSection.size == 0 || static_cast<const uint8_t*>(binaryBuffer->getData())[stringSection.offset + stringSection.size - 1] != '\0')
+    {
+        return VK_FALSE;
+    }
+
+    if (materialLibrarySection.size != (uint64_t)materialLibrarySection.count * sizeof(uint32_t) || subMeshSection.size != (uint64_t)subMeshSection.count * sizeof(SceneBinarySubMesh))
+    {
+        return VK_FALSE;
+    }
+
+    for (uint32_t i = 0; i < materialLibrarySection.count; i++)
+    {
+        uint32_t materialLibrary;
+
+        memcpy(&materialLibrary, static_cast<const uint8_t*>(binaryBuffer->getData()) + materialLibrarySection.offset + i * sizeof(uint32_t), sizeof(uint32_t));
+
+        if (materialLibrary >= stringSection.size)
+        {
+            return VK_FALSE;
+        }
+    }
+
+    for (uint32_t i = 0; i < subMeshSection.count; i++)
+    {
+        SceneBinarySubMesh subMesh;
+
+        sceneGetSubMesh(subMesh, binaryBuffer, subMeshSection, i);
+
+        if (subMesh.name >= stringSection.size || subMesh.material >= stringSection.size)
+        {
+            return VK_FALSE;
+        }
+
+        if (subMesh.numberVertices == 0 || subMesh.numberIndices == 0 || subMesh.vertexByteSize != (uint64_t)subMesh.numberVertices * subMesh.strideInBytes || subMesh.indexByteSize != (uint64_t)subMesh.numberIndices * sizeof(int32_t))
+        {
+            return VK_FALSE;
+        }
+
+        if (subMesh.vertexByteOffset > vertexSection.size || subMesh.vertexByteSize > vertexSection.size - subMesh.vertexByteOffset)
+        {
+            return VK_FALSE;
+        }
+
+        if (subMesh.indexByteOffset > indexSection.size || subMesh.indexByteSize > indexSection.size - subMesh.indexByteOffset)
+        {
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY _sceneReadBinary(const IBinaryBufferSP& binaryBuffer, const SceneMaterialLibraryFunction& materialLibraryFunction, const SceneSubMeshFunction& subMeshFunction)
+{
+    if (!binaryBuffer.get())
+    {
+        return VK_FALSE;
+    }
+
+    SceneBinarySection stringSection;
+    SceneBinarySection materialLibrarySection;
+    SceneBinarySection subMeshSection;
+    SceneBinarySection vertexSection;
+    SceneBinarySection indexSection;
+
+    if (!sceneGetSection(stringSection, binaryBuffer, VKTS_SCENE_BINARY_SECTION_STRINGS) || !sceneGetSection(materialLibrarySection, binaryBuffer, VKTS_SCENE_BINARY_SECTION_MATERIAL_LIBRARIES) || !sceneGetSection(subMeshSection, binaryBuffer, VKTS_SCENE_BINARY_SECTION_SUB_MESHES) || !sceneGetSection(vertexSection, binaryBuffer, VKTS_SCENE_BINARY_SECTION_VERTICES) || !sceneGetSection(indexSection, binaryBuffer, VKTS_SCENE_BINARY_SECTION_INDICES))
+    {
+        return VK_FALSE;
+    }
+
+    const char* allStrings = reinterpret_cast<const char*>(static_cast<const uint8_t*>(binaryBuffer->getData()) + stringSection.offset);
+
+    for (uint32_t i = 0; i < materialLibrarySection.count; i++)
+    {
+        uint32_t materialLibrary;
+
+        memcpy(&materialLibrary, static_cast<const uint8_t*>(binaryBuffer->getData()) + materialLibrarySection.offset + i * sizeof(uint32_t), sizeof(uint32_t));
+
+        if (!materialLibraryFunction(allStrings + materialLibrary))
+        {
+            return VK_FALSE;
+        }
+    }
+
+    SceneSubMeshData subMeshData;
+
+    for (uint32_t i = 0; i < subMeshSection.count; i++)
+    {
+        SceneBinarySubMesh subMesh;
+
+        sceneGetSubMesh(subMesh, binaryBuffer, subMeshSection, i);
+
+        subMeshData.name = allStrings + subMesh.name;
+        subMeshData.material = allStrings + subMesh.material;
+        subMeshData.doubleSided = subMesh.doubleSided ? VK_TRUE : VK_FALSE;
+
+        subMeshData.vertexBufferType = subMesh.vertexBufferType;
+        subMeshData.numberVertices = (int32_t)subMesh.numberVertices;
+        subMeshData.numberIndices = (int32_t)subMesh.numberIndices;
+        subMeshData.strideInBytes = subMesh.strideInBytes;
+
+        subMeshData.vertexOffset = subMesh.offsets[0];
+        subMeshData.normalOffset = subMesh.offsets[1];
+        subMeshData.bitangentOffset = subMesh.offsets[2];
+        subMeshData.tangentOffset = subMesh.offsets[3];
+        subMeshData.texcoordOffset = subMesh.offsets[4];
+        subMeshData.boneIndices0Offset = subMesh.offsets[5];
+        subMeshData.boneIndices1Offset = subMesh.offsets[6];
+        subMeshData.boneWeights0Offset = subMesh.offsets[7];
+        subMeshData.boneWeights1Offset = subMesh.offsets[8];
+        subMeshData.numberBonesOffset = subMesh.offsets[9];
+
+        // No copy, the views are uploaded directly out of the mapped file.
+
+        subMeshData.vertexBinaryBuffer = binaryBufferCreateView(binaryBuffer, vertexSection.offset + subMesh.vertexByteOffset, subMesh.vertexByteSize);
+        subMeshData.indicesBinaryBuffer = binaryBufferCreateView(binaryBuffer, indexSection.offset + subMesh.indexByteOffset, subMesh.indexByteSize);
+
+        if (!subMeshData.vertexBinaryBuffer.get() || !subMeshData.indicesBinaryBuffer.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create sub mesh views: '%s'", subMeshData.name.c_str());
+
+            return VK_FALSE;
+        }
+
+        if (!subMeshFunction(subMeshData))
+        {
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY _sceneCreateBinary(std::vector<uint8_t>& data, const ITextBufferSP& textBuffer, const std::vector<std::string>& allMaterialLibraries, const std::vector<SceneSubMeshData>& allSubMeshData)
+{
+    if (!textBuffer.get())
+    {
+        return VK_FALSE;
+    }
+
+    std::string allStrings;
+
+    auto addString = [&allStrings](const std::string& value) -> uint32_t
+    {
+        const uint32_t offset = (uint32_t)allStrings.size();
+
+        allStrings.append(value);
+        allStrings.push_back('\0');
+
+        return offset;
+    };
+
+    std::vector<uint32_t> allMaterialLibraryStrings;
+
+    for (const auto& materialLibrary : allMaterialLibraries)
+    {
+        allMaterialLibraryStrings.push_back(addString(materialLibrary));
+    }
+
+    std::vector<SceneBinarySubMesh> allSubMeshes(allSubMeshData.size());
+
+    uint64_t vertexSize = 0;
+    uint64_t indexSize = 0;
+
+    for (size_t i = 0; i < allSubMeshData.size(); i++)
+    {
+        const auto& subMeshData = allSubMeshData[i];
+        auto& subMesh = allSubMeshes[i];
+
+        if (!subMeshData.vertexBinaryBuffer.get() || !subMeshData.indicesBinaryBuffer.get())
+        {
+            return VK_FALSE;
+        }
+
+        memset(&subMesh, 0, sizeof(SceneBinarySubMesh));
+
+        subMesh.name = addString(subMeshData.name);
+        subMesh.material = addString(subMeshData.material);
+        subMesh.doubleSided = subMeshData.doubleSided ? 1 : 0;
+
+        subMesh.vertexBufferType = subMeshData.vertexBufferType;
+        subMesh.numberVertices = (uint32_t)subMeshData.numberVertices;
+        subMesh.numberIndices = (uint32_t)subMeshData.numberIndices;
+        subMesh.strideInBytes = subMeshData.strideInBytes;
+
+        subMesh.offsets[0] = subMeshData.vertexOffset;
+        subMesh.offsets[1] = subMeshData.normalOffset;
+        subMesh.offsets[2] = subMeshData.bitangentOffset;
+        subMesh.offsets[3] = subMeshData.tangentOffset;
+        subMesh.offsets[4] = subMeshData.texcoordOffset;
+        subMesh.offsets[5] = subMeshData.boneIndices0Offset;
+        subMesh.offsets[6] = subMeshData.boneIndices1Offset;
+        subMesh.offsets[7] = subMeshData.boneWeights0Offset;
+        subMesh.offsets[8] = subMeshData.boneWeights1Offset;
+        subMesh.offsets[9] = subMeshData.numberBonesOffset;
+
+        subMesh.vertexByteOffset = vertexSize;
+        subMesh.vertexByteSize = subMeshData.vertexBinaryBuffer->getSize();
+
+        vertexSize = sceneAlign(vertexSize + subMesh.vertexByteSize);
+
+        subMesh.indexByteOffset = indexSize;
+        subMesh.indexByteSize = subMeshData.indicesBinaryBuffer->getSize();
+
+        indexSize = sceneAlign(indexSize + subMesh.indexByteSize);
+    }
+
+    if (allStrings.size() == 0)
+    {
+        allStrings.push_back('\0');
+    }
+
+    //
+
+    SceneBinarySection allSections[VKTS_SCENE_BINARY_SECTION_COUNT];
+
+    allSections[VKTS_SCENE_BINARY_SECTION_STRINGS] = {VKTS_SCENE_BINARY_SECTION_STRINGS, (uint32_t)allStrings.size(), 0, allStrings.size()};
+    allSections[VKTS_SCENE_BINARY_SECTION_MATERIAL_LIBRARIES] = {VKTS_SCENE_BINARY_SECTION_MATERIAL_LIBRARIES, (uint32_t)allMaterialLibraryStrings.size(), 0, allMaterialLibraryStrings.size() * sizeof(uint32_t)};
+    allSections[VKTS_SCENE_BINARY_SECTION_SUB_MESHES] = {VKTS_SCENE_BINARY_SECTION_SUB_MESHES, (uint32_t)allSubMeshes.size(), 0, allSubMeshes.size() * sizeof(SceneBinarySubMesh)};
+    allSections[VKTS_SCENE_BINARY_SECTION_VERTICES] = {VKTS_SCENE_BINARY_SECTION_VERTICES, 0, 0, vertexSize};
+    allSections[VKTS_SCENE_BINARY_SECTION_INDICES] = {VKTS_SCENE_BINARY_SECTION_INDICES, 0, 0, indexSize};
+
+    uint64_t totalSize = sceneAlign(sizeof(SceneBinaryHeader) + sizeof(allSections));
+
+    for (uint32_t type = 0; type < VKTS_SCENE_BINARY_SECTION_COUNT; type++)
+    {
+        allSections[type].offset = totalSize;
+
+        totalSize = sceneAlign(totalSize + allSections[type].size);
+    }
+
+    if (totalSize > (uint64_t)UINT32_MAX)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Binary sub meshes too large");
+
+        return VK_FALSE;
+    }
+
+    //
+
+    data.assign((size_t)totalSize, 0);
+
+    SceneBinaryHeader header;
+
+    memcpy(header.magic, g_sceneBinaryMagic, sizeof(g_sceneBinaryMagic));
+    header.version = VKTS_SCENE_BINARY_VERSION;
+    header.sectionCount = VKTS_SCENE_BINARY_SECTION_COUNT;
+    header.sourceSize = textBuffer->getLength();
+    header.sourceHash = sceneHashText(textBuffer);
+
+    memcpy(&data[0], &header, sizeof(header));
+    memcpy(&data[sizeof(header)], allSections, sizeof(allSections));
+
+    memcpy(&data[(size_t)allSections[VKTS_SCENE_BINARY_SECTION_STRINGS].offset], allStrings.c_str(), allStrings.size());
+
+    if (allMaterialLibraryStrings.size() > 0)
+    {
+        memcpy(&data[(size_t)allSections[VKTS_SCENE_BINARY_SECTION_MATERIAL_LIBRARIES].offset], &allMaterialLibraryStrings[0], allMaterialLibraryStrings.size() * sizeof(uint32_t));
+    }
+
+    if (allSubMeshes.size() > 0)
+    {
+        memcpy(&data[(size_t)allSections[VKTS_SCENE_BINARY_SECTION_SUB_MESHES].offset], &allSubMeshes[0], allSubMeshes.size() * sizeof(SceneBinarySubMesh));
+    }
+
+    for (size_t i = 0; i < allSubMeshes.size(); i++)
+    {
+        memcpy(&data[(size_t)(allSections[VKTS_SCENE_BINARY_SECTION_VERTICES].offset + allSubMeshes[i].vertexByteOffset)], allSubMeshData[i].vertexBinaryBuffer->getData(), (size_t)allSubMeshes[i].vertexByteSize);
+        memcpy(&data[(size_t)(allSections[VKTS_SCENE_BINARY_SECTION_INDICES].offset + allSubMeshes[i].indexByteOffset)], allSubMeshData[i].indicesBinaryBuffer->getData(), (size_t)allSubMeshes[i].indexByteSize);
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY _sceneWriteBinary(const char* filename, const ITextBufferSP& textBuffer, const std::vector<std::string>& allMaterialLibraries, const std::vector<SceneSubMeshData>& allSubMeshData)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<uint8_t> data;
+
+    if (!_sceneCreateBinary(data, textBuffer, allMaterialLibraries, allSubMeshData))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create binary sub meshes: '%s'", filename);
+
+        return VK_FALSE;
+    }
+
+    return fileSaveBinaryData(filename, &data[0], (uint32_t)data.size());
+}
+
+static VkBool32 sceneSaveBinaryLibraries(const char* directory, const char* filename, const uint32_t level)
+{
+    // Only the libraries are relative to the directory of the scene.
+    std::string finalFilename = level == 0 ? std::string(filename) : std::string(directory) + std::string(filename);
+
+    auto textBuffer = fileMapText(finalFilename.c_str());
+
+    if (!textBuffer.get())
+    {
+        finalFilename = filename;
+
+        textBuffer = fileMapText(filename);
+
+        if (!textBuffer.get())
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load: '%s'", filename);
+
+            return VK_FALSE;
+        }
+    }
+
+    if (level == g_sceneLibraryLevels)
+    {
+        std::vector<std::string> allMaterialLibraries;
+        std::vector<SceneSubMeshData> allSubMeshData;
+
+        auto materialLibraryFunction = [&allMaterialLibraries](const char* materialLibrary) -> VkBool32
+        {
+            allMaterialLibraries.push_back(materialLibrary);
+
+            return VK_TRUE;
+        };
+
+        auto subMeshFunction = [&allSubMeshData](const SceneSubMeshData& subMeshData) -> VkBool32
+        {
+            allSubMeshData.push_back(subMeshData);
+
+            return VK_TRUE;
+        };
+
+        if (!_sceneParseSubMeshes(textBuffer, materialLibraryFunction, subMeshFunction))
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not parse sub meshes: '%s'", filename);
+
+            return VK_FALSE;
+        }
+
+        return _sceneWriteBinary((finalFilename + VKTS_SCENE_BINARY_SUFFIX).c_str(), textBuffer, allMaterialLibraries, allSubMeshData);
+    }
+
+    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
+
+    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    {
+        if (parseSkipBuffer(buffer))
+        {
+            continue;
+        }
+
+        if (parseIsToken(buffer, g_sceneLibraryTokens[level]))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (!sceneSaveBinaryLibraries(directory, sdata, level + 1))
+            {
+                return VK_FALSE;
+            }
+        }
+    }
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY sceneSaveBinary(const char* filename)
+{
+    if (!filename)
+    {
+        return VK_FALSE;
+    }
+
+    char directory[VKTS_MAX_BUFFER_CHARS] = "";
+
+    fileGetDirectory(directory, filename);
+
+    return sceneSaveBinaryLibraries(directory, filename, 0);
+}
+
+}
@@ -26,10 +26,130 @@
 
 #include <vkts/scenegraph/vkts_scenegraph.hpp>
 
+#include "fn_scene_load_internal.hpp"
+
 namespace vkts
 {
 
-static VkBool32 sceneLoadImageObjects(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+IImageDataSP VKTS_APIENTRY _sceneLoadImageData(const char* directory, const char* imageDataFilename)
+{
+    if (!directory || !imageDataFilename)
+    {
+        return IImageDataSP();
+    }
+
+    std::string finalImageDataFilename = std::string(directory) + std::string(imageDataFilename);
+
+    auto imageData = imageDataLoad(finalImageDataFilename.c_str());
+
+    if (!imageData.get())
+    {
+        std::string textureImageDataFilename = std::string(VKTS_TEXTURE_DIRECTORY) + std::string(imageDataFilename);
+
+        imageData = imageDataLoad(textureImageDataFilename.c_str());
+
+        if (!imageData.get())
+        {
+            imageData = imageDataLoad(imageDataFilename);
+        }
+    }
+
+    return imageData;
+}
+
+/**
+ * Color data is filtered in linear space. Float images are already linear.
+ */
+static enum VkTsImageDataType sceneGetImageDataType(const IImageDataSP& imageData, const VkBool32 colorData)
+{
+	if (!colorData)
+	{
+		return VKTS_NON_COLOR_DATA;
+	}
+
+	return imageDataIsSFLOAT(imageData->getFormat()) ? VKTS_HDR_COLOR_DATA : VKTS_LDR_COLOR_DATA;
+}
+
+/**
+ * Float images are encoded to BC6H, all others to BC7. SRGB images get the SRGB variant.
+ */
+static VkFormat sceneGetEncodeFormat(const IImageDataSP& imageData, const VkBool32 encode)
+{
+	if (!encode)
+	{
+		return VK_FORMAT_UNDEFINED;
+	}
+
+	return imageDataIsSFLOAT(imageData->getFormat()) ? VK_FORMAT_BC6H_UFLOAT_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+}
+
+/**
+ * Loads the mip levels from the cache or creates them. All levels are converted for the device and encoded, if requested.
+ */
+static VkBool32 sceneCreateMipMaps(SmartPointerVector<IImageDataSP>& allMipMaps, const IImageDataSP& imageData, const enum VkTsImageDataType imageDataType, const VkFormat encodeFormat, const std::string& finalImageDataFilename, const ISceneManagerSP& sceneManager)
+{
+	uint64_t key = 0;
+
+	if (cacheGetEnabled())
+	{
+		key = cacheCreateKey(imageData, imageDataType == VKTS_LDR_COLOR_DATA ? "MIPMAP_BOX_COLOR" : "MIPMAP_BOX");
+
+		// Only mip maps sub levels are cached.
+
+		auto allSubLevels = cacheLoadImageDatas(key);
+
+		if (allSubLevels.size() > 0)
+		{
+			allMipMaps.append(imageData);
+
+			for (uint32_t i = 0; i < allSubLevels.size(); i++)
+			{
+				allMipMaps.append(allSubLevels[i]);
+			}
+		}
+	}
+
+	//
+
+	if (allMipMaps.size() == 0)
+	{
+		allMipMaps = imageDataMipmap(imageData, VK_FALSE, finalImageDataFilename, VKTS_MIPMAP_FILTER_BOX, imageDataType);
+
+		if (allMipMaps.size() == 0)
+		{
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
+
+			return VK_FALSE;
+		}
+
+		if (cacheGetEnabled() && allMipMaps.size() > 1)
+		{
+			logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
+
+			SmartPointerVector<IImageDataSP> allSubLevels;
+
+			for (uint32_t i = 1; i < allMipMaps.size(); i++)
+			{
+				allSubLevels.append(allMipMaps[i]);
+			}
+
+			cacheSaveImageDatas(key, allSubLevels);
+		}
+	}
+	else
+	{
+		logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
+	}
+
+	for (uint32_t i = 0; i < allMipMaps.size(); i++)
+	{
+		allMipMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allMipMaps[i], encodeFormat);
+	}
+
+	return VK_TRUE;
+}
+
+static VkBool32 sceneLoadImageObjects(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ScenePrefetch* prefetch)
 {
     if (!directory || !filename || !sceneManager.get())
     {
@@ -58,6 +178,8 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
     VkBool32 mipMap = VK_FALSE;
     VkBool32 environment = VK_FALSE;
     VkBool32 preFiltered = VK_FALSE;
+    VkBool32 colorData = VK_FALSE;
+    VkBool32 encode = VK_FALSE;
     IImageDataSP imageData;
 
     while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
@@ -80,6 +202,8 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
             mipMap = VK_FALSE;
             environment = VK_FALSE;
             preFiltered = VK_FALSE;
+            colorData = VK_FALSE;
+            encode = VK_FALSE;
         }
         else if (parseIsToken(buffer, "mipmap"))
         {
@@ -108,6 +232,24 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
             preFiltered = bdata;
         }
+        else if (parseIsToken(buffer, "color_data"))
+        {
+            if (!parseBool(buffer, &bdata))
+            {
+                return VK_FALSE;
+            }
+
+            colorData = bdata;
+        }
+        else if (parseIsToken(buffer, "encode"))
+        {
+            if (!parseBool(buffer, &bdata))
+            {
+                return VK_FALSE;
+            }
+
+            encode = bdata;
+        }
         else if (parseIsToken(buffer, "image_data"))
         {
             if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
@@ -136,6 +278,21 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 				return VK_FALSE;
 			}
 
+			// Environments are needed for the lighting from the start, so only the others are streamed.
+
+			if (prefetch && prefetch->allStreamImages && !environment)
+			{
+				auto& streamImage = (*prefetch->allStreamImages)[imageObjectName];
+
+				streamImage.imageObjectName = imageObjectName;
+				streamImage.imageDataFilename = imageDataFilename;
+				streamImage.mipMap = mipMap;
+				streamImage.colorData = colorData;
+				streamImage.encode = encode;
+
+				continue;
+			}
+
 			//
 
 			std::string finalImageDataFilename = directory + imageDataFilename;
@@ -148,26 +305,27 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 				if (!imageData.get())
 				{
-					// Load image data.
+					// Load image data, if not already decoded in advance.
 
-					imageData = imageDataLoad(finalImageDataFilename.c_str());
+					if (prefetch)
+					{
+						auto index = prefetch->allImageData.find(imageDataFilename);
+
+						if (index != prefetch->allImageData.size())
+						{
+							imageData = prefetch->allImageData.valueAt(index);
+						}
+					}
 
 					if (!imageData.get())
 					{
-						std::string textureImageDataFilename = std::string(VKTS_TEXTURE_DIRECTORY) + imageDataFilename;
-
-						imageData = imageDataLoad(textureImageDataFilename.c_str());
+						imageData = _sceneLoadImageData(directory, imageDataFilename.c_str());
 
 						if (!imageData.get())
 						{
-							imageData = imageDataLoad(imageDataFilename.c_str());
-
-							if (!imageData.get())
-							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load image data '%s'", finalImageDataFilename.c_str());
+							logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load image data '%s'", finalImageDataFilename.c_str());
 
-								return VK_FALSE;
-							}
+							return VK_FALSE;
 						}
 					}
 
@@ -179,89 +337,11 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 						// Mip map image creation.
 						//
 
-						auto dotIndex = finalImageDataFilename.rfind(".");
-
-						if (dotIndex == finalImageDataFilename.npos)
-						{
-							logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No valid image filename '%s'", finalImageDataFilename.c_str());
-
-							return VK_FALSE;
-						}
-
-						auto sourceImageName = finalImageDataFilename.substr(0, dotIndex);
-						auto sourceImageExtension = finalImageDataFilename.substr(dotIndex);
-
-						int32_t width = imageData->getWidth();
-						int32_t height = imageData->getHeight();
-						int32_t depth = imageData->getDepth();
-
 						SmartPointerVector<IImageDataSP> allMipMaps;
 
-						if (cacheGetEnabled())
-						{
-							allMipMaps.append(imageData);
-
-							int32_t level = 1;
-
-							while (width > 1 || height > 1 || depth > 1)
-							{
-								width = glm::max(width / 2, 1);
-								height = glm::max(height / 2, 1);
-								depth = glm::max(depth / 2, 1);
-
-								auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level++) + sourceImageExtension;
-
-								auto targetImage = cacheLoadImageData(targetImageFilename.c_str());
-
-								if (!targetImage.get())
-								{
-									allMipMaps.clear();
-
-									break;
-								}
-
-								allMipMaps.append(targetImage);
-
-								//
-
-								width = targetImage->getWidth();
-								height = targetImage->getHeight();
-								depth = targetImage->getDepth();
-							}
-						}
-
-						//
-
-						if (allMipMaps.size() == 0)
-						{
-							allMipMaps = imageDataMipmap(imageData, VK_FALSE, finalImageDataFilename);
-
-							if (allMipMaps.size() == 0)
-							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
-
-								return VK_FALSE;
-							}
-
-							if (cacheGetEnabled())
-							{
-								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
-
-								// Only cache mip maps sub levels.
-								for (uint32_t i = 1; i < allMipMaps.size(); i++)
-								{
-									cacheSaveImageData(allMipMaps[i]);
-								}
-							}
-						}
-						else
-						{
-							logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
-						}
-
-						for (uint32_t i = 0; i < allMipMaps.size(); i++)
+						if (!sceneCreateMipMaps(allMipMaps, imageData, sceneGetImageDataType(imageData, colorData), sceneGetEncodeFormat(imageData, encode), finalImageDataFilename, sceneManager))
 						{
-							allMipMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allMipMaps[i]);
+							return VK_FALSE;
 						}
 
 						imageData = imageDataMerge(allMipMaps, finalImageDataFilename, allMipMaps.size(), 1);
@@ -279,52 +359,29 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 						// Cube map image creation.
 						//
 
-						auto dotIndex = finalImageDataFilename.rfind(".");
-
-						if (dotIndex == finalImageDataFilename.npos)
-						{
-							logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No valid image filename '%s'", finalImageDataFilename.c_str());
-
-							return VK_FALSE;
-						}
+						// All derived data is keyed by the source, so it is hashed only once.
 
-						auto sourceImageName = finalImageDataFilename.substr(0, dotIndex);
-						auto sourceImageExtension = finalImageDataFilename.substr(dotIndex);
+						uint64_t sourceKey = cacheGetEnabled() ? cacheCreateKey(imageData, "") : 0;
 
 						if (imageData->getArrayLayers() % 6 != 0)
 						{
-							SmartPointerVector<IImageDataSP> allCubeMaps;
+							IImageDataSP cubeMap;
+
+							uint64_t cubeMapKey = cacheCreateKey(sourceKey, "CUBEMAP_CHAIN_BOX_COLOR");
 
 							if (cacheGetEnabled())
 							{
-								uint32_t levelCount = (uint32_t)log2f((float)(imageData->getHeight()));
+								auto allCubeMaps = cacheLoadImageDatas(cubeMapKey);
 
-								if (cacheGetEnabled())
+								if (allCubeMaps.size() == 1 && allCubeMaps[0]->getArrayLayers() == 6)
 								{
-									for (uint32_t layer = 0; layer < 6; layer++)
-									{
-										for (uint32_t level = 0; level < levelCount; level++)
-										{
-											auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level) + "_LAYER" + std::to_string(layer) + sourceImageExtension;
-
-											auto targetImageData = cacheLoadImageData(targetImageFilename.c_str());
-
-											if (!targetImageData.get())
-											{
-												allCubeMaps.clear();
-
-												break;
-											}
-
-											allCubeMaps.append(targetImageData);
-										}
-									}
+									cubeMap = allCubeMaps[0];
 								}
 							}
 
 							//
 
-							if (allCubeMaps.size() == 0)
+							if (!cubeMap.get())
 							{
 								uint32_t currentMapLength = imageData->getHeight() / 2;
 
@@ -334,44 +391,39 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 									cubeMapLength *= 2;
 								}
 
-								auto oldAllCubeMaps = imageDataCubemap(imageData, cubeMapLength, finalImageDataFilename);
+								// All levels are converted at once, so formats, which are widened for the device, are already created here.
 
-								if (oldAllCubeMaps.size() != 6)
-								{
-									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create cube maps for '%s'", finalImageDataFilename.c_str());
+								VkFormat cubeMapFormat = imageData->getFormat();
 
-									return VK_FALSE;
+								if (cubeMapFormat == VK_FORMAT_R8G8B8_UNORM)
+								{
+									cubeMapFormat = VK_FORMAT_R8G8B8A8_UNORM;
+								}
+								else if (cubeMapFormat == VK_FORMAT_R32G32B32_SFLOAT || cubeMapFormat == VK_FORMAT_R32G32_SFLOAT)
+								{
+									cubeMapFormat = VK_FORMAT_R32G32B32A32_SFLOAT;
 								}
 
-						        for (uint32_t layer = 0; layer < 6; layer++)
-						        {
-									auto tempMipMaps = imageDataMipmap(oldAllCubeMaps[layer], VK_FALSE, finalImageDataFilename);
+								// Environments are always color data.
 
-									if (tempMipMaps.size() == 0)
-									{
-										logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create mip maps for '%s'", finalImageDataFilename.c_str());
+								cubeMap = imageDataCubemapChain(imageData, cubeMapLength, finalImageDataFilename, cubeMapFormat, VKTS_MIPMAP_FILTER_BOX, sceneGetImageDataType(imageData, VK_TRUE));
 
-										return VK_FALSE;
-									}
+								if (!cubeMap.get())
+								{
+									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create cube maps for '%s'", finalImageDataFilename.c_str());
 
-									for (uint32_t mipLevel = 0; mipLevel < tempMipMaps.size(); mipLevel++)
-									{
-										allCubeMaps.append(tempMipMaps[mipLevel]);
-									}
-						        }
+									return VK_FALSE;
+								}
 
 								if (cacheGetEnabled())
 								{
 									logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
 
-									uint32_t mipLevels = allCubeMaps.size() / 6;
+									SmartPointerVector<IImageDataSP> allCubeMaps;
 
-									for (uint32_t i = 0; i < allCubeMaps.size(); i++)
-									{
-										auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(i % mipLevels) + "_LAYER" + std::to_string(i / mipLevels) + sourceImageExtension;
+									allCubeMaps.append(cubeMap);
 
-										cacheSaveImageData(allCubeMaps[i], targetImageFilename);
-									}
+									cacheSaveImageDatas(cubeMapKey, allCubeMaps);
 								}
 							}
 							else
@@ -379,16 +431,11 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 								logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", finalImageDataFilename.c_str());
 							}
 
-							for (uint32_t i = 0; i < allCubeMaps.size(); i++)
-							{
-								allCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allCubeMaps[i]);
-							}
-
-							imageData = imageDataMerge(allCubeMaps, finalImageDataFilename, allCubeMaps.size() / 6, 6);
+							imageData = createDeviceImageData(sceneManager->getAssetManager(), cubeMap);
 
 							if (!imageData.get())
 							{
-								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", finalImageDataFilename.c_str());
+								logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No device image for '%s'", finalImageDataFilename.c_str());
 
 								return VK_FALSE;
 							}
@@ -402,22 +449,19 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 							SmartPointerVector<IImageDataSP> allDiffuseCubeMaps;
 
-							if (cacheGetEnabled())
-							{
-								for (uint32_t layer = 0; layer < 6; layer++)
-								{
-									auto targetImageFilename = sourceImageName + "_LEVEL0_LAYER" + std::to_string(layer) + "_LAMBERT" + sourceImageExtension;
+							// GPU and CPU filtering use a different sample count. The CPU filtering also samples the mip levels of the source.
 
-									auto targetImage = cacheLoadImageData(targetImageFilename.c_str());
+							auto prefilterParameters = sceneFactory->useGPU() ? "GPU_" + std::to_string(VKTS_BSDF_SAMPLES_GPU_CUBE_MAP) : "CPU_LOD_" + std::to_string(VKTS_BSDF_SAMPLES_CPU_CUBE_MAP);
 
-									if (!targetImage.get())
-									{
-										allDiffuseCubeMaps.clear();
+							uint64_t lambertKey = cacheCreateKey(sourceKey, "LAMBERT_" + prefilterParameters);
 
-										break;
-									}
+							if (cacheGetEnabled())
+							{
+								allDiffuseCubeMaps = cacheLoadImageDatas(lambertKey);
 
-									allDiffuseCubeMaps.append(targetImage);
+								if (allDiffuseCubeMaps.size() != 6)
+								{
+									allDiffuseCubeMaps.clear();
 								}
 							}
 
@@ -443,19 +487,7 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 								{
 									logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
 
-									for (uint32_t i = 0; i < allDiffuseCubeMaps.size(); i++)
-									{
-										if (allDiffuseCubeMaps[i]->getFormat() == VK_FORMAT_R32G32B32A32_SFLOAT)
-										{
-											auto tempCubeMap = imageDataConvert(allDiffuseCubeMaps[i], VK_FORMAT_R32G32B32_SFLOAT, allDiffuseCubeMaps[i]->getName());
-
-											cacheSaveImageData(tempCubeMap);
-										}
-										else
-										{
-											cacheSaveImageData(allDiffuseCubeMaps[i]);
-										}
-									}
+									cacheSaveImageDatas(lambertKey, allDiffuseCubeMaps);
 								}
 							}
 							else
@@ -496,40 +528,15 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 							SmartPointerVector<IImageDataSP> allCookTorranceCubeMaps;
 
-							uint32_t levelCount = 1;
+							uint64_t cookTorranceKey = cacheCreateKey(sourceKey, "COOKTORRANCE_" + prefilterParameters);
 
 							if (cacheGetEnabled())
 							{
-								for (uint32_t layer = 0; layer < 6; layer++)
-								{
-									for (uint32_t level = 0; level < levelCount; level++)
-									{
-										auto targetImageFilename = sourceImageName + "_LEVEL" + std::to_string(level) + "_LAYER" + std::to_string(layer) + "_COOKTORRANCE" + sourceImageExtension;
-
-										auto targetImageData = cacheLoadImageData(targetImageFilename.c_str());
-
-										if (!targetImageData.get())
-										{
-											allCookTorranceCubeMaps.clear();
-
-											break;
-										}
-
-										// Gather level count iterations by first image.
-										if (layer == 0 && level == 0)
-										{
-											uint32_t testWidth = targetImageData->getWidth();
+								allCookTorranceCubeMaps = cacheLoadImageDatas(cookTorranceKey);
 
-											while (testWidth > 1)
-											{
-												testWidth /= 2;
-
-												levelCount++;
-											}
-										}
-
-										allCookTorranceCubeMaps.append(targetImageData);
-									}
+								if (allCookTorranceCubeMaps.size() % 6 != 0)
+								{
+									allCookTorranceCubeMaps.clear();
 								}
 							}
 
@@ -551,25 +558,11 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 									return VK_FALSE;
 								}
 
-								levelCount = allCookTorranceCubeMaps.size() / 6;
-
 								if (cacheGetEnabled())
 								{
 									logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", finalImageDataFilename.c_str());
 
-									for (uint32_t i = 0; i < allCookTorranceCubeMaps.size(); i++)
-									{
-										if (allCookTorranceCubeMaps[i]->getFormat() == VK_FORMAT_R32G32B32A32_SFLOAT)
-										{
-											auto tempCubeMap = imageDataConvert(allCookTorranceCubeMaps[i], VK_FORMAT_R32G32B32_SFLOAT, allCookTorranceCubeMaps[i]->getName());
-
-											cacheSaveImageData(tempCubeMap);
-										}
-										else
-										{
-											cacheSaveImageData(allCookTorranceCubeMaps[i]);
-										}
-									}
+									cacheSaveImageDatas(cookTorranceKey, allCookTorranceCubeMaps);
 								}
 							}
 							else
@@ -582,7 +575,7 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 								allCookTorranceCubeMaps[i] = createDeviceImageData(sceneManager->getAssetManager(), allCookTorranceCubeMaps[i]);
 							}
 
-							auto cookTorranceImageData = imageDataMerge(allCookTorranceCubeMaps, finalImageDataFilename, levelCount, 6);
+							auto cookTorranceImageData = imageDataMerge(allCookTorranceCubeMaps, finalImageDataFilename, allCookTorranceCubeMaps.size() / 6, 6);
 
 							if (!cookTorranceImageData.get())
 							{
@@ -614,6 +607,20 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 
 							IImageDataSP lutImageData = imageDataLoadRaw(lutImageFilename.c_str(), VKTS_BSDF_LENGTH, VKTS_BSDF_LENGTH, VK_FORMAT_R32G32_SFLOAT);
 
+							// The look up table has no source data, so it is keyed by its parameters only.
+
+							uint64_t lutKey = cacheCreateKey(nullptr, 0, lutImageObjectName);
+
+							if (!lutImageData.get() && cacheGetEnabled())
+							{
+								auto allLutImageData = cacheLoadImageDatas(lutKey);
+
+								if (allLutImageData.size() == 1)
+								{
+									lutImageData = allLutImageData[0];
+								}
+							}
+
 							if (!lutImageData.get())
 							{
 								lutImageData = imageDataEnvironmentBRDF(VKTS_BSDF_LENGTH, VKTS_BSDF_SAMPLES, "BSDF_LUT.data");
@@ -625,6 +632,15 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 									return VK_FALSE;
 								}
 
+								if (cacheGetEnabled())
+								{
+									SmartPointerVector<IImageDataSP> allLutImageData;
+
+									allLutImageData.append(lutImageData);
+
+									cacheSaveImageDatas(lutKey, allLutImageData);
+								}
+
 								if (!imageDataSave(lutImageFilename.c_str(), lutImageData))
 								{
 									logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not save BSDF lut");
@@ -658,7 +674,7 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
 					}
 					else
 					{
-						imageData = createDeviceImageData(sceneManager->getAssetManager(), imageData);
+						imageData = createDeviceImageData(sceneManager->getAssetManager(), imageData, sceneGetEncodeFormat(imageData, encode));
 
 						if (!imageData.get())
 						{
@@ -696,7 +712,22 @@ static VkBool32 sceneLoadImageObjects(const char* directory, const char* filenam
     return VK_TRUE;
 }
 
-static VkBool32 sceneLoadTextureObjects(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+/**
+ * 1x1 image, which is sampled until a streamed image is uploaded.
+ */
+static IImageObjectSP sceneLoadPlaceholder(const ISceneManagerSP& sceneManager)
+{
+    auto textureObject = createTextureObject(sceneManager->getAssetManager(), VKTS_SCENE_STREAM_PLACEHOLDER_COLOR, VK_FORMAT_R8G8B8A8_UNORM);
+
+    if (!textureObject.get())
+    {
+        return IImageObjectSP();
+    }
+
+    return textureObject->getImageObject();
+}
+
+static VkBool32 sceneLoadTextureObjects(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ScenePrefetch* prefetch)
 {
     if (!directory || !filename || !sceneManager.get())
     {
@@ -743,7 +774,7 @@ static VkBool32 sceneLoadTextureObjects(const char* directory, const char* filen
                 return VK_FALSE;
             }
 
-            if (!sceneLoadImageObjects(directory, sdata, sceneManager, sceneFactory))
+            if (!sceneLoadImageObjects(directory, sdata, sceneManager, sceneFactory, prefetch))
             {
                 logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load images: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
 
@@ -809,7 +840,26 @@ static VkBool32 sceneLoadTextureObjects(const char* directory, const char* filen
 
             //
 
-            imageObject = sceneManager->useImageObject(sdata);
+            SceneStreamImage* streamImage = nullptr;
+
+            if (prefetch && prefetch->allStreamImages)
+            {
+                auto index = prefetch->allStreamImages->find(sdata);
+
+                if (index != prefetch->allStreamImages->size())
+                {
+                    streamImage = &prefetch->allStreamImages->valueAt(index);
+                }
+            }
+
+            if (streamImage)
+            {
+                imageObject = sceneLoadPlaceholder(sceneManager);
+            }
+            else
+            {
+                imageObject = sceneManager->useImageObject(sdata);
+            }
 
 			if (!imageObject.get())
 			{
@@ -834,6 +884,11 @@ static VkBool32 sceneLoadTextureObjects(const char* directory, const char* filen
 
             sceneManager->addTextureObject(textureObject);
 
+            if (streamImage)
+            {
+                streamImage->allTextureObjects.append(textureObject);
+            }
+
             //
 
             if (preFiltered)
@@ -914,7 +969,7 @@ static VkBool32 sceneLoadTextureObjects(const char* directory, const char* filen
     return VK_TRUE;
 }
 
-static VkBool32 sceneLoadMaterials(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+static VkBool32 sceneLoadMaterials(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ScenePrefetch* prefetch)
 {
     if (!directory || !filename || !sceneManager.get())
     {
@@ -960,7 +1015,7 @@ static VkBool32 sceneLoadMaterials(const char* directory, const char* filename,
                 return VK_FALSE;
             }
 
-            if (!sceneLoadTextureObjects(directory, sdata, sceneManager, sceneFactory))
+            if (!sceneLoadTextureObjects(directory, sdata, sceneManager, sceneFactory, prefetch))
             {
                 logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load textureObjects: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
 
@@ -1686,25 +1741,53 @@ static VkBool32 sceneLoadMaterials(const char* directory, const char* filename,
     return VK_TRUE;
 }
 
-static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+static void sceneResetSubMeshData(SceneSubMeshData& subMeshData)
 {
-    if (!directory || !filename || !sceneManager.get())
-    {
-        return VK_FALSE;
-    }
-
-    std::string finalFilename = std::string(directory) + std::string(filename);
-
-    auto textBuffer = fileLoadText(finalFilename.c_str());
+    subMeshData.name = "";
+    subMeshData.material = "";
+    subMeshData.doubleSided = VK_FALSE;
+
+    subMeshData.vertexBufferType = 0;
+    subMeshData.numberVertices = 0;
+    subMeshData.numberIndices = 0;
+    subMeshData.strideInBytes = 0;
+
+    subMeshData.vertexOffset = -1;
+    subMeshData.normalOffset = -1;
+    subMeshData.bitangentOffset = -1;
+    subMeshData.tangentOffset = -1;
+    subMeshData.texcoordOffset = -1;
+    subMeshData.boneIndices0Offset = -1;
+    subMeshData.boneIndices1Offset = -1;
+    subMeshData.boneWeights0Offset = -1;
+    subMeshData.boneWeights1Offset = -1;
+    subMeshData.numberBonesOffset = -1;
+
+    subMeshData.vertexBinaryBuffer = IBinaryBufferSP();
+    subMeshData.indicesBinaryBuffer = IBinaryBufferSP();
+}
 
+#define VKTS_SUB_MESH_TOKEN_MATERIAL_LIBRARY 0
+#define VKTS_SUB_MESH_TOKEN_NAME 1
+#define VKTS_SUB_MESH_TOKEN_DOUBLE_SIDED 2
+#define VKTS_SUB_MESH_TOKEN_VERTEX 3
+#define VKTS_SUB_MESH_TOKEN_NORMAL 4
+#define VKTS_SUB_MESH_TOKEN_BITANGENT 5
+#define VKTS_SUB_MESH_TOKEN_TANGENT 6
+#define VKTS_SUB_MESH_TOKEN_TEXCOORD 7
+#define VKTS_SUB_MESH_TOKEN_BONE_INDEX 8
+#define VKTS_SUB_MESH_TOKEN_BONE_WEIGHT 9
+#define VKTS_SUB_MESH_TOKEN_NUMBER_BONES 10
+#define VKTS_SUB_MESH_TOKEN_FACE 11
+#define VKTS_SUB_MESH_TOKEN_MATERIAL 12
+
+static const ParseTokens g_subMeshTokens({"material_library", "name", "double_sided", "vertex", "normal", "bitangent", "tangent", "texcoord", "boneIndex", "boneWeight", "numberBones", "face", "material"});
+
+VkBool32 VKTS_APIENTRY _sceneParseSubMeshes(const ITextBufferSP& textBuffer, const SceneMaterialLibraryFunction& materialLibraryFunction, const SceneSubMeshFunction& subMeshFunction)
+{
     if (!textBuffer.get())
     {
-        textBuffer = fileLoadText(filename);
-
-        if (!textBuffer.get())
-        {
-            return VK_FALSE;
-        }
+        return VK_FALSE;
     }
 
     char buffer[VKTS_MAX_BUFFER_CHARS + 1];
@@ -1713,7 +1796,9 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
     int32_t idata[3];
     VkBool32 bdata;
 
-    auto subMesh = ISubMeshSP();
+    VkBool32 hasSubMesh = VK_FALSE;
+
+    SceneSubMeshData subMeshData;
 
     std::vector<float> vertex;
     std::vector<float> normal;
@@ -1736,48 +1821,45 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
             continue;
         }
 
-        if (parseIsToken(buffer, "material_library"))
+        const char* cursor = buffer;
+
+        const int32_t token = g_subMeshTokens.find(&cursor);
+
+        if (token == VKTS_SUB_MESH_TOKEN_MATERIAL_LIBRARY)
         {
             if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
             {
                 return VK_FALSE;
             }
 
-            if (!sceneLoadMaterials(directory, sdata, sceneManager, sceneFactory))
+            if (!materialLibraryFunction(sdata))
             {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load materials: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "name"))
+        else if (token == VKTS_SUB_MESH_TOKEN_NAME)
         {
             if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
             {
                 return VK_FALSE;
             }
 
-            subMesh = sceneFactory->createSubMesh(sceneManager);
+            sceneResetSubMeshData(subMeshData);
 
-            if (!subMesh.get())
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not created: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                return VK_FALSE;
-            }
+            subMeshData.name = sdata;
 
-            subMesh->setName(sdata);
+            hasSubMesh = VK_TRUE;
         }
-        else if (parseIsToken(buffer, "double_sided"))
+        else if (token == VKTS_SUB_MESH_TOKEN_DOUBLE_SIDED)
         {
             if (!parseBool(buffer, &bdata))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
-            	subMesh->setDoubleSided(bdata);
+            	subMeshData.doubleSided = bdata;
             }
             else
             {
@@ -1786,14 +1868,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "vertex"))
+        else if (token == VKTS_SUB_MESH_TOKEN_VERTEX)
         {
-            if (!parseVec4(buffer, fdata))
+            if (!parseNextFloats(&cursor, fdata, 4))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 4; i++)
                 {
@@ -1807,14 +1889,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "normal"))
+        else if (token == VKTS_SUB_MESH_TOKEN_NORMAL)
         {
-            if (!parseVec3(buffer, fdata))
+            if (!parseNextFloats(&cursor, fdata, 3))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 3; i++)
                 {
@@ -1828,14 +1910,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "bitangent"))
+        else if (token == VKTS_SUB_MESH_TOKEN_BITANGENT)
         {
-            if (!parseVec3(buffer, fdata))
+            if (!parseNextFloats(&cursor, fdata, 3))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 3; i++)
                 {
@@ -1849,14 +1931,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "tangent"))
+        else if (token == VKTS_SUB_MESH_TOKEN_TANGENT)
         {
-            if (!parseVec3(buffer, fdata))
+            if (!parseNextFloats(&cursor, fdata, 3))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 3; i++)
                 {
@@ -1870,14 +1952,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "texcoord"))
+        else if (token == VKTS_SUB_MESH_TOKEN_TEXCOORD)
         {
-            if (!parseVec2(buffer, fdata))
+            if (!parseNextFloats(&cursor, fdata, 2))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 2; i++)
                 {
@@ -1891,14 +1973,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "boneIndex"))
+        else if (token == VKTS_SUB_MESH_TOKEN_BONE_INDEX)
         {
-            if (!parseVec8(buffer, fdata))
+            if (!parseNextFloats(&cursor, fdata, 8))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 8; i++)
                 {
@@ -1919,14 +2001,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "boneWeight"))
+        else if (token == VKTS_SUB_MESH_TOKEN_BONE_WEIGHT)
         {
-            if (!parseVec8(buffer, fdata))
+            if (!parseNextFloats(&cursor, fdata, 8))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 8; i++)
                 {
@@ -1947,14 +2029,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "numberBones"))
+        else if (token == VKTS_SUB_MESH_TOKEN_NUMBER_BONES)
         {
-            if (!parseFloat(buffer, fdata))
+            if (!parseNextFloat(&cursor, fdata))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 numberBones.push_back(fdata[0]);
             }
@@ -1965,14 +2047,14 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "face"))
+        else if (token == VKTS_SUB_MESH_TOKEN_FACE)
         {
-            if (!parseIVec3(buffer, idata))
+            if (!parseNextInts(&cursor, idata, 3))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (hasSubMesh)
             {
                 for (int32_t i = 0; i < 3; i++)
                 {
@@ -1986,332 +2068,267 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
                 return VK_FALSE;
             }
         }
-        else if (parseIsToken(buffer, "material"))
+        else if (token == VKTS_SUB_MESH_TOKEN_MATERIAL)
         {
             if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
             {
                 return VK_FALSE;
             }
 
-            if (subMesh.get())
+            if (!hasSubMesh)
             {
-                const auto phongMaterial = sceneManager->usePhongMaterial(sdata);
-
-                if (phongMaterial.get())
-                {
-                    subMesh->setPhongMaterial(phongMaterial);
-                }
-                else
-                {
-                    const auto bsdfMaterial = sceneManager->useBSDFMaterial(sdata);
-
-                    if (bsdfMaterial.get())
-                    {
-                        subMesh->setBSDFMaterial(bsdfMaterial);
-                    }
-                    else
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Material not found: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                        return VK_FALSE;
-                    }
-                }
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
 
                 return VK_FALSE;
             }
 
+            subMeshData.material = sdata;
+
             //
             // Sub mesh creation.
             //
 
-            if (subMesh.get())
+            subMeshData.numberVertices = (int32_t)(vertex.size() / 4);
+            subMeshData.numberIndices = (int32_t)indices.size();
+
+            int32_t totalSize = 0;
+            uint32_t strideInBytes = 0;
+
+            VkTsVertexBufferType vertexBufferType = 0;
+
+            if (vertex.size() > 0)
             {
-                subMesh->setNumberVertices((int32_t)(vertex.size() / 4));
-                subMesh->setNumberIndices((int32_t) indices.size());
+                subMeshData.vertexOffset = strideInBytes;
+                strideInBytes += 4 * sizeof(float);
 
-                int32_t totalSize = 0;
-                uint32_t strideInBytes = 0;
+                totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
 
-                VkTsVertexBufferType vertexBufferType = 0;
+                vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_VERTEX;
+            }
 
-                if (vertex.size() > 0)
+            if (normal.size() > 0)
+            {
+                if (normal.size() / 3 != vertex.size() / 4)
                 {
-                    subMesh->setVertexOffset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
-
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Normal has different size");
 
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_VERTEX;
+                    return VK_FALSE;
                 }
 
-                if (normal.size() > 0)
-                {
-                    if (normal.size() / 3 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Normal has different size");
+                subMeshData.normalOffset = strideInBytes;
+                strideInBytes += 3 * sizeof(float);
 
-                        return VK_FALSE;
-                    }
+                totalSize += 3 * sizeof(float) * subMeshData.numberVertices;
 
-                    subMesh->setNormalOffset(strideInBytes);
-                    strideInBytes += 3 * sizeof(float);
+                vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_NORMAL;
+            }
 
-                    totalSize += 3 * sizeof(float) * subMesh->getNumberVertices();
+            if (normal.size() > 0 && bitangent.size() > 0 && tangent.size() > 0)
+            {
+                if (bitangent.size() / 3 != vertex.size() / 4)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bitangent has different size");
 
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_NORMAL;
+                    return VK_FALSE;
                 }
 
-                if (normal.size() > 0 && bitangent.size() > 0 && tangent.size() > 0)
-                {
-                    if (bitangent.size() / 3 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bitangent has different size");
+                subMeshData.bitangentOffset = strideInBytes;
+                strideInBytes += 3 * sizeof(float);
 
-                        return VK_FALSE;
-                    }
+                totalSize += 3 * sizeof(float) * subMeshData.numberVertices;
 
-                    subMesh->setBitangentOffset(strideInBytes);
-                    strideInBytes += 3 * sizeof(float);
+                //
 
-                    totalSize += 3 * sizeof(float) * subMesh->getNumberVertices();
+                if (tangent.size() / 3 != vertex.size() / 4)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Tangent has different size");
 
-                    //
+                    return VK_FALSE;
+                }
 
-                    if (tangent.size() / 3 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Tangent has different size");
+                subMeshData.tangentOffset = strideInBytes;
+                strideInBytes += 3 * sizeof(float);
 
-                        return VK_FALSE;
-                    }
+                totalSize += 3 * sizeof(float) * subMeshData.numberVertices;
 
-                    subMesh->setTangentOffset(strideInBytes);
-                    strideInBytes += 3 * sizeof(float);
+                //
 
-                    totalSize += 3 * sizeof(float) * subMesh->getNumberVertices();
+                vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TANGENTS;
+            }
 
-                    //
+            if (texcoord.size() > 0)
+            {
+                if (texcoord.size() / 2 != vertex.size() / 4)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "TextureObject coordinate has different size");
 
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TANGENTS;
+                    return VK_FALSE;
                 }
 
-                if (texcoord.size() > 0)
-                {
-                    if (texcoord.size() / 2 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "TextureObject coordinate has different size");
+                subMeshData.texcoordOffset = strideInBytes;
+                strideInBytes += 2 * sizeof(float);
 
-                        return VK_FALSE;
-                    }
+                totalSize += 2 * sizeof(float) * subMeshData.numberVertices;
 
-                    subMesh->setTexcoordOffset(strideInBytes);
-                    strideInBytes += 2 * sizeof(float);
+                vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TEXCOORD;
+            }
 
-                    totalSize += 2 * sizeof(float) * subMesh->getNumberVertices();
+            if (boneIndices0.size() > 0 && boneIndices1.size() > 0 && boneWeights0.size() > 0 && boneWeights1.size() > 0 && numberBones.size() > 0)
+            {
+                if (boneIndices0.size() / 4 != vertex.size() / 4)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices0 has different size: %u != %u", boneIndices0.size(), vertex.size());
 
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_TEXCOORD;
+                    return VK_FALSE;
                 }
 
-                if (boneIndices0.size() > 0 && boneIndices1.size() > 0 && boneWeights0.size() > 0 && boneWeights1.size() > 0 && numberBones.size() > 0)
+                subMeshData.boneIndices0Offset = strideInBytes;
+                strideInBytes += 4 * sizeof(float);
+
+                totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
+
+                if (boneIndices1.size() / 4 != vertex.size() / 4)
                 {
-                    if (boneIndices0.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices0 has different size: %u != %u", boneIndices0.size(), vertex.size());
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices1 has different size %u != %u", boneIndices1.size(), vertex.size());
 
-                        return VK_FALSE;
-                    }
+                    return VK_FALSE;
+                }
 
-                    subMesh->setBoneIndices0Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
+                subMeshData.boneIndices1Offset = strideInBytes;
+                strideInBytes += 4 * sizeof(float);
 
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
+                totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
 
-                    if (boneIndices1.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone indices1 has different size %u != %u", boneIndices1.size(), vertex.size());
+                if (boneWeights0.size() / 4 != vertex.size() / 4)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights0 has different size");
 
-                        return VK_FALSE;
-                    }
+                    return VK_FALSE;
+                }
 
-                    subMesh->setBoneIndices1Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
+                subMeshData.boneWeights0Offset = strideInBytes;
+                strideInBytes += 4 * sizeof(float);
 
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
+                totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
 
-                    if (boneWeights0.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights0 has different size");
+                if (boneWeights1.size() / 4 != vertex.size() / 4)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights has different size");
 
-                        return VK_FALSE;
-                    }
+                    return VK_FALSE;
+                }
 
-                    subMesh->setBoneWeights0Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
+                subMeshData.boneWeights1Offset = strideInBytes;
+                strideInBytes += 4 * sizeof(float);
 
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
+                totalSize += 4 * sizeof(float) * subMeshData.numberVertices;
 
-                    if (boneWeights1.size() / 4 != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Bone weights has different size");
+                if (numberBones.size() != vertex.size() / 4)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Number bones has different size");
 
-                        return VK_FALSE;
-                    }
+                    return VK_FALSE;
+                }
 
-                    subMesh->setBoneWeights1Offset(strideInBytes);
-                    strideInBytes += 4 * sizeof(float);
+                subMeshData.numberBonesOffset = strideInBytes;
+                strideInBytes += 1 * sizeof(float);
 
-                    totalSize += 4 * sizeof(float) * subMesh->getNumberVertices();
+                totalSize += 1 * sizeof(float) * subMeshData.numberVertices;
 
-                    if (numberBones.size() != vertex.size() / 4)
-                    {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Number bones has different size");
+                vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_BONES;
+            }
 
-                        return VK_FALSE;
-                    }
+            subMeshData.vertexBufferType = vertexBufferType;
+            subMeshData.strideInBytes = strideInBytes;
 
-                    subMesh->setNumberBonesOffset(strideInBytes);
-                    strideInBytes += 1 * sizeof(float);
+            if (totalSize > 0)
+            {
+                auto vertexBinaryBuffer = binaryBufferCreate((uint32_t)totalSize);
 
-                    totalSize += 1 * sizeof(float) * subMesh->getNumberVertices();
+                if (!vertexBinaryBuffer.get() || vertexBinaryBuffer->getSize() != (uint32_t)totalSize)
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex binary buffer");
 
-                    vertexBufferType |= VKTS_VERTEX_BUFFER_TYPE_BONES;
+                    return VK_FALSE;
                 }
 
-                subMesh->setStrideInBytes(strideInBytes);
-
-                if (totalSize > 0)
+                for (int32_t currentVertexElement = 0; currentVertexElement < subMeshData.numberVertices; currentVertexElement++)
                 {
-                    auto vertexBinaryBuffer = binaryBufferCreate((uint32_t)totalSize);
-
-                    if (!vertexBinaryBuffer.get() || vertexBinaryBuffer->getSize() != (uint32_t)totalSize)
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_VERTEX)
                     {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex binary buffer");
-
-                        return VK_FALSE;
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&vertex[currentVertexElement * 4]), 1, 4 * sizeof(float));
                     }
-
-                    for (int32_t currentVertexElement = 0; currentVertexElement < subMesh->getNumberVertices(); currentVertexElement++)
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_NORMAL)
                     {
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_VERTEX)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&vertex[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_NORMAL)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&normal[currentVertexElement * 3]), 1, 3 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BITANGENT)
-                        {
-                            vertexBinaryBuffer->write( reinterpret_cast<const uint8_t*>(&bitangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TANGENT)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&tangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TEXCOORD)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&texcoord[currentVertexElement * 2]), 1, 2 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES0)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices0[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES1)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices1[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS0)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights0[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS1)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights1[currentVertexElement * 4]), 1, 4 * sizeof(float));
-                        }
-                        if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_NUMBERS)
-                        {
-                            vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&numberBones[currentVertexElement * 1]), 1, 1 * sizeof(float));
-                        }
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&normal[currentVertexElement * 3]), 1, 3 * sizeof(float));
                     }
-
-                    //
-
-                    auto vertexBuffer = createVertexBufferObject(sceneManager->getAssetManager(), vertexBinaryBuffer);
-
-                    if (!vertexBuffer.get())
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BITANGENT)
                     {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex buffer");
-
-                        return VK_FALSE;
+                        vertexBinaryBuffer->write( reinterpret_cast<const uint8_t*>(&bitangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
                     }
-
-                    //
-
-                    subMesh->setVertexBuffer(vertexBuffer, vertexBufferType, Aabb((const float*)vertexBinaryBuffer->getData(), subMesh->getNumberVertices(), subMesh->getStrideInBytes()));
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
-
-                    return VK_FALSE;
-                }
-
-                if (indices.size() > 0)
-                {
-                	uint32_t size = sizeof(int32_t) * subMesh->getNumberIndices();
-
-                    auto indicesBinaryBuffer = binaryBufferCreate(reinterpret_cast<const uint8_t*>(&indices[0]), size);
-
-                    if (!indicesBinaryBuffer.get() || indicesBinaryBuffer->getSize() != size)
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TANGENT)
                     {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices binary buffer");
-
-                        return VK_FALSE;
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&tangent[currentVertexElement * 3]), 1, 3 * sizeof(float));
                     }
-
-                    //
-
-                    auto indexVertexBuffer = createIndexBufferObject(sceneManager->getAssetManager(), indicesBinaryBuffer);
-
-                    if (!indexVertexBuffer.get())
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_TEXCOORD)
                     {
-                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices vertex buffer");
-
-                        return VK_FALSE;
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&texcoord[currentVertexElement * 2]), 1, 2 * sizeof(float));
+                    }
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES0)
+                    {
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices0[currentVertexElement * 4]), 1, 4 * sizeof(float));
+                    }
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_INDICES1)
+                    {
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneIndices1[currentVertexElement * 4]), 1, 4 * sizeof(float));
+                    }
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS0)
+                    {
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights0[currentVertexElement * 4]), 1, 4 * sizeof(float));
+                    }
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_WEIGHTS1)
+                    {
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&boneWeights1[currentVertexElement * 4]), 1, 4 * sizeof(float));
+                    }
+                    if (vertexBufferType & VKTS_VERTEX_BUFFER_TYPE_BONE_NUMBERS)
+                    {
+                        vertexBinaryBuffer->write(reinterpret_cast<const uint8_t*>(&numberBones[currentVertexElement * 1]), 1, 1 * sizeof(float));
                     }
+                }
 
-                    //
+                subMeshData.vertexBinaryBuffer = vertexBinaryBuffer;
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
 
-                    subMesh->setIndexBuffer(indexVertexBuffer);
-                }
-                else
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
+                return VK_FALSE;
+            }
 
-                    return VK_FALSE;
-                }
+            if (indices.size() > 0)
+            {
+            	uint32_t size = sizeof(int32_t) * subMeshData.numberIndices;
 
-                //
+                auto indicesBinaryBuffer = binaryBufferCreate(reinterpret_cast<const uint8_t*>(&indices[0]), size);
 
-                if (subMesh->getBSDFMaterial().get() && sceneFactory->getSceneRenderFactory().get())
+                if (!indicesBinaryBuffer.get() || indicesBinaryBuffer->getSize() != size)
                 {
-                	if (!sceneFactory->getSceneRenderFactory()->prepareBSDFMaterial(sceneManager, subMesh))
-                	{
-                		return VK_FALSE;
-                	}
-                }
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices binary buffer");
 
-                //
+                    return VK_FALSE;
+                }
 
-                sceneManager->addSubMesh(subMesh);
+                subMeshData.indicesBinaryBuffer = indicesBinaryBuffer;
             }
             else
             {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No sub mesh");
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh incomplete");
+
+                return VK_FALSE;
+            }
 
+            if (!subMeshFunction(subMeshData))
+            {
                 return VK_FALSE;
             }
 
@@ -2338,7 +2355,274 @@ static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename,
     return VK_TRUE;
 }
 
-static VkBool32 sceneLoadMeshes(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+static VkBool32 sceneCreateSubMesh(const SceneSubMeshData& subMeshData, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+{
+    auto subMesh = sceneFactory->createSubMesh(sceneManager);
+
+    if (!subMesh.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not created: '%s'", subMeshData.name.c_str());
+
+        return VK_FALSE;
+    }
+
+    subMesh->setName(subMeshData.name);
+    subMesh->setDoubleSided(subMeshData.doubleSided);
+
+    const auto phongMaterial = sceneManager->usePhongMaterial(subMeshData.material);
+
+    if (phongMaterial.get())
+    {
+        subMesh->setPhongMaterial(phongMaterial);
+    }
+    else
+    {
+        const auto bsdfMaterial = sceneManager->useBSDFMaterial(subMeshData.material);
+
+        if (bsdfMaterial.get())
+        {
+            subMesh->setBSDFMaterial(bsdfMaterial);
+        }
+        else
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Material not found: '%s'", subMeshData.material.c_str());
+
+            return VK_FALSE;
+        }
+    }
+
+    subMesh->setNumberVertices(subMeshData.numberVertices);
+    subMesh->setNumberIndices(subMeshData.numberIndices);
+
+    subMesh->setVertexOffset(subMeshData.vertexOffset);
+    subMesh->setNormalOffset(subMeshData.normalOffset);
+    subMesh->setBitangentOffset(subMeshData.bitangentOffset);
+    subMesh->setTangentOffset(subMeshData.tangentOffset);
+    subMesh->setTexcoordOffset(subMeshData.texcoordOffset);
+    subMesh->setBoneIndices0Offset(subMeshData.boneIndices0Offset);
+    subMesh->setBoneIndices1Offset(subMeshData.boneIndices1Offset);
+    subMesh->setBoneWeights0Offset(subMeshData.boneWeights0Offset);
+    subMesh->setBoneWeights1Offset(subMeshData.boneWeights1Offset);
+    subMesh->setNumberBonesOffset(subMeshData.numberBonesOffset);
+
+    subMesh->setStrideInBytes(subMeshData.strideInBytes);
+
+    //
+
+    auto vertexBuffer = createVertexBufferObject(sceneManager->getAssetManager(), subMeshData.vertexBinaryBuffer);
+
+    if (!vertexBuffer.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create vertex buffer");
+
+        return VK_FALSE;
+    }
+
+    subMesh->setVertexBuffer(vertexBuffer, subMeshData.vertexBufferType, Aabb((const float*)subMeshData.vertexBinaryBuffer->getData(), subMesh->getNumberVertices(), subMesh->getStrideInBytes()));
+
+    //
+
+    auto indexVertexBuffer = createIndexBufferObject(sceneManager->getAssetManager(), subMeshData.indicesBinaryBuffer);
+
+    if (!indexVertexBuffer.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create indices vertex buffer");
+
+        return VK_FALSE;
+    }
+
+    subMesh->setIndexBuffer(indexVertexBuffer);
+
+    //
+
+    if (subMesh->getBSDFMaterial().get() && sceneFactory->getSceneRenderFactory().get())
+    {
+    	if (!sceneFactory->getSceneRenderFactory()->prepareBSDFMaterial(sceneManager, subMesh))
+    	{
+    		return VK_FALSE;
+    	}
+    }
+
+    //
+
+    sceneManager->addSubMesh(subMesh);
+
+    return VK_TRUE;
+}
+
+VkBool32 VKTS_APIENTRY _sceneVisitSubMeshes(const char* directory, const char* filename, const SceneMaterialLibraryFunction& materialLibraryFunction, const SceneSubMeshFunction& subMeshFunction)
+{
+    if (!directory || !filename)
+    {
+        return VK_FALSE;
+    }
+
+    std::string finalFilename = std::string(directory) + std::string(filename);
+
+    auto textBuffer = fileMapText(finalFilename.c_str());
+
+    if (!textBuffer.get())
+    {
+        finalFilename = filename;
+
+        textBuffer = fileMapText(filename);
+
+        if (!textBuffer.get())
+        {
+            return VK_FALSE;
+        }
+    }
+
+    // Converted sub meshes are used, as long as they match the text.
+
+    auto binaryBuffer = fileMapBinary((finalFilename + VKTS_SCENE_BINARY_SUFFIX).c_str(), VKTS_FILE_ACCESS_SEQUENTIAL);
+
+    if (binaryBuffer.get())
+    {
+        if (_sceneCheckBinary(binaryBuffer, textBuffer))
+        {
+            return _sceneReadBinary(binaryBuffer, materialLibraryFunction, subMeshFunction);
+        }
+
+        logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Binary sub meshes outdated or invalid: '%s'", filename);
+    }
+
+    if (!cacheGetEnabled())
+    {
+        return _sceneParseSubMeshes(textBuffer, materialLibraryFunction, subMeshFunction);
+    }
+
+    // Without converted sub meshes, the text is parsed only once and then taken from the cache.
+
+    uint64_t key = cacheCreateKey(textBuffer->getString(), (size_t)textBuffer->getLength(), "SUBMESHES");
+
+    binaryBuffer = cacheLoadBinary(key);
+
+    if (binaryBuffer.get() && _sceneCheckBinary(binaryBuffer, textBuffer))
+    {
+        logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", filename);
+
+        return _sceneReadBinary(binaryBuffer, materialLibraryFunction, subMeshFunction);
+    }
+
+    SceneSubMeshLibrary subMeshLibrary;
+
+    auto collectMaterialLibraryFunction = [&subMeshLibrary](const char* materialLibrary) -> VkBool32
+    {
+        subMeshLibrary.allMaterialLibraries.push_back(materialLibrary);
+
+        return VK_TRUE;
+    };
+
+    auto collectSubMeshFunction = [&subMeshLibrary](const SceneSubMeshData& subMeshData) -> VkBool32
+    {
+        subMeshLibrary.allSubMeshData.push_back(subMeshData);
+
+        return VK_TRUE;
+    };
+
+    if (!_sceneParseSubMeshes(textBuffer, collectMaterialLibraryFunction, collectSubMeshFunction))
+    {
+        return VK_FALSE;
+    }
+
+    std::vector<uint8_t> data;
+
+    if (_sceneCreateBinary(data, textBuffer, subMeshLibrary.allMaterialLibraries, subMeshLibrary.allSubMeshData))
+    {
+        logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Storing cached data for '%s'", filename);
+
+        cacheSaveBinary(key, &data[0], (uint32_t)data.size());
+    }
+
+    // Same order as for the binary sub meshes.
+
+    for (const auto& materialLibrary : subMeshLibrary.allMaterialLibraries)
+    {
+        if (!materialLibraryFunction(materialLibrary.c_str()))
+        {
+            return VK_FALSE;
+        }
+    }
+
+    for (const auto& subMeshData : subMeshLibrary.allSubMeshData)
+    {
+        if (!subMeshFunction(subMeshData))
+        {
+            return VK_FALSE;
+        }
+    }
+
+    return VK_TRUE;
+}
+
+static VkBool32 sceneLoadSubMeshes(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ScenePrefetch* prefetch)
+{
+    if (!directory || !filename || !sceneManager.get())
+    {
+        return VK_FALSE;
+    }
+
+    auto materialLibraryFunction = [&](const char* materialLibrary) -> VkBool32
+    {
+        if (!sceneLoadMaterials(directory, materialLibrary, sceneManager, sceneFactory, prefetch))
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load materials: '%s'", materialLibrary);
+
+            return VK_FALSE;
+        }
+
+        return VK_TRUE;
+    };
+
+    auto subMeshFunction = [&](const SceneSubMeshData& subMeshData) -> VkBool32
+    {
+        // While streaming, the sub mesh is created, when the first node uses it.
+
+        if (prefetch && prefetch->streamGeometry)
+        {
+            prefetch->streamGeometry->allSubMeshData.set(subMeshData.name, subMeshData);
+
+            return VK_TRUE;
+        }
+
+        return sceneCreateSubMesh(subMeshData, sceneManager, sceneFactory);
+    };
+
+    // Already parsed sub meshes are created in the same order as the binary ones.
+
+    if (prefetch)
+    {
+        auto index = prefetch->allSubMeshLibraries.find(filename);
+
+        if (index != prefetch->allSubMeshLibraries.size())
+        {
+            const auto& subMeshLibrary = prefetch->allSubMeshLibraries.valueAt(index);
+
+            for (const auto& materialLibrary : subMeshLibrary.allMaterialLibraries)
+            {
+                if (!materialLibraryFunction(materialLibrary.c_str()))
+                {
+                    return VK_FALSE;
+                }
+            }
+
+            for (const auto& subMeshData : subMeshLibrary.allSubMeshData)
+            {
+                if (!subMeshFunction(subMeshData))
+                {
+                    return VK_FALSE;
+                }
+            }
+
+            return VK_TRUE;
+        }
+    }
+
+    return _sceneVisitSubMeshes(directory, filename, materialLibraryFunction, subMeshFunction);
+}
+
+static VkBool32 sceneLoadMeshes(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ScenePrefetch* prefetch)
 {
     if (!directory || !filename || !sceneManager.get())
     {
@@ -2379,7 +2663,7 @@ static VkBool32 sceneLoadMeshes(const char* directory, const char* filename, con
                 return VK_FALSE;
             }
 
-            if (!sceneLoadSubMeshes(directory, sdata, sceneManager, sceneFactory))
+            if (!sceneLoadSubMeshes(directory, sdata, sceneManager, sceneFactory, prefetch))
             {
                 logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load sub meshes: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
 
@@ -2415,16 +2699,23 @@ static VkBool32 sceneLoadMeshes(const char* directory, const char* filename, con
 
             if (mesh.get())
             {
-                const auto& subMesh = sceneManager->useSubMesh(sdata);
-
-                if (!subMesh.get())
+                if (prefetch && prefetch->streamGeometry)
                 {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not found: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
-
-                    return VK_FALSE;
+                    prefetch->streamGeometry->allMeshSubMeshes[mesh->getName()].push_back(std::string(sdata));
                 }
+                else
+                {
+                    const auto& subMesh = sceneManager->useSubMesh(sdata);
+
+                    if (!subMesh.get())
+                    {
+                        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not found: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
+
+                        return VK_FALSE;
+                    }
 
-                mesh->addSubMesh(subMesh);
+                    mesh->addSubMesh(subMesh);
+                }
             }
             else
             {
@@ -2478,6 +2769,67 @@ static VkBool32 sceneLoadMeshes(const char* directory, const char* filename, con
     return VK_TRUE;
 }
 
+/**
+ * Creates the collected sub meshes of the mesh and adds them in file order. Only used while streaming.
+ */
+static VkBool32 sceneStreamSubMeshes(const IMeshSP& mesh, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ScenePrefetch* prefetch)
+{
+    if (!prefetch || !prefetch->streamGeometry)
+    {
+        return VK_TRUE;
+    }
+
+    auto& streamGeometry = *prefetch->streamGeometry;
+
+    auto meshIndex = streamGeometry.allMeshSubMeshes.find(mesh->getName());
+
+    if (meshIndex == streamGeometry.allMeshSubMeshes.size())
+    {
+        return VK_TRUE;
+    }
+
+    for (const auto& subMeshName : streamGeometry.allMeshSubMeshes.valueAt(meshIndex))
+    {
+        auto subMesh = sceneManager->useSubMesh(subMeshName);
+
+        if (!subMesh.get())
+        {
+            auto subMeshIndex = streamGeometry.allSubMeshData.find(subMeshName);
+
+            if (subMeshIndex == streamGeometry.allSubMeshData.size())
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not found: '%s'", subMeshName.c_str());
+
+                return VK_FALSE;
+            }
+
+            if (!sceneCreateSubMesh(streamGeometry.allSubMeshData.valueAt(subMeshIndex), sceneManager, sceneFactory))
+            {
+                return VK_FALSE;
+            }
+
+            // Releases the host vertices and indices.
+
+            streamGeometry.allSubMeshData.removeAt(subMeshIndex);
+
+            subMesh = sceneManager->useSubMesh(subMeshName);
+
+            if (!subMesh.get())
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Sub mesh not found: '%s'", subMeshName.c_str());
+
+                return VK_FALSE;
+            }
+        }
+
+        mesh->addSubMesh(subMesh);
+    }
+
+    streamGeometry.allMeshSubMeshes.removeAt(meshIndex);
+
+    return VK_TRUE;
+}
+
 static VkBool32 sceneLoadChannels(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
 {
     if (!directory || !filename || !sceneManager.get())
@@ -3628,7 +3980,20 @@ static VkBool32 sceneLoadLights(const char* directory, const char* filename, con
     return VK_TRUE;
 }
 
-static VkBool32 sceneLoadObjects(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory)
+/**
+ * Passes the finished object to the object function. Only used while streaming.
+ */
+static VkBool32 sceneStreamObject(const IObjectSP& object, const ScenePrefetch* prefetch)
+{
+    if (!object.get() || !prefetch || !prefetch->streamGeometry || !prefetch->streamGeometry->objectFunction)
+    {
+        return VK_TRUE;
+    }
+
+    return prefetch->streamGeometry->objectFunction(object);
+}
+
+static VkBool32 sceneLoadObjects(const char* directory, const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ScenePrefetch* prefetch)
 {
     if (!directory || !filename || !sceneManager.get())
     {
@@ -3684,7 +4049,7 @@ static VkBool32 sceneLoadObjects(const char* directory, const char* filename, co
                 return VK_FALSE;
             }
 
-            if (!sceneLoadMeshes(directory, sdata0, sceneManager, sceneFactory))
+            if (!sceneLoadMeshes(directory, sdata0, sceneManager, sceneFactory, prefetch))
             {
                 logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load meshes: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
 
@@ -3754,6 +4119,11 @@ static VkBool32 sceneLoadObjects(const char* directory, const char* filename, co
                 return VK_FALSE;
             }
 
+            if (!sceneStreamObject(object, prefetch))
+            {
+                return VK_FALSE;
+            }
+
             object = sceneFactory->createObject(sceneManager);
 
             if (!object.get())
@@ -3983,14 +4353,16 @@ static VkBool32 sceneLoadObjects(const char* directory, const char* filename, co
             {
             	INodeSP targetNode;
 
-            	for (uint32_t i = 0; i < sceneManager->getAllObjects().values().size(); i++)
+            	const auto allObjects = sceneManager->getAllObjects();
+
+            	for (uint32_t i = 0; i < allObjects.values().size(); i++)
             	{
-            		if (!sceneManager->getAllObjects().values()[i]->getRootNode().get())
+            		if (!allObjects.values()[i]->getRootNode().get())
             		{
             			continue;
             		}
 
-            		targetNode = sceneManager->getAllObjects().values()[i]->getRootNode()->findNodeRecursiveFromRoot(sdata0);
+            		targetNode = allObjects.values()[i]->getRootNode()->findNodeRecursiveFromRoot(sdata0);
 
             		if (targetNode.get())
             		{
@@ -4308,136 +4680,535 @@ static VkBool32 sceneLoadObjects(const char* directory, const char* filename, co
             {
                 logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
 
-                return VK_FALSE;
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "mesh"))
+        {
+            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (node.get())
+            {
+            	if (!sceneFactory->getSceneRenderFactory()->prepareTransformUniformBuffer(sceneManager, node))
+            	{
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create uniform buffer for node: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+
+                    return VK_FALSE;
+            	}
+
+            	//
+
+                const auto& mesh = sceneManager->useMesh(sdata0);
+
+                if (!mesh.get())
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Mesh not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+
+                    return VK_FALSE;
+                }
+
+                if (!sceneStreamSubMeshes(mesh, sceneManager, sceneFactory, prefetch))
+                {
+                    return VK_FALSE;
+                }
+
+                node->addMesh(mesh);
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "camera"))
+        {
+            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (node.get())
+            {
+                const auto& camera = sceneManager->useCamera(sdata0);
+
+                if (!camera.get())
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Camera not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+
+                    return VK_FALSE;
+                }
+
+                node->addCamera(camera);
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "light"))
+        {
+            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (node.get())
+            {
+                const auto& light = sceneManager->useLight(sdata0);
+
+                if (!light.get())
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Light not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+
+                    return VK_FALSE;
+                }
+
+                node->addLight(light);
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+
+                return VK_FALSE;
+            }
+        }
+        else if (parseIsToken(buffer, "animation"))
+        {
+            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            if (node.get())
+            {
+                const auto& animation = sceneManager->useAnimation(sdata0);
+
+                if (!animation.get())
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Animation not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+
+                    return VK_FALSE;
+                }
+
+                node->addAnimation(animation);
+            }
+            else
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+
+                return VK_FALSE;
+            }
+        }
+        else
+        {
+            parseUnknownBuffer(buffer);
+        }
+    }
+
+    return sceneStreamObject(object, prefetch);
+}
+
+static void sceneApply(const ISceneSP& scene, const ISceneStreamSP& sceneStream, const SceneStreamFunction& function)
+{
+    if (sceneStream.get())
+    {
+        sceneStream->publish(function);
+    }
+    else
+    {
+        function(scene);
+    }
+}
+
+static VkBool32 scenePhongReplaceTextureObject(const IPhongMaterialSP& phongMaterial, const ITextureObjectSP& oldTextureObject, const ITextureObjectSP& newTextureObject)
+{
+    if (phongMaterial->getAlpha() == oldTextureObject)
+    {
+        phongMaterial->setAlpha(newTextureObject);
+    }
+    if (phongMaterial->getDisplacement() == oldTextureObject)
+    {
+        phongMaterial->setDisplacement(newTextureObject);
+    }
+    if (phongMaterial->getNormal() == oldTextureObject)
+    {
+        phongMaterial->setNormal(newTextureObject);
+    }
+    if (phongMaterial->getAmbient() == oldTextureObject)
+    {
+        phongMaterial->setAmbient(newTextureObject);
+    }
+    if (phongMaterial->getEmissive() == oldTextureObject)
+    {
+        phongMaterial->setEmissive(newTextureObject);
+    }
+    if (phongMaterial->getDiffuse() == oldTextureObject)
+    {
+        phongMaterial->setDiffuse(newTextureObject);
+    }
+    if (phongMaterial->getSpecular() == oldTextureObject)
+    {
+        phongMaterial->setSpecular(newTextureObject);
+    }
+    if (phongMaterial->getSpecularShininess() == oldTextureObject)
+    {
+        phongMaterial->setSpecularShininess(newTextureObject);
+    }
+    if (phongMaterial->getMirror() == oldTextureObject)
+    {
+        phongMaterial->setMirror(newTextureObject);
+    }
+    if (phongMaterial->getMirrorReflectivity() == oldTextureObject)
+    {
+        phongMaterial->setMirrorReflectivity(newTextureObject);
+    }
+
+    // A shared material may have been replaced through another object already.
+
+    return (phongMaterial->getAlpha() == newTextureObject ||
+        phongMaterial->getDisplacement() == newTextureObject ||
+        phongMaterial->getNormal() == newTextureObject ||
+        phongMaterial->getAmbient() == newTextureObject ||
+        phongMaterial->getEmissive() == newTextureObject ||
+        phongMaterial->getDiffuse() == newTextureObject ||
+        phongMaterial->getSpecular() == newTextureObject ||
+        phongMaterial->getSpecularShininess() == newTextureObject ||
+        phongMaterial->getMirror() == newTextureObject ||
+        phongMaterial->getMirrorReflectivity() == newTextureObject) ? VK_TRUE : VK_FALSE;
+}
+
+/**
+ * Replaces the texture objects in all materials below the node. Executed by the render thread.
+ * Returns VK_TRUE, if any material below the node samples one of the new texture objects.
+ */
+static VkBool32 sceneReplaceTextureObjects(const INodeSP& node, const SmartPointerVector<ITextureObjectSP>& allOldTextureObjects, const SmartPointerVector<ITextureObjectSP>& allNewTextureObjects)
+{
+    if (!node.get())
+    {
+        return VK_FALSE;
+    }
+
+    VkBool32 replaced = VK_FALSE;
+
+    for (uint32_t i = 0; i < node->getMeshes().size(); i++)
+    {
+        const auto& mesh = node->getMeshes()[i];
+
+        for (uint32_t k = 0; k < mesh->getSubMeshes().size(); k++)
+        {
+            const auto& subMesh = mesh->getSubMeshes()[k];
+
+            for (uint32_t m = 0; m < allOldTextureObjects.size(); m++)
+            {
+                const auto& bsdfMaterial = subMesh->getBSDFMaterial();
+
+                if (bsdfMaterial.get())
+                {
+                    bsdfMaterial->replaceTextureObject(allOldTextureObjects[m], allNewTextureObjects[m]);
+
+                    // A shared material may have been replaced through another object already.
+
+                    if (bsdfMaterial->getTextureObjects().index(allNewTextureObjects[m]) != bsdfMaterial->getTextureObjects().size())
+                    {
+                        replaced = VK_TRUE;
+                    }
+                }
+
+                if (subMesh->getPhongMaterial().get() && scenePhongReplaceTextureObject(subMesh->getPhongMaterial(), allOldTextureObjects[m], allNewTextureObjects[m]))
+                {
+                    replaced = VK_TRUE;
+                }
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < node->getChildNodes().size(); i++)
+    {
+        if (sceneReplaceTextureObjects(node->getChildNodes()[i], allOldTextureObjects, allNewTextureObjects))
+        {
+            replaced = VK_TRUE;
+        }
+    }
+
+    return replaced;
+}
+
+/**
+ * Uploads the images of all stream images level by level, starting with the smallest one. After each level, the
+ * texture objects are replaced.
+ */
+static VkBool32 sceneStreamImages(Map<std::string, SceneStreamImage>& allStreamImages, const char* directory, const ScenePrefetch& prefetch, const ISceneManagerSP& sceneManager, const ISceneStreamSP& sceneStream, const SceneStreamFlushFunction& flush)
+{
+    VKTS_PROFILE_ZONE("sceneStreamImages");
+
+    std::vector<SmartPointerVector<IImageDataSP>> allMipMapChains(allStreamImages.size());
+    std::vector<std::string> allFinalImageDataFilenames(allStreamImages.size());
+    std::vector<VkBool32> allKnownImageData(allStreamImages.size(), VK_FALSE);
+    std::vector<IImageDataSP> allImageData(allStreamImages.size());
+    std::vector<IImageObjectSP> allImageObjects(allStreamImages.size());
+
+    uint32_t maxLevels = 0;
+
+    for (uint32_t i = 0; i < allStreamImages.size(); i++)
+    {
+        const auto& streamImage = allStreamImages.valueAt(i);
+
+        allFinalImageDataFilenames[i] = directory + streamImage.imageDataFilename;
+
+        const auto& finalImageDataFilename = allFinalImageDataFilenames[i];
+
+        auto imageData = sceneManager->useImageData(finalImageDataFilename.c_str());
+
+        if (!imageData.get())
+        {
+            imageData = sceneManager->useImageData(streamImage.imageDataFilename.c_str());
+        }
+
+        if (imageData.get())
+        {
+            allKnownImageData[i] = VK_TRUE;
+
+            allMipMapChains[i].append(imageData);
+        }
+        else
+        {
+            auto index = prefetch.allImageData.find(streamImage.imageDataFilename);
+
+            if (index != prefetch.allImageData.size())
+            {
+                imageData = prefetch.allImageData.valueAt(index);
+            }
+
+            if (!imageData.get())
+            {
+                imageData = _sceneLoadImageData(directory, streamImage.imageDataFilename.c_str());
+
+                if (!imageData.get())
+                {
+                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load image data '%s'", finalImageDataFilename.c_str());
+
+                    return VK_FALSE;
+                }
+            }
+
+            if (streamImage.mipMap && imageData->getMipLevels() == 1 && (imageData->getExtent3D().width > 1 || imageData->getExtent3D().height > 1 || imageData->getExtent3D().depth > 1))
+            {
+                if (!sceneCreateMipMaps(allMipMapChains[i], imageData, sceneGetImageDataType(imageData, streamImage.colorData), sceneGetEncodeFormat(imageData, streamImage.encode), finalImageDataFilename, sceneManager))
+                {
+                    return VK_FALSE;
+                }
+            }
+            else
+            {
+                imageData = createDeviceImageData(sceneManager->getAssetManager(), imageData, sceneGetEncodeFormat(imageData, streamImage.encode));
+
+                if (!imageData.get())
+                {
+                    return VK_FALSE;
+                }
+
+                allMipMapChains[i].append(imageData);
             }
         }
-        else if (parseIsToken(buffer, "mesh"))
+
+        // The image with all mip levels is merged and allocated once. Each step only uploads the next larger level.
+
+        if (allMipMapChains[i].size() == 1)
         {
-            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
+            allImageData[i] = allMipMapChains[i][0];
+        }
+        else
+        {
+            allImageData[i] = imageDataMerge(allMipMapChains[i], allFinalImageDataFilenames[i], allMipMapChains[i].size(), 1);
+
+            if (!allImageData[i].get())
             {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No merged image for '%s'", allFinalImageDataFilenames[i].c_str());
+
                 return VK_FALSE;
             }
+        }
 
-            if (node.get())
-            {
-            	if (!sceneFactory->getSceneRenderFactory()->prepareTransformUniformBuffer(sceneManager, node))
-            	{
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create uniform buffer for node: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+        allMipMapChains[i].clear();
 
-                    return VK_FALSE;
-            	}
+        maxLevels = glm::max(maxLevels, allImageData[i]->getMipLevels());
+    }
 
-            	//
+    //
 
-                const auto& mesh = sceneManager->useMesh(sdata0);
+    for (uint32_t step = 0; step < maxLevels; step++)
+    {
+        SmartPointerVector<ITextureObjectSP> allOldTextureObjects;
+        SmartPointerVector<ITextureObjectSP> allNewTextureObjects;
 
-                if (!mesh.get())
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Mesh not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+        for (uint32_t i = 0; i < allStreamImages.size(); i++)
+        {
+            auto& streamImage = allStreamImages.valueAt(i);
 
-                    return VK_FALSE;
-                }
+            const auto& imageData = allImageData[i];
 
-                node->addMesh(mesh);
+            if (step >= imageData->getMipLevels())
+            {
+                continue;
             }
-            else
+
+            uint32_t level = imageData->getMipLevels() - 1 - step;
+
+            auto imageObject = createImageObject(sceneManager->getAssetManager(), streamImage.imageObjectName, imageData, allImageObjects[i], level);
+
+            if (!imageObject.get())
             {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No memory image for '%s'", streamImage.imageObjectName.c_str());
 
                 return VK_FALSE;
             }
-        }
-        else if (parseIsToken(buffer, "camera"))
-        {
-            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
+
+            allImageObjects[i] = imageObject;
+
+            if (level == 0)
             {
-                return VK_FALSE;
+                if (!allKnownImageData[i])
+                {
+                    sceneManager->addImageData(imageData);
+                }
+
+                sceneManager->addImageObject(imageObject);
             }
 
-            if (node.get())
+            for (uint32_t k = 0; k < streamImage.allTextureObjects.size(); k++)
             {
-                const auto& camera = sceneManager->useCamera(sdata0);
+                auto oldTextureObject = streamImage.allTextureObjects[k];
 
-                if (!camera.get())
-                {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Camera not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
+                auto newTextureObject = createTextureObject(sceneManager->getAssetManager(), oldTextureObject->getName(), streamImage.mipMap, VK_FILTER_LINEAR, VK_SAMPLER_ADDRESS_MODE_REPEAT, imageObject);
 
+                if (!newTextureObject.get())
+                {
                     return VK_FALSE;
                 }
 
-                node->addCamera(camera);
-            }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+                sceneManager->removeTextureObject(oldTextureObject);
+                sceneManager->addTextureObject(newTextureObject);
 
-                return VK_FALSE;
+                allOldTextureObjects.append(oldTextureObject);
+                allNewTextureObjects.append(newTextureObject);
+
+                streamImage.allTextureObjects[k] = newTextureObject;
             }
         }
-        else if (parseIsToken(buffer, "light"))
+
+        if (!flush())
         {
-            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
-            {
-                return VK_FALSE;
-            }
+            return VK_FALSE;
+        }
 
-            if (node.get())
+        // Capturing the old texture objects keeps them alive, until the stream retires the change.
+        // The stream outlives its functions, so the plain pointer is safe.
+
+        ISceneStream* currentSceneStream = sceneStream.get();
+
+        sceneStream->publish([allOldTextureObjects, allNewTextureObjects, currentSceneStream](const ISceneSP& scene)
+        {
+            for (uint32_t i = 0; i < scene->getObjects().size(); i++)
             {
-                const auto& light = sceneManager->useLight(sdata0);
+                const auto& currentObject = scene->getObjects()[i];
 
-                if (!light.get())
+                if (sceneReplaceTextureObjects(currentObject->getRootNode(), allOldTextureObjects, allNewTextureObjects))
                 {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Light not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
-
-                    return VK_FALSE;
+                    currentSceneStream->updateDescriptorSets(currentObject);
                 }
-
-                node->addLight(light);
             }
-            else
-            {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+        });
+    }
+
+    return VK_TRUE;
+}
+
+/**
+ * Collects the placements of all objects, so a streamed object can be placed as soon as it is loaded.
+ */
+static VkBool32 sceneGatherObjectInstances(std::vector<SceneObjectInstance>& allObjectInstances, const ITextBufferSP& textBuffer)
+{
+    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
+    float fdata[3];
+
+    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    {
+        if (parseSkipBuffer(buffer))
+        {
+            continue;
+        }
 
+        if (parseIsToken(buffer, "object"))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
                 return VK_FALSE;
             }
+
+            SceneObjectInstance objectInstance{};
+
+            objectInstance.objectName = sdata;
+
+            allObjectInstances.push_back(objectInstance);
         }
-        else if (parseIsToken(buffer, "animation"))
+        else if (parseIsToken(buffer, "name") || parseIsToken(buffer, "translate") || parseIsToken(buffer, "rotate") || parseIsToken(buffer, "scale"))
         {
-            if (!parseString(buffer, sdata0, VKTS_MAX_TOKEN_CHARS))
+            if (allObjectInstances.size() == 0)
             {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No object");
+
                 return VK_FALSE;
             }
 
-            if (node.get())
-            {
-                const auto& animation = sceneManager->useAnimation(sdata0);
+            auto& objectInstance = allObjectInstances.back();
 
-                if (!animation.get())
+            if (parseIsToken(buffer, "name"))
+            {
+                if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
                 {
-                    logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Animation not found: '%s'", sdata0, VKTS_MAX_TOKEN_CHARS);
-
                     return VK_FALSE;
                 }
 
-                node->addAnimation(animation);
+                objectInstance.hasName = VK_TRUE;
+                objectInstance.name = sdata;
             }
             else
             {
-                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No node");
+                if (!parseVec3(buffer, fdata))
+                {
+                    return VK_FALSE;
+                }
 
-                return VK_FALSE;
+                if (parseIsToken(buffer, "translate"))
+                {
+                    objectInstance.hasTranslate = VK_TRUE;
+                    objectInstance.translate = glm::vec3(fdata[0], fdata[1], fdata[2]);
+                }
+                else if (parseIsToken(buffer, "rotate"))
+                {
+                    objectInstance.hasRotate = VK_TRUE;
+                    objectInstance.rotate = glm::vec3(fdata[0], fdata[1], fdata[2]);
+                }
+                else
+                {
+                    objectInstance.hasScale = VK_TRUE;
+                    objectInstance.scale = glm::vec3(fdata[0], fdata[1], fdata[2]);
+                }
             }
         }
-        else
-        {
-            parseUnknownBuffer(buffer);
-        }
     }
 
-    return VK_TRUE;
+    return textBuffer->seek(0, VKTS_SEARCH_ABSOLUTE);
 }
 
-ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory)
+static ISceneSP sceneLoadScene(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory, const VkBool32 parallel, const ISceneStreamSP& sceneStream, const SceneStreamFlushFunction& flush)
 {
     if (!filename || !sceneManager.get() || !sceneFactory.get())
     {
@@ -4455,6 +5226,35 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
 
     fileGetDirectory(directory, filename);
 
+    // Decode images and parse sub meshes on all threads. Everything else, including the creation
+    // of the Vulkan objects, stays on this thread in file order.
+
+    ScenePrefetch prefetch;
+
+    Map<std::string, SceneStreamImage> allStreamImages;
+    SceneStreamGeometry streamGeometry;
+
+    prefetch.allStreamImages = sceneStream.get() ? &allStreamImages : nullptr;
+    prefetch.streamGeometry = sceneStream.get() ? &streamGeometry : nullptr;
+
+    std::vector<SceneObjectInstance> allObjectInstances;
+
+    if (sceneStream.get())
+    {
+        if (!sceneGatherObjectInstances(allObjectInstances, textBuffer))
+        {
+            return ISceneSP();
+        }
+    }
+
+    if (parallel)
+    {
+        if (!_scenePrefetch(prefetch, directory, filename, sceneManager))
+        {
+            logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not prefetch scene: '%s'", filename);
+        }
+    }
+
     auto scene = sceneFactory->createScene(sceneManager);
 
     if (!scene.get())
@@ -4462,12 +5262,103 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
         return ISceneSP();
     }
 
+    if (sceneStream.get())
+    {
+        sceneStream->setScene(scene);
+    }
+
     char buffer[VKTS_MAX_BUFFER_CHARS + 1];
     char sdata[VKTS_MAX_TOKEN_CHARS + 1];
     float fdata[3];
 
     auto object = IObjectSP();
 
+    // While streaming, the recorded uploads are flushed before anything using them is published.
+
+    VkBool32 flushed = VK_TRUE;
+
+    auto flushRecorded = [&]() -> VkBool32
+    {
+        if (!sceneStream.get() || flushed)
+        {
+            return VK_TRUE;
+        }
+
+        if (!flush())
+        {
+            return VK_FALSE;
+        }
+
+        flushed = VK_TRUE;
+
+        return VK_TRUE;
+    };
+
+    // While streaming, each object is placed and published, as soon as the object library has loaded its meshes.
+    // The stream outlives its functions, so the plain pointer is safe.
+
+    ISceneStream* currentSceneStream = sceneStream.get();
+
+    streamGeometry.objectFunction = [&](const IObjectSP& currentObject) -> VkBool32
+    {
+        // Until placed, the object has its name of the library.
+
+        const std::string objectName = currentObject->getName();
+
+        uint32_t instanceCount = 0;
+
+        for (auto& objectInstance : allObjectInstances)
+        {
+            if (objectInstance.objectName != objectName)
+            {
+                continue;
+            }
+
+            if (objectInstance.hasName)
+            {
+                currentObject->setName(objectInstance.name);
+            }
+            if (objectInstance.hasTranslate)
+            {
+                currentObject->setTranslate(objectInstance.translate);
+            }
+            if (objectInstance.hasRotate)
+            {
+                currentObject->setRotate(objectInstance.rotate);
+            }
+            if (objectInstance.hasScale)
+            {
+                currentObject->setScale(objectInstance.scale);
+            }
+
+            objectInstance.published = VK_TRUE;
+
+            instanceCount++;
+        }
+
+        if (instanceCount == 0)
+        {
+            return VK_TRUE;
+        }
+
+        if (!flush())
+        {
+            return VK_FALSE;
+        }
+
+        sceneStream->publish([currentObject, instanceCount, currentSceneStream](const ISceneSP& scene)
+        {
+            for (uint32_t i = 0; i < instanceCount; i++)
+            {
+                scene->addObject(currentObject);
+            }
+
+            currentSceneStream->updateDescriptorSets(currentObject);
+        });
+
+        return VK_TRUE;
+    };
+
     while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
     {
         if (parseSkipBuffer(buffer))
@@ -4482,7 +5373,12 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
                 return ISceneSP();
             }
 
-            scene->setName(std::string(sdata));
+            std::string name(sdata);
+
+            sceneApply(scene, sceneStream, [name](const ISceneSP& scene)
+            {
+                scene->setName(name);
+            });
         }
         else if (parseIsToken(buffer, "object_library"))
         {
@@ -4491,12 +5387,18 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
                 return ISceneSP();
             }
 
-            if (!sceneLoadObjects(directory, sdata, sceneManager, sceneFactory))
+            if (!sceneLoadObjects(directory, sdata, sceneManager, sceneFactory, (parallel || sceneStream.get()) ? &prefetch : nullptr))
             {
                 logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not load objects: '%s'", sdata, VKTS_MAX_TOKEN_CHARS);
 
                 return ISceneSP();
             }
+
+            flushed = VK_FALSE;
+        }
+        else if (sceneStream.get() && (parseIsToken(buffer, "object") || parseIsToken(buffer, "name") || parseIsToken(buffer, "translate") || parseIsToken(buffer, "rotate") || parseIsToken(buffer, "scale")))
+        {
+            // Already gathered and applied by the object function.
         }
         else if (parseIsToken(buffer, "object"))
         {
@@ -4604,7 +5506,12 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
                 return ISceneSP();
             }
 
-            scene->setEnvironmentStrength(fdata[0]);
+            float environmentStrength = fdata[0];
+
+            sceneApply(scene, sceneStream, [environmentStrength](const ISceneSP& scene)
+            {
+                scene->setEnvironmentStrength(environmentStrength);
+            });
         }
         else if (parseIsToken(buffer, "texture"))
         {
@@ -4625,43 +5532,50 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
             	return ISceneSP();
             }
 
-            scene->setEnvironment(textureObject);
-
-            // Setting the maximum luminance
-            if (textureObject->getImageObject()->getImageData()->isSFLOAT())
+            if (!flushRecorded())
             {
-            	scene->setMaxLuminance(textureObject->getImageObject()->getImageData()->getMaxLuminance());
+                return ISceneSP();
             }
 
-            //
+            sceneApply(scene, sceneStream, [textureObject](const ISceneSP& scene)
+            {
+                scene->setEnvironment(textureObject);
 
-            textureObject = sceneManager->useTextureObject(std::string(sdata) + "_LAMBERT");
+                // Setting the maximum luminance
+                if (textureObject->getImageObject()->getImageData()->isSFLOAT())
+                {
+                	scene->setMaxLuminance(textureObject->getImageObject()->getImageData()->getMaxLuminance());
+                }
+            });
 
-            if (textureObject.get())
-            {
-                scene->setDiffuseEnvironment(textureObject);
+            //
 
-                //
+            auto diffuseTextureObject = sceneManager->useTextureObject(std::string(sdata) + "_LAMBERT");
 
-                textureObject = sceneManager->useTextureObject(std::string(sdata) + "_COOKTORRANCE");
+            if (diffuseTextureObject.get())
+            {
+                auto specularTextureObject = sceneManager->useTextureObject(std::string(sdata) + "_COOKTORRANCE");
 
-                if (!textureObject.get())
+                if (!specularTextureObject.get())
                 {
                 	return ISceneSP();
                 }
 
-                scene->setSpecularEnvironment(textureObject);
-
                 //
 
-                textureObject = sceneManager->useTextureObject("BSDF_LUT_" + std::to_string(VKTS_BSDF_LENGTH) + "_" + std::to_string(VKTS_BSDF_SAMPLES));
+                auto lutTextureObject = sceneManager->useTextureObject("BSDF_LUT_" + std::to_string(VKTS_BSDF_LENGTH) + "_" + std::to_string(VKTS_BSDF_SAMPLES));
 
-                if (!textureObject.get())
+                if (!lutTextureObject.get())
                 {
                 	return ISceneSP();
                 }
 
-                scene->setLut(textureObject);
+                sceneApply(scene, sceneStream, [diffuseTextureObject, specularTextureObject, lutTextureObject](const ISceneSP& scene)
+                {
+                    scene->setDiffuseEnvironment(diffuseTextureObject);
+                    scene->setSpecularEnvironment(specularTextureObject);
+                    scene->setLut(lutTextureObject);
+                });
             }
         }
         else
@@ -4670,46 +5584,111 @@ ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sc
         }
     }
 
+    for (const auto& objectInstance : allObjectInstances)
+    {
+        if (!objectInstance.published)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Object not found: '%s'", objectInstance.objectName.c_str());
+
+            return ISceneSP();
+        }
+    }
+
     // Gather all cameras and add to scene.
 
-    for (uint32_t i = 0; i < sceneManager->getAllCameras().values().size(); i++)
+    const auto allCameras = sceneManager->getAllCameras();
+
+    for (uint32_t i = 0; i < allCameras.values().size(); i++)
     {
-    	scene->addCamera(sceneManager->getAllCameras().valueAt(i));
+    	auto camera = allCameras.valueAt(i);
+
+    	sceneApply(scene, sceneStream, [camera](const ISceneSP& scene)
+    	{
+    		scene->addCamera(camera);
+    	});
     }
 
     // Gather all lights and add to scene.
 
-    for (uint32_t i = 0; i < sceneManager->getAllLights().values().size(); i++)
+    const auto allLights = sceneManager->getAllLights();
+
+    for (uint32_t i = 0; i < allLights.values().size(); i++)
     {
-    	scene->addLight(sceneManager->getAllLights().valueAt(i));
+    	auto light = allLights.valueAt(i);
+
+    	sceneApply(scene, sceneStream, [light](const ISceneSP& scene)
+    	{
+    		scene->addLight(light);
+    	});
     }
 
     // Assign all objects to the particle system.
 
-    for (uint32_t i = 0; i < sceneManager->getAllParticleSystems().values().size(); i++)
+    const auto allParticleSystems = sceneManager->getAllParticleSystems();
+
+    for (uint32_t i = 0; i < allParticleSystems.values().size(); i++)
     {
-    	const auto& currentParticleSystem = sceneManager->getAllParticleSystems().valueAt(i);
+    	const auto& currentParticleSystem = allParticleSystems.valueAt(i);
 
     	auto currentObject = sceneManager->useObject(currentParticleSystem->getRenderObjectName());
 
     	if (currentObject.get())
     	{
-    		currentParticleSystem->setRenderObject(currentObject);
+    		sceneApply(scene, sceneStream, [currentParticleSystem, currentObject](const ISceneSP& scene)
+    		{
+    			currentParticleSystem->setRenderObject(currentObject);
+    		});
     	}
     }
 
+    //
+    // Upload the streamed images.
+    //
+    if (sceneStream.get())
+    {
+        if (!sceneStreamImages(allStreamImages, directory, prefetch, sceneManager, sceneStream, flush))
+        {
+            return ISceneSP();
+        }
+    }
+
     //
     // Free host memory if wanted.
     //
     if (freeHostMemory)
     {
-        for (uint32_t i = 0; i < sceneManager->getAllImageDatas().values().size(); i++)
+        const auto allImageDatas = sceneManager->getAllImageDatas();
+
+        for (uint32_t i = 0; i < allImageDatas.values().size(); i++)
         {
-        	sceneManager->getAllImageDatas().values()[i]->freeHostMemory();
+        	allImageDatas.values()[i]->freeHostMemory();
         }
     }
 
     return scene;
 }
 
+ISceneSP VKTS_APIENTRY sceneLoad(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const VkBool32 freeHostMemory, const VkBool32 parallel)
+{
+    VKTS_PROFILE_ZONE("sceneLoad");
+
+    return sceneLoadScene(filename, sceneManager, sceneFactory, freeHostMemory, parallel, ISceneStreamSP(), SceneStreamFlushFunction());
+}
+
+VkBool32 VKTS_APIENTRY sceneLoadStreaming(const char* filename, const ISceneManagerSP& sceneManager, const ISceneFactorySP& sceneFactory, const ISceneStreamSP& sceneStream, const SceneStreamFlushFunction& flush, const VkBool32 freeHostMemory, const VkBool32 parallel)
+{
+    VKTS_PROFILE_ZONE("sceneLoadStreaming");
+
+    if (!sceneStream.get() || !flush)
+    {
+        return VK_FALSE;
+    }
+
+    VkBool32 loaded = sceneLoadScene(filename, sceneManager, sceneFactory, freeHostMemory, parallel, sceneStream, flush).get() ? VK_TRUE : VK_FALSE;
+
+    sceneStream->finish(loaded);
+
+    return loaded;
+}
+
 }
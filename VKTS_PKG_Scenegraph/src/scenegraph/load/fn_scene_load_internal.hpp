@@ -0,0 +1,176 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef VKTS_FN_SCENE_LOAD_INTERNAL_HPP_
+#define VKTS_FN_SCENE_LOAD_INTERNAL_HPP_
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#define VKTS_SCENE_BINARY_SUFFIX ".bin"
+
+// Medium for colors and factors and a flat normal for normal maps.
+#define VKTS_SCENE_STREAM_PLACEHOLDER_COLOR glm::vec4(0.5f, 0.5f, 1.0f, 1.0f)
+
+namespace vkts
+{
+
+/**
+ * Sub mesh with interleaved vertices, before any Vulkan objects are created.
+ */
+typedef struct _SceneSubMeshData {
+    std::string name;
+    std::string material;
+    VkBool32 doubleSided;
+
+    VkTsVertexBufferType vertexBufferType;
+    int32_t numberVertices;
+    int32_t numberIndices;
+    uint32_t strideInBytes;
+
+    int32_t vertexOffset;
+    int32_t normalOffset;
+    int32_t bitangentOffset;
+    int32_t tangentOffset;
+    int32_t texcoordOffset;
+    int32_t boneIndices0Offset;
+    int32_t boneIndices1Offset;
+    int32_t boneWeights0Offset;
+    int32_t boneWeights1Offset;
+    int32_t numberBonesOffset;
+
+    IBinaryBufferSP vertexBinaryBuffer;
+    IBinaryBufferSP indicesBinaryBuffer;
+} SceneSubMeshData;
+
+typedef std::function<VkBool32(const char* materialLibrary)> SceneMaterialLibraryFunction;
+
+typedef std::function<VkBool32(const SceneSubMeshData& subMeshData)> SceneSubMeshFunction;
+
+/**
+ * Content of one sub mesh library, materials first.
+ */
+typedef struct _SceneSubMeshLibrary {
+    std::vector<std::string> allMaterialLibraries;
+    std::vector<SceneSubMeshData> allSubMeshData;
+} SceneSubMeshLibrary;
+
+/**
+ * Image object, which is uploaded after the scene has been published. Until then, its texture objects sample a placeholder.
+ */
+typedef struct _SceneStreamImage {
+    std::string imageObjectName;
+    std::string imageDataFilename;
+    VkBool32 mipMap;
+    VkBool32 colorData;
+    VkBool32 encode;
+
+    SmartPointerVector<ITextureObjectSP> allTextureObjects;
+} SceneStreamImage;
+
+/**
+ * Placement of an object in the scene, as the object tokens of the scene file set it.
+ */
+typedef struct _SceneObjectInstance {
+    std::string objectName;
+
+    VkBool32 hasName;
+    std::string name;
+
+    VkBool32 hasTranslate;
+    glm::vec3 translate;
+
+    VkBool32 hasRotate;
+    glm::vec3 rotate;
+
+    VkBool32 hasScale;
+    glm::vec3 scale;
+
+    VkBool32 published;
+} SceneObjectInstance;
+
+typedef std::function<VkBool32(const IObjectSP& object)> SceneStreamObjectFunction;
+
+/**
+ * Geometry, which is created when the first node uses it. Each finished object is passed to the object function.
+ */
+typedef struct _SceneStreamGeometry {
+    Map<std::string, SceneSubMeshData> allSubMeshData;
+    Map<std::string, std::vector<std::string>> allMeshSubMeshes;
+
+    SceneStreamObjectFunction objectFunction;
+} SceneStreamGeometry;
+
+/**
+ * Host data of a scene, which was loaded in parallel. The keys are the file names as written in the libraries.
+ * If the stream images are set, non environment image objects are collected there instead of being created.
+ * If the stream geometry is set, sub meshes are collected there as well.
+ */
+typedef struct _ScenePrefetch {
+    Map<std::string, SceneSubMeshLibrary> allSubMeshLibraries;
+    SmartPointerMap<std::string, IImageDataSP> allImageData;
+
+    Map<std::string, SceneStreamImage>* allStreamImages;
+
+    SceneStreamGeometry* streamGeometry;
+} ScenePrefetch;
+
+/**
+ * Tries the directory, the texture directory and the plain file name.
+ */
+VKTS_APICALL IImageDataSP VKTS_APIENTRY _sceneLoadImageData(const char* directory, const char* imageDataFilename);
+
+/**
+ * Visits the converted binary sub meshes, if they are up to date, otherwise the text.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneVisitSubMeshes(const char* directory, const char* filename, const SceneMaterialLibraryFunction& materialLibraryFunction, const SceneSubMeshFunction& subMeshFunction);
+
+/**
+ * Failed entries are just left out, so the serial load reports the error.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _scenePrefetch(ScenePrefetch& prefetch, const char* directory, const char* filename, const ISceneManagerSP& sceneManager);
+
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneParseSubMeshes(const ITextBufferSP& textBuffer, const SceneMaterialLibraryFunction& materialLibraryFunction, const SceneSubMeshFunction& subMeshFunction);
+
+/**
+ * Checks the layout of the binary sub meshes and, if they were converted from the given text.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneCheckBinary(const IBinaryBufferSP& binaryBuffer, const ITextBufferSP& textBuffer);
+
+/**
+ * Vertices and indices are passed as views into the binary buffer. The buffer has to be checked before.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneReadBinary(const IBinaryBufferSP& binaryBuffer, const SceneMaterialLibraryFunction& materialLibraryFunction, const SceneSubMeshFunction& subMeshFunction);
+
+/**
+ * Lays out the sub meshes in the binary format, e.g. for saving them beside the text or in the cache.
+ */
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneCreateBinary(std::vector<uint8_t>& data, const ITextBufferSP& textBuffer, const std::vector<std::string>& allMaterialLibraries, const std::vector<SceneSubMeshData>& allSubMeshData);
+
+VKTS_APICALL VkBool32 VKTS_APIENTRY _sceneWriteBinary(const char* filename, const ITextBufferSP& textBuffer, const std::vector<std::string>& allMaterialLibraries, const std::vector<SceneSubMeshData>& allSubMeshData);
+
+}
+
+#endif /* VKTS_FN_SCENE_LOAD_INTERNAL_HPP_ */
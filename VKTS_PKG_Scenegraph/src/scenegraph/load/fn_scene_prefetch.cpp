@@ -0,0 +1,219 @@
+/**
+ * VKTS - VulKan ToolS.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) since 2014 Norbert Nopper
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vkts/scenegraph/vkts_scenegraph.hpp>
+
+#include "fn_scene_load_internal.hpp"
+
+namespace vkts
+{
+
+static void sceneAppendUnique(std::vector<std::string>& allNames, const std::string& name)
+{
+    if (std::find(allNames.begin(), allNames.end(), name) == allNames.end())
+    {
+        allNames.push_back(name);
+    }
+}
+
+// Only gathers the values of one token, the libraries are loaded later anyway.
+static VkBool32 sceneCollectToken(std::vector<std::string>& allNames, const char* directory, const std::string& filename, const char* token)
+{
+    std::string finalFilename = std::string(directory) + filename;
+
+    auto textBuffer = fileMapText(finalFilename.c_str());
+
+    if (!textBuffer.get())
+    {
+        textBuffer = fileMapText(filename.c_str());
+
+        if (!textBuffer.get())
+        {
+            return VK_FALSE;
+        }
+    }
+
+    char buffer[VKTS_MAX_BUFFER_CHARS + 1];
+    char sdata[VKTS_MAX_TOKEN_CHARS + 1];
+
+    while (textBuffer->gets(buffer, VKTS_MAX_BUFFER_CHARS))
+    {
+        if (parseSkipBuffer(buffer))
+        {
+            continue;
+        }
+
+        if (parseIsToken(buffer, token))
+        {
+            if (!parseString(buffer, sdata, VKTS_MAX_TOKEN_CHARS))
+            {
+                return VK_FALSE;
+            }
+
+            sceneAppendUnique(allNames, sdata);
+        }
+    }
+
+    return VK_TRUE;
+}
+
+static VkBool32 sceneCollectTokens(std::vector<std::string>& allNames, const char* directory, const std::vector<std::string>& allFilenames, const char* token)
+{
+    VkBool32 result = VK_TRUE;
+
+    for (const auto& filename : allFilenames)
+    {
+        if (!sceneCollectToken(allNames, directory, filename, token))
+        {
+            result = VK_FALSE;
+        }
+    }
+
+    return result;
+}
+
+VkBool32 VKTS_APIENTRY _scenePrefetch(ScenePrefetch& prefetch, const char* directory, const char* filename, const ISceneManagerSP& sceneManager)
+{
+    VKTS_PROFILE_ZONE("scenePrefetch");
+
+    if (!directory || !filename || !sceneManager.get())
+    {
+        return VK_FALSE;
+    }
+
+    VkBool32 result = VK_TRUE;
+
+    //
+    // Sub meshes.
+    //
+
+    std::vector<std::string> allObjectLibraries;
+    std::vector<std::string> allMeshLibraries;
+    std::vector<std::string> allSubMeshLibraryNames;
+
+    // The scene itself is not relative to its directory.
+    result = sceneCollectToken(allObjectLibraries, "", filename, "object_library") && result;
+    result = sceneCollectTokens(allMeshLibraries, directory, allObjectLibraries, "mesh_library") && result;
+    result = sceneCollectTokens(allSubMeshLibraryNames, directory, allMeshLibraries, "submesh_library") && result;
+
+    std::vector<SceneSubMeshLibrary> allSubMeshLibraries(allSubMeshLibraryNames.size());
+    std::vector<VkBool32> allSubMeshResults(allSubMeshLibraryNames.size(), VK_FALSE);
+
+    parallelFor(0, (uint32_t)allSubMeshLibraryNames.size(), 1, [&](const uint32_t begin, const uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; i++)
+        {
+            auto& subMeshLibrary = allSubMeshLibraries[i];
+
+            auto materialLibraryFunction = [&subMeshLibrary](const char* materialLibrary) -> VkBool32
+            {
+                subMeshLibrary.allMaterialLibraries.push_back(materialLibrary);
+
+                return VK_TRUE;
+            };
+
+            auto subMeshFunction = [&subMeshLibrary](const SceneSubMeshData& subMeshData) -> VkBool32
+            {
+                subMeshLibrary.allSubMeshData.push_back(subMeshData);
+
+                return VK_TRUE;
+            };
+
+            allSubMeshResults[i] = _sceneVisitSubMeshes(directory, allSubMeshLibraryNames[i].c_str(), materialLibraryFunction, subMeshFunction);
+        }
+    });
+
+    std::vector<std::string> allMaterialLibraries;
+
+    for (size_t i = 0; i < allSubMeshLibraryNames.size(); i++)
+    {
+        if (!allSubMeshResults[i])
+        {
+            result = VK_FALSE;
+
+            continue;
+        }
+
+        for (const auto& materialLibrary : allSubMeshLibraries[i].allMaterialLibraries)
+        {
+            sceneAppendUnique(allMaterialLibraries, materialLibrary);
+        }
+
+        prefetch.allSubMeshLibraries[allSubMeshLibraryNames[i]] = std::move(allSubMeshLibraries[i]);
+    }
+
+    //
+    // Images.
+    //
+
+    std::vector<std::string> allTextureLibraries;
+    std::vector<std::string> allImageLibraries;
+    std::vector<std::string> allImageDataCandidates;
+
+    result = sceneCollectTokens(allTextureLibraries, directory, allMaterialLibraries, "texture_library") && result;
+    result = sceneCollectTokens(allImageLibraries, directory, allTextureLibraries, "image_library") && result;
+    result = sceneCollectTokens(allImageDataCandidates, directory, allImageLibraries, "image_data") && result;
+
+    // Images already known to the manager are not loaded again.
+
+    std::vector<std::string> allImageDataNames;
+
+    for (const auto& imageDataName : allImageDataCandidates)
+    {
+        if (sceneManager->useImageData(std::string(directory) + imageDataName).get() || sceneManager->useImageData(imageDataName).get())
+        {
+            continue;
+        }
+
+        allImageDataNames.push_back(imageDataName);
+    }
+
+    std::vector<IImageDataSP> allImageData(allImageDataNames.size());
+
+    parallelFor(0, (uint32_t)allImageDataNames.size(), 1, [&](const uint32_t begin, const uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; i++)
+        {
+            allImageData[i] = _sceneLoadImageData(directory, allImageDataNames[i].c_str());
+        }
+    });
+
+    for (size_t i = 0; i < allImageDataNames.size(); i++)
+    {
+        if (!allImageData[i].get())
+        {
+            result = VK_FALSE;
+
+            continue;
+        }
+
+        prefetch.allImageData[allImageDataNames[i]] = allImageData[i];
+    }
+
+    return result;
+}
+
+}
@@ -30,7 +30,7 @@ namespace vkts
 {
 
 SceneManager::SceneManager(const IAssetManagerSP& assetManager) :
-    ISceneManager(), assetManager(assetManager), allObjects(), allCameras(), allLights(), allParticleSystems(), allMeshes(), allSubMeshes(), allAnimations(), allChannels(), allBSDFMaterials(), allUsedBSDFMaterials(), allPhongMaterials(), allUsedPhongMaterials()
+    ISceneManager(), assetManager(assetManager), sceneManagerMutex(), allObjects(), allCameras(), allLights(), allParticleSystems(), allMeshes(), allSubMeshes(), allAnimations(), allChannels(), allBSDFMaterials(), allUsedBSDFMaterials(), allPhongMaterials(), allUsedPhongMaterials()
 {
 }
 
@@ -62,6 +62,8 @@ const ICommandObjectSP& SceneManager::getCommandObject() const
 
 IObjectSP SceneManager::useObject(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allObjects))
 	{
 		return IObjectSP();
@@ -74,6 +76,8 @@ IObjectSP SceneManager::useObject(const std::string& name) const
 
 VkBool32 SceneManager::addObject(const IObjectSP& object)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!object.get())
     {
         return VK_FALSE;
@@ -84,6 +88,8 @@ VkBool32 SceneManager::addObject(const IObjectSP& object)
 
 VkBool32 SceneManager::removeObject(const IObjectSP& object)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!object.get())
     {
         return VK_FALSE;
@@ -92,8 +98,10 @@ VkBool32 SceneManager::removeObject(const IObjectSP& object)
     return remove(object->getName(), allObjects);
 }
 
-const SmartPointerMap<std::string, IObjectSP>& SceneManager::getAllObjects() const
+SmartPointerMap<std::string, IObjectSP> SceneManager::getAllObjects() const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	return allObjects;
 }
 
@@ -101,6 +109,8 @@ const SmartPointerMap<std::string, IObjectSP>& SceneManager::getAllObjects() con
 
 ICameraSP SceneManager::useCamera(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allCameras))
 	{
 		return ICameraSP();
@@ -113,6 +123,8 @@ ICameraSP SceneManager::useCamera(const std::string& name) const
 
 VkBool32 SceneManager::addCamera(const ICameraSP& camera)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!camera.get())
     {
         return VK_FALSE;
@@ -123,6 +135,8 @@ VkBool32 SceneManager::addCamera(const ICameraSP& camera)
 
 VkBool32 SceneManager::removeCamera(const ICameraSP& camera)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!camera.get())
     {
         return VK_FALSE;
@@ -131,8 +145,10 @@ VkBool32 SceneManager::removeCamera(const ICameraSP& camera)
     return remove(camera->getName(), allCameras);
 }
 
-const SmartPointerMap<std::string, ICameraSP>& SceneManager::getAllCameras() const
+SmartPointerMap<std::string, ICameraSP> SceneManager::getAllCameras() const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	return allCameras;
 }
 
@@ -140,6 +156,8 @@ const SmartPointerMap<std::string, ICameraSP>& SceneManager::getAllCameras() con
 
 ILightSP SceneManager::useLight(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allLights))
 	{
 		return ILightSP();
@@ -152,6 +170,8 @@ ILightSP SceneManager::useLight(const std::string& name) const
 
 VkBool32 SceneManager::addLight(const ILightSP& light)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!light.get())
     {
         return VK_FALSE;
@@ -162,6 +182,8 @@ VkBool32 SceneManager::addLight(const ILightSP& light)
 
 VkBool32 SceneManager::removeLight(const ILightSP& light)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!light.get())
     {
         return VK_FALSE;
@@ -170,8 +192,10 @@ VkBool32 SceneManager::removeLight(const ILightSP& light)
     return remove(light->getName(), allLights);
 }
 
-const SmartPointerMap<std::string, ILightSP>& SceneManager::getAllLights() const
+SmartPointerMap<std::string, ILightSP> SceneManager::getAllLights() const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	return allLights;
 }
 
@@ -179,6 +203,8 @@ const SmartPointerMap<std::string, ILightSP>& SceneManager::getAllLights() const
 
 IParticleSystemSP SceneManager::useParticleSystem(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allParticleSystems))
 	{
 		return IParticleSystemSP();
@@ -191,6 +217,8 @@ IParticleSystemSP SceneManager::useParticleSystem(const std::string& name) const
 
 VkBool32 SceneManager::addParticleSystem(const IParticleSystemSP& particleSystem)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!particleSystem.get())
     {
         return VK_FALSE;
@@ -201,6 +229,8 @@ VkBool32 SceneManager::addParticleSystem(const IParticleSystemSP& particleSystem
 
 VkBool32 SceneManager::removeParticleSystem(const IParticleSystemSP& particleSystem)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!particleSystem.get())
     {
         return VK_FALSE;
@@ -209,8 +239,10 @@ VkBool32 SceneManager::removeParticleSystem(const IParticleSystemSP& particleSys
     return remove(particleSystem->getName(), allParticleSystems);
 }
 
-const SmartPointerMap<std::string, IParticleSystemSP>& SceneManager::getAllParticleSystems() const
+SmartPointerMap<std::string, IParticleSystemSP> SceneManager::getAllParticleSystems() const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	return allParticleSystems;
 }
 
@@ -218,6 +250,8 @@ const SmartPointerMap<std::string, IParticleSystemSP>& SceneManager::getAllParti
 
 IMeshSP SceneManager::useMesh(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allMeshes))
 	{
 		return IMeshSP();
@@ -230,6 +264,8 @@ IMeshSP SceneManager::useMesh(const std::string& name) const
 
 VkBool32 SceneManager::addMesh(const IMeshSP& mesh)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!mesh.get())
     {
         return VK_FALSE;
@@ -240,6 +276,8 @@ VkBool32 SceneManager::addMesh(const IMeshSP& mesh)
 
 VkBool32 SceneManager::removeMesh(const IMeshSP& mesh)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!mesh.get())
     {
         return VK_FALSE;
@@ -250,6 +288,8 @@ VkBool32 SceneManager::removeMesh(const IMeshSP& mesh)
 
 ISubMeshSP SceneManager::useSubMesh(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allSubMeshes))
 	{
 		return ISubMeshSP();
@@ -262,6 +302,8 @@ ISubMeshSP SceneManager::useSubMesh(const std::string& name) const
 
 VkBool32 SceneManager::addSubMesh(const ISubMeshSP& subMesh)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!subMesh.get())
     {
         return VK_FALSE;
@@ -272,6 +314,8 @@ VkBool32 SceneManager::addSubMesh(const ISubMeshSP& subMesh)
 
 VkBool32 SceneManager::removeSubMesh(const ISubMeshSP& subMesh)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!subMesh.get())
     {
         return VK_FALSE;
@@ -284,6 +328,8 @@ VkBool32 SceneManager::removeSubMesh(const ISubMeshSP& subMesh)
 
 IAnimationSP SceneManager::useAnimation(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allAnimations))
 	{
 		return IAnimationSP();
@@ -296,6 +342,8 @@ IAnimationSP SceneManager::useAnimation(const std::string& name) const
 
 VkBool32 SceneManager::addAnimation(const IAnimationSP& animation)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!animation.get())
     {
         return VK_FALSE;
@@ -306,6 +354,8 @@ VkBool32 SceneManager::addAnimation(const IAnimationSP& animation)
 
 VkBool32 SceneManager::removeAnimation(const IAnimationSP& animation)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!animation.get())
     {
         return VK_FALSE;
@@ -316,6 +366,8 @@ VkBool32 SceneManager::removeAnimation(const IAnimationSP& animation)
 
 IChannelSP SceneManager::useChannel(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allChannels))
 	{
 		return IChannelSP();
@@ -328,6 +380,8 @@ IChannelSP SceneManager::useChannel(const std::string& name) const
 
 VkBool32 SceneManager::addChannel(const IChannelSP& channel)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!channel.get())
     {
         return VK_FALSE;
@@ -338,6 +392,8 @@ VkBool32 SceneManager::addChannel(const IChannelSP& channel)
 
 VkBool32 SceneManager::removeChannel(const IChannelSP& channel)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!channel.get())
     {
         return VK_FALSE;
@@ -350,6 +406,8 @@ VkBool32 SceneManager::removeChannel(const IChannelSP& channel)
 
 IBSDFMaterialSP SceneManager::useBSDFMaterial(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allBSDFMaterials))
 	{
 		return IBSDFMaterialSP();
@@ -373,6 +431,8 @@ IBSDFMaterialSP SceneManager::useBSDFMaterial(const std::string& name) const
 
 VkBool32 SceneManager::addBSDFMaterial(const IBSDFMaterialSP& material)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!material.get())
     {
         return VK_FALSE;
@@ -383,6 +443,8 @@ VkBool32 SceneManager::addBSDFMaterial(const IBSDFMaterialSP& material)
 
 VkBool32 SceneManager::removeBSDFMaterial(const IBSDFMaterialSP& material)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!material.get())
     {
         return VK_FALSE;
@@ -399,6 +461,8 @@ VkBool32 SceneManager::removeBSDFMaterial(const IBSDFMaterialSP& material)
 
 IPhongMaterialSP SceneManager::usePhongMaterial(const std::string& name) const
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
 	if (!contains(name, allPhongMaterials))
 	{
 		return IPhongMaterialSP();
@@ -422,6 +486,8 @@ IPhongMaterialSP SceneManager::usePhongMaterial(const std::string& name) const
 
 VkBool32 SceneManager::addPhongMaterial(const IPhongMaterialSP& material)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!material.get())
     {
         return VK_FALSE;
@@ -432,6 +498,8 @@ VkBool32 SceneManager::addPhongMaterial(const IPhongMaterialSP& material)
 
 VkBool32 SceneManager::removePhongMaterial(const IPhongMaterialSP& material)
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     if (!material.get())
     {
         return VK_FALSE;
@@ -514,7 +582,7 @@ VkBool32 SceneManager::removeImageData(const IImageDataSP& imageData)
     return assetManager->removeImageData(imageData);
 }
 
-const SmartPointerMap<std::string, IImageDataSP>& SceneManager::getAllImageDatas() const
+SmartPointerMap<std::string, IImageDataSP> SceneManager::getAllImageDatas() const
 {
 	return assetManager->getAllImageDatas();
 }
@@ -557,6 +625,8 @@ VkBool32 SceneManager::removeFragmentShaderModule(const IShaderModuleSP& shaderM
 
 void SceneManager::destroy()
 {
+    std::lock_guard<std::mutex> sceneManagerLockGuard(sceneManagerMutex);
+
     allObjects.clear();
 
     allCameras.clear();
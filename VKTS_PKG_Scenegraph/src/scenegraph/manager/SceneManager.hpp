@@ -39,6 +39,9 @@ protected:
 
     IAssetManagerSP assetManager;
 
+    // Guards the registries, so they can be filled concurrently.
+    mutable std::mutex sceneManagerMutex;
+
 
     SmartPointerMap<std::string, IObjectSP> allObjects;
 
@@ -133,7 +136,7 @@ public:
 
     virtual VkBool32 removeObject(const IObjectSP& object) override;
 
-    virtual const SmartPointerMap<std::string, IObjectSP>& getAllObjects() const override;
+    virtual SmartPointerMap<std::string, IObjectSP> getAllObjects() const override;
 
     //
 
@@ -143,7 +146,7 @@ public:
 
     virtual VkBool32 removeCamera(const ICameraSP& camera) override;
 
-    virtual const SmartPointerMap<std::string, ICameraSP>& getAllCameras() const override;
+    virtual SmartPointerMap<std::string, ICameraSP> getAllCameras() const override;
 
     //
 
@@ -153,7 +156,7 @@ public:
 
     virtual VkBool32 removeLight(const ILightSP& light) override;
 
-    virtual const SmartPointerMap<std::string, ILightSP>& getAllLights() const override;
+    virtual SmartPointerMap<std::string, ILightSP> getAllLights() const override;
 
     //
 
@@ -163,7 +166,7 @@ public:
 
     virtual VkBool32 removeParticleSystem(const IParticleSystemSP& particleSystem) override;
 
-    virtual const SmartPointerMap<std::string, IParticleSystemSP>& getAllParticleSystems() const override;
+    virtual SmartPointerMap<std::string, IParticleSystemSP> getAllParticleSystems() const override;
 
     //
 
@@ -242,7 +245,7 @@ public:
 
     virtual VkBool32 removeImageData(const IImageDataSP& imageData) override;
 
-    virtual const SmartPointerMap<std::string, IImageDataSP>& getAllImageDatas() const override;
+    virtual SmartPointerMap<std::string, IImageDataSP> getAllImageDatas() const override;
 
     //
 
@@ -127,6 +127,32 @@ VkBool32 BSDFMaterial::removeTextureObject(const ITextureObjectSP& textureObject
     return allTextureObjects.remove(textureObject);
 }
 
+VkBool32 BSDFMaterial::replaceTextureObject(const ITextureObjectSP& oldTextureObject, const ITextureObjectSP& newTextureObject)
+{
+    if (!oldTextureObject.get() || !newTextureObject.get())
+    {
+        return VK_FALSE;
+    }
+
+    uint32_t index = allTextureObjects.index(oldTextureObject);
+
+    if (index == allTextureObjects.size())
+    {
+        return VK_FALSE;
+    }
+
+	uint32_t offset = forwardRendering ? VKTS_BINDING_UNIFORM_SAMPLER_BSDF_FORWARD_FIRST : VKTS_BINDING_UNIFORM_SAMPLER_BSDF_DEFERRED_FIRST;
+
+	for (uint32_t i = 0; i < materialData.size(); i++)
+	{
+    	materialData[i]->addDescriptorImageInfo(index, offset, newTextureObject->getSampler()->getSampler(), newTextureObject->getImageObject()->getImageView()->getImageView(), newTextureObject->getImageObject()->getImage()->getImageLayout());
+	}
+
+    allTextureObjects[index] = newTextureObject;
+
+    return VK_TRUE;
+}
+
 uint32_t BSDFMaterial::getNumberTextureObjects() const
 {
     return allTextureObjects.size();
@@ -92,6 +92,8 @@ public:
 
     virtual VkBool32 removeTextureObject(const ITextureObjectSP& textureObject) override;
 
+    virtual VkBool32 replaceTextureObject(const ITextureObjectSP& oldTextureObject, const ITextureObjectSP& newTextureObject) override;
+
     virtual uint32_t getNumberTextureObjects() const override;
 
     virtual const SmartPointerVector<ITextureObjectSP>& getTextureObjects() const override;
@@ -30,7 +30,7 @@ namespace vkts
 {
 
 AssetManager::AssetManager(const VkBool32 replace, const IContextObjectSP& contextObject, const ICommandObjectSP& commandObject) :
-    IAssetManager(), replace(replace), contextObject(contextObject), commandObject(commandObject), allTextureObjects(), allImageObjects(), allSamplers(), allImageDatas(), allVertexShaderModules(), allFragmentShaderModules()
+    IAssetManager(), replace(replace), contextObject(contextObject), commandObject(commandObject), assetManagerMutex(), allTextureObjects(), allImageObjects(), allSamplers(), allImageDatas(), allVertexShaderModules(), allFragmentShaderModules()
 {
 }
 
@@ -62,6 +62,8 @@ VkBool32 AssetManager::isReplace() const
 
 ITextureObjectSP AssetManager::useTextureObject(const std::string& name) const
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
 	if (!contains(name, allTextureObjects))
 	{
 		return ITextureObjectSP();
@@ -74,6 +76,8 @@ ITextureObjectSP AssetManager::useTextureObject(const std::string& name) const
 
 VkBool32 AssetManager::addTextureObject(const ITextureObjectSP& textureObject)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!textureObject.get())
     {
         return VK_FALSE;
@@ -84,6 +88,8 @@ VkBool32 AssetManager::addTextureObject(const ITextureObjectSP& textureObject)
 
 VkBool32 AssetManager::removeTextureObject(const ITextureObjectSP& textureObject)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!textureObject.get())
     {
         return VK_FALSE;
@@ -96,6 +102,8 @@ VkBool32 AssetManager::removeTextureObject(const ITextureObjectSP& textureObject
 
 IImageObjectSP AssetManager::useImageObject(const std::string& name) const
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
 	if (!contains(name, allImageObjects))
 	{
 		return IImageObjectSP();
@@ -108,6 +116,8 @@ IImageObjectSP AssetManager::useImageObject(const std::string& name) const
 
 VkBool32 AssetManager::addImageObject(const IImageObjectSP& imageObject)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!imageObject.get())
     {
         return VK_FALSE;
@@ -118,6 +128,8 @@ VkBool32 AssetManager::addImageObject(const IImageObjectSP& imageObject)
 
 VkBool32 AssetManager::removeImageObject(const IImageObjectSP& imageObject)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!imageObject.get())
     {
         return VK_FALSE;
@@ -130,6 +142,8 @@ VkBool32 AssetManager::removeImageObject(const IImageObjectSP& imageObject)
 
 ISamplerSP AssetManager::useSampler(const std::string& name) const
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
 	if (!contains(name, allSamplers))
 	{
 		return ISamplerSP();
@@ -142,6 +156,8 @@ ISamplerSP AssetManager::useSampler(const std::string& name) const
 
 VkBool32 AssetManager::addSampler(const ISamplerSP& sampler)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!sampler.get())
     {
         return VK_FALSE;
@@ -152,6 +168,8 @@ VkBool32 AssetManager::addSampler(const ISamplerSP& sampler)
 
 VkBool32 AssetManager::removeSampler(const ISamplerSP& sampler)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!sampler.get())
     {
         return VK_FALSE;
@@ -164,6 +182,8 @@ VkBool32 AssetManager::removeSampler(const ISamplerSP& sampler)
 
 IImageDataSP AssetManager::useImageData(const std::string& name) const
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
 	if (!contains(name, allImageDatas))
 	{
 		return IImageDataSP();
@@ -176,6 +196,8 @@ IImageDataSP AssetManager::useImageData(const std::string& name) const
 
 VkBool32 AssetManager::addImageData(const IImageDataSP& imageData)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!imageData.get())
     {
         return VK_FALSE;
@@ -186,6 +208,8 @@ VkBool32 AssetManager::addImageData(const IImageDataSP& imageData)
 
 VkBool32 AssetManager::removeImageData(const IImageDataSP& imageData)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!imageData.get())
     {
         return VK_FALSE;
@@ -194,8 +218,10 @@ VkBool32 AssetManager::removeImageData(const IImageDataSP& imageData)
     return remove(imageData->getName(), allImageDatas);
 }
 
-const SmartPointerMap<std::string, IImageDataSP>& AssetManager::getAllImageDatas() const
+SmartPointerMap<std::string, IImageDataSP> AssetManager::getAllImageDatas() const
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
 	return allImageDatas;
 }
 
@@ -203,6 +229,8 @@ const SmartPointerMap<std::string, IImageDataSP>& AssetManager::getAllImageDatas
 
 IShaderModuleSP AssetManager::useVertexShaderModule(const VkTsVertexBufferType vertexBufferType) const
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
 	if (!contains(vertexBufferType, allVertexShaderModules))
 	{
 		return IShaderModuleSP();
@@ -215,6 +243,8 @@ IShaderModuleSP AssetManager::useVertexShaderModule(const VkTsVertexBufferType v
 
 VkBool32 AssetManager::addVertexShaderModule(const VkTsVertexBufferType vertexBufferType, const IShaderModuleSP& shaderModule)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!shaderModule.get())
     {
         return VK_FALSE;
@@ -225,6 +255,8 @@ VkBool32 AssetManager::addVertexShaderModule(const VkTsVertexBufferType vertexBu
 
 VkBool32 AssetManager::removeVertexShaderModule(const VkTsVertexBufferType vertexBufferType, const IShaderModuleSP& shaderModule)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!shaderModule.get())
     {
         return VK_FALSE;
@@ -235,6 +267,8 @@ VkBool32 AssetManager::removeVertexShaderModule(const VkTsVertexBufferType verte
 
 IShaderModuleSP AssetManager::useFragmentShaderModule(const std::string& name) const
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
 	if (!contains(name, allFragmentShaderModules))
 	{
 		return IShaderModuleSP();
@@ -247,6 +281,8 @@ IShaderModuleSP AssetManager::useFragmentShaderModule(const std::string& name) c
 
 VkBool32 AssetManager::addFragmentShaderModule(const IShaderModuleSP& shaderModule)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!shaderModule.get())
     {
         return VK_FALSE;
@@ -257,6 +293,8 @@ VkBool32 AssetManager::addFragmentShaderModule(const IShaderModuleSP& shaderModu
 
 VkBool32 AssetManager::removeFragmentShaderModule(const IShaderModuleSP& shaderModule)
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     if (!shaderModule.get())
     {
         return VK_FALSE;
@@ -271,6 +309,8 @@ VkBool32 AssetManager::removeFragmentShaderModule(const IShaderModuleSP& shaderM
 
 void AssetManager::destroy()
 {
+    std::lock_guard<std::mutex> assetManagerLockGuard(assetManagerMutex);
+
     allTextureObjects.clear();
 
     allImageObjects.clear();
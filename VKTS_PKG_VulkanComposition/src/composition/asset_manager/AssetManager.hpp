@@ -43,6 +43,9 @@ protected:
 
     const ICommandObjectSP commandObject;
 
+    // Guards the registries, so they can be filled concurrently.
+    mutable std::mutex assetManagerMutex;
+
 
     SmartPointerMap<std::string, ITextureObjectSP> allTextureObjects;
 
@@ -150,7 +153,7 @@ public:
 
     virtual VkBool32 removeImageData(const IImageDataSP& imageData) override;
 
-    virtual const SmartPointerMap<std::string, IImageDataSP>& getAllImageDatas() const override;
+    virtual SmartPointerMap<std::string, IImageDataSP> getAllImageDatas() const override;
 
     //
 
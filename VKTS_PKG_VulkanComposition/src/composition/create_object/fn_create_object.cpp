@@ -29,13 +29,49 @@
 namespace vkts
 {
 
-IImageDataSP VKTS_APIENTRY createDeviceImageData(const IAssetManagerSP& assetManager, IImageDataSP& imageData)
+static uint64_t createPipelineCacheKey(const IContextObjectSP& contextObject, const std::string& pipelineCacheName)
 {
-	// Check, if image data can be used on the device.
+	// Pipeline cache data is only valid for the same device and driver.
+
+	VkPhysicalDeviceProperties physicalDeviceProperties;
+
+	contextObject->getPhysicalDevice()->getPhysicalDeviceProperties(physicalDeviceProperties);
+
+	uint32_t allIds[3] = {physicalDeviceProperties.vendorID, physicalDeviceProperties.deviceID, physicalDeviceProperties.driverVersion};
+
+	uint64_t key = cacheCreateKey(physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE, "PIPELINECACHE_" + pipelineCacheName);
+
+	return cacheCreateKey(key, std::string((const char*)allIds, sizeof(allIds)));
+}
 
+IImageDataSP VKTS_APIENTRY createDeviceImageData(const IAssetManagerSP& assetManager, IImageDataSP& imageData, const VkFormat encodeFormat)
+{
 	VkImageTiling imageTiling;
 	VkMemoryPropertyFlags memoryPropertyFlags;
 
+	// Encode to a block format, if requested and supported by the device. Otherwise, the image data is used uncompressed.
+
+	if (encodeFormat != VK_FORMAT_UNDEFINED && !imageDataIsBLOCK(imageData->getFormat()))
+	{
+		VkFormat targetFormat = imageDataGetEncodeFormat(imageData->getFormat(), encodeFormat);
+
+		if (targetFormat != VK_FORMAT_UNDEFINED && assetManager->getContextObject()->getPhysicalDevice()->getGetImageTilingAndMemoryProperty(imageTiling, memoryPropertyFlags, targetFormat, imageData->getImageType(), 0, imageData->getExtent3D(), imageData->getMipLevels(), 1, VK_SAMPLE_COUNT_1_BIT, imageData->getSize(), VK_IMAGE_TILING_BEGIN_RANGE, VK_IMAGE_TILING_OPTIMAL))
+		{
+			auto encodedImageData = imageDataEncode(imageData, targetFormat, imageData->getName());
+
+			if (encodedImageData.get())
+			{
+				imageData = encodedImageData;
+
+				return imageData;
+			}
+
+			logPrint(VKTS_LOG_WARNING, __FILE__, __LINE__, "Could not encode '%s'", imageData->getName().c_str());
+		}
+	}
+
+	// Check, if image data can be used on the device.
+
 	if (!assetManager->getContextObject()->getPhysicalDevice()->getGetImageTilingAndMemoryProperty(imageTiling, memoryPropertyFlags, imageData->getFormat(), imageData->getImageType(), 0, imageData->getExtent3D(), imageData->getMipLevels(), 1, VK_SAMPLE_COUNT_1_BIT, imageData->getSize(), VK_IMAGE_TILING_BEGIN_RANGE, VK_IMAGE_TILING_OPTIMAL))
 	{
 		if (imageData->getFormat() == VK_FORMAT_R8G8B8_UNORM)
@@ -149,6 +185,101 @@ IImageObjectSP VKTS_APIENTRY createImageObject(const IAssetManagerSP& assetManag
 	return imageObject;
 }
 
+IImageObjectSP VKTS_APIENTRY createImageObject(const IAssetManagerSP& assetManager, const std::string& imageObjectName, const IImageDataSP& imageData, const IImageObjectSP& previousImageObject, const uint32_t mipLevel)
+{
+    if (!imageData.get() || mipLevel >= imageData->getMipLevels())
+    {
+    	logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "No image data");
+
+    	return IImageObjectSP();
+    }
+
+    //
+
+	IImageSP image;
+	IDeviceMemorySP deviceMemory;
+
+	if (previousImageObject.get())
+	{
+		image = previousImageObject->getImage();
+		deviceMemory = previousImageObject->getDeviceMemory();
+	}
+	else
+	{
+		VkImageTiling imageTiling;
+		VkMemoryPropertyFlags memoryPropertyFlags;
+
+		if (!assetManager->getContextObject()->getPhysicalDevice()->getGetImageTilingAndMemoryProperty(imageTiling, memoryPropertyFlags, imageData->getFormat(), imageData->getImageType(), 0, imageData->getExtent3D(), imageData->getMipLevels(), 1, VK_SAMPLE_COUNT_1_BIT, imageData->getSize()))
+		{
+			logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Format not supported.");
+
+			return IImageObjectSP();
+		}
+
+		VkImageLayout initialLayout = VK_IMAGE_LAYOUT_PREINITIALIZED;
+		VkAccessFlags srcAccessMask = VK_ACCESS_HOST_WRITE_BIT;
+
+		if (imageTiling == VK_IMAGE_TILING_OPTIMAL)
+		{
+			initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			srcAccessMask = 0;
+		}
+
+		VkImageCreateInfo imageCreateInfo{};
+
+		imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+
+		imageCreateInfo.flags = 0;
+		imageCreateInfo.imageType = imageData->getImageType();
+		imageCreateInfo.format = imageData->getFormat();
+		imageCreateInfo.extent = imageData->getExtent3D();
+		imageCreateInfo.mipLevels = imageData->getMipLevels();
+		imageCreateInfo.arrayLayers = imageData->getArrayLayers();
+		imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		imageCreateInfo.tiling = imageTiling;
+		imageCreateInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		imageCreateInfo.queueFamilyIndexCount = 0;
+		imageCreateInfo.pQueueFamilyIndices = nullptr;
+		imageCreateInfo.initialLayout = initialLayout;
+
+		VkImageSubresourceRange subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, imageData->getMipLevels(), 0, imageData->getArrayLayers()};
+
+		// Image with all mip levels, but none of them uploaded yet.
+
+		auto imageObject = imageObjectCreate(assetManager->getContextObject(), assetManager->getCommandObject()->getCommandBuffer(), imageObjectName, imageCreateInfo, srcAccessMask, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange, memoryPropertyFlags);
+
+		if (!imageObject.get())
+		{
+			return IImageObjectSP();
+		}
+
+		image = imageObject->getImage();
+		deviceMemory = imageObject->getDeviceMemory();
+	}
+
+	//
+
+	IDeviceMemorySP stageDeviceMemory;
+	IBufferSP stageBuffer;
+
+	if (!imageObjectUploadMipLevel(stageBuffer, stageDeviceMemory, assetManager->getContextObject(), assetManager->getCommandObject()->getCommandBuffer(), image, deviceMemory, imageData, mipLevel))
+	{
+		logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload mip level %u.", mipLevel);
+
+		return IImageObjectSP();
+	}
+
+	assetManager->getCommandObject()->addStageBuffer(stageBuffer);
+	assetManager->getCommandObject()->addStageDeviceMemory(stageDeviceMemory);
+
+	// Only the uploaded mip levels are viewed.
+
+	VkImageSubresourceRange subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, imageData->getMipLevels() - mipLevel, 0, imageData->getArrayLayers()};
+
+	return imageObjectCreate(assetManager->getContextObject(), imageObjectName, imageData, image, deviceMemory, subresourceRange);
+}
+
 ITextureObjectSP VKTS_APIENTRY createTextureObject(const IAssetManagerSP& assetManager, const std::string& textureObjectName, const VkBool32 mipmap, const VkFilter filter, const VkSamplerAddressMode samplerAddressMode, const IImageObjectSP& imageObject)
 {
     if (textureObjectName == "")
@@ -479,4 +610,55 @@ IShaderModuleSP VKTS_APIENTRY createShaderModule(const IAssetManagerSP& assetMan
 	return shaderModuleCreate(shaderModuleName, assetManager->getContextObject()->getDevice()->getDevice(), 0, binaryBuffer->getSize(), (uint32_t*)binaryBuffer->getData());
 }
 
+IPipelineCacheSP VKTS_APIENTRY createPipelineCache(const IContextObjectSP& contextObject, const std::string& pipelineCacheName)
+{
+	if (!contextObject.get())
+	{
+		return IPipelineCacheSP();
+	}
+
+	IBinaryBufferSP pipelineCacheData;
+
+	if (cacheGetEnabled())
+	{
+		pipelineCacheData = cacheLoadBinary(createPipelineCacheKey(contextObject, pipelineCacheName));
+	}
+
+	if (pipelineCacheData.get())
+	{
+		auto pipelineCache = pipelineCreateCache(contextObject->getDevice()->getDevice(), 0, (uint32_t)pipelineCacheData->getSize(), pipelineCacheData->getData());
+
+		if (pipelineCache.get())
+		{
+			logPrint(VKTS_LOG_INFO, __FILE__, __LINE__, "Using cached data for '%s'", pipelineCacheName.c_str());
+
+			return pipelineCache;
+		}
+	}
+
+	return pipelineCreateCache(contextObject->getDevice()->getDevice(), 0);
+}
+
+VkBool32 VKTS_APIENTRY savePipelineCache(const IContextObjectSP& contextObject, const std::string& pipelineCacheName, const IPipelineCacheSP& pipelineCache)
+{
+	if (!contextObject.get() || !pipelineCache.get())
+	{
+		return VK_FALSE;
+	}
+
+	if (!cacheGetEnabled())
+	{
+		return VK_TRUE;
+	}
+
+	auto pipelineCacheData = pipelineCache->getData();
+
+	if (!pipelineCacheData.get())
+	{
+		return VK_FALSE;
+	}
+
+	return cacheSaveBinary(createPipelineCacheKey(contextObject, pipelineCacheName), pipelineCacheData);
+}
+
 }
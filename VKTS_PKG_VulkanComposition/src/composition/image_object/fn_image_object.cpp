@@ -428,6 +428,156 @@ IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IContextObjectSP& contextOb
     return IImageObjectSP(newInstance);
 }
 
+IImageObjectSP VKTS_APIENTRY imageObjectCreate(const IContextObjectSP& contextObject, const std::string& name, const IImageDataSP& imageData, const IImageSP& image, const IDeviceMemorySP& deviceMemory, const VkImageSubresourceRange& subresourceRange)
+{
+    if (!image.get())
+    {
+        return IImageObjectSP();
+    }
+
+    VkImageViewCreateInfo imageViewCreateInfo{};
+
+    imageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+
+    imageViewCreateInfo.flags = 0;
+    imageViewCreateInfo.image = image->getImage();
+    imageViewCreateInfo.viewType = (image->getFlags() & VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT) ? VK_IMAGE_VIEW_TYPE_CUBE : VK_IMAGE_VIEW_TYPE_2D;
+    imageViewCreateInfo.format = image->getFormat();
+    imageViewCreateInfo.components = {VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY};
+    imageViewCreateInfo.subresourceRange = subresourceRange;
+
+    auto imageView = imageViewCreate(contextObject->getDevice()->getDevice(), imageViewCreateInfo.flags, imageViewCreateInfo.image, imageViewCreateInfo.viewType, imageViewCreateInfo.format, imageViewCreateInfo.components, imageViewCreateInfo.subresourceRange);
+
+    if (!imageView.get())
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not create image view.");
+
+        return IImageObjectSP();
+    }
+
+    //
+
+    auto newInstance = new ImageObject(contextObject, name, imageData, image, imageView, deviceMemory);
+
+    if (!newInstance)
+    {
+        newInstance->destroy();
+
+        return IImageObjectSP();
+    }
+
+    return IImageObjectSP(newInstance);
+}
+
+VkBool32 VKTS_APIENTRY imageObjectUploadMipLevel(IBufferSP& stageBuffer, IDeviceMemorySP& stageDeviceMemory, const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const IImageSP& image, const IDeviceMemorySP& deviceMemory, const IImageDataSP& imageData, const uint32_t mipLevel)
+{
+    if (!cmdBuffer.get() || !image.get() || !deviceMemory.get() || !imageData.get() || mipLevel >= imageData->getMipLevels())
+    {
+        return VK_FALSE;
+    }
+
+    if (deviceMemory->getMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+        for (uint32_t arrayLayer = 0; arrayLayer < imageData->getArrayLayers(); arrayLayer++)
+        {
+            VkImageSubresource imageSubresource;
+
+            imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            imageSubresource.mipLevel = mipLevel;
+            imageSubresource.arrayLayer = arrayLayer;
+
+            VkSubresourceLayout subresourceLayout;
+
+            image->getImageSubresourceLayout(subresourceLayout, imageSubresource);
+
+            if (!imageObjectUpload(deviceMemory, imageData, mipLevel, arrayLayer, subresourceLayout))
+            {
+                logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not upload image data.");
+
+                return VK_FALSE;
+            }
+        }
+
+        return VK_TRUE;
+    }
+
+    // The staging buffer only holds the mip level of all array layers.
+
+    std::vector<uint32_t> allOffsets(imageData->getArrayLayers());
+    std::vector<uint32_t> allSizes(imageData->getArrayLayers());
+
+    uint32_t stageSize = 0;
+
+    for (uint32_t arrayLayer = 0; arrayLayer < imageData->getArrayLayers(); arrayLayer++)
+    {
+        VkExtent3D currentExtent;
+        uint32_t nextOffset;
+
+        if (!imageData->getExtentAndOffset(currentExtent, allOffsets[arrayLayer], mipLevel, arrayLayer))
+        {
+            return VK_FALSE;
+        }
+
+        if (!imageData->getExtentAndOffset(currentExtent, nextOffset, mipLevel + 1, arrayLayer))
+        {
+            if (!imageData->getExtentAndOffset(currentExtent, nextOffset, 0, arrayLayer + 1))
+            {
+                nextOffset = imageData->getSize();
+            }
+        }
+
+        allSizes[arrayLayer] = nextOffset - allOffsets[arrayLayer];
+
+        stageSize += allSizes[arrayLayer];
+    }
+
+    VkBufferCreateInfo bufferCreateInfo{};
+
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.size = stageSize;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    bufferCreateInfo.flags = 0;
+    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    bufferCreateInfo.queueFamilyIndexCount = 0;
+    bufferCreateInfo.pQueueFamilyIndices = nullptr;
+
+    if (!imageObjectPrepare(stageBuffer, stageDeviceMemory, contextObject, bufferCreateInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not prepare staging buffer.");
+
+        return VK_FALSE;
+    }
+
+    IImageSP targetImage = image;
+
+    uint32_t stageOffset = 0;
+
+    for (uint32_t arrayLayer = 0; arrayLayer < imageData->getArrayLayers(); arrayLayer++)
+    {
+        if (stageDeviceMemory->upload(stageOffset, 0, &imageData->getByteData()[allOffsets[arrayLayer]], allSizes[arrayLayer]) != VK_SUCCESS)
+        {
+            logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not copy data to stage buffer.");
+
+            return VK_FALSE;
+        }
+
+        VkBufferImageCopy bufferImageCopy;
+
+        bufferImageCopy.bufferOffset = stageOffset;
+        bufferImageCopy.bufferRowLength = 0;	// Zero means tightly packed.
+        bufferImageCopy.bufferImageHeight = 0;
+        bufferImageCopy.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, arrayLayer, 1};
+        bufferImageCopy.imageOffset = {0, 0, 0};
+        bufferImageCopy.imageExtent = {glm::max(imageData->getWidth() >> mipLevel, 1u), glm::max(imageData->getHeight() >> mipLevel, 1u), glm::max(imageData->getDepth() >> mipLevel, 1u)};
+
+        stageBuffer->copyBufferToImage(cmdBuffer->getCommandBuffer(), targetImage, bufferImageCopy);
+
+        stageOffset += allSizes[arrayLayer];
+    }
+
+    return VK_TRUE;
+}
+
 vkts::IImageDataSP VKTS_APIENTRY imageObjectGetDeviceImageData(const IContextObjectSP& contextObject, const ICommandBuffersSP& cmdBuffer, const std::string& name, const IImageSP& image)
 {
 	VkResult result;
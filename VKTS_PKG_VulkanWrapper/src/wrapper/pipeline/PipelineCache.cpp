@@ -82,6 +82,42 @@ const VkPipelineCache PipelineCache::getPipelineCache() const
     return pipelineCache;
 }
 
+IBinaryBufferSP PipelineCache::getData() const
+{
+    if (!pipelineCache)
+    {
+        return IBinaryBufferSP();
+    }
+
+    VkResult result;
+
+    size_t dataSize = 0;
+
+    result = vkGetPipelineCacheData(device, pipelineCache, &dataSize, nullptr);
+
+    if (result != VK_SUCCESS || dataSize == 0 || dataSize > (size_t)UINT32_MAX)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get pipeline cache data size.");
+
+        return IBinaryBufferSP();
+    }
+
+    std::vector<uint8_t> data(dataSize);
+
+    result = vkGetPipelineCacheData(device, pipelineCache, &dataSize, &data[0]);
+
+    if (result != VK_SUCCESS)
+    {
+        logPrint(VKTS_LOG_ERROR, __FILE__, __LINE__, "Could not get pipeline cache data.");
+
+        return IBinaryBufferSP();
+    }
+
+    data.resize(dataSize);
+
+    return binaryBufferCreate(data);
+}
+
 //
 // IDestroyable
 //
@@ -72,6 +72,8 @@ public:
 
     virtual const VkPipelineCache getPipelineCache() const override;
 
+    virtual IBinaryBufferSP getData() const override;
+
     //
     // IDestroyable
     //